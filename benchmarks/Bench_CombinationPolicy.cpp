@@ -0,0 +1,71 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, LinearCombinationPolicy>  LinearPolicy;
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, MaximumCombinationPolicy> MaximumPolicy;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 500;
+
+  /// Every operation combines the errors of two arguments
+  template<typename V>
+  void kernel(const std::vector<V>& a, const std::vector<V>& b, std::vector<V>& y)
+  {
+    for(std::size_t i = 0; i < a.size(); i++)
+    {
+      y[i] = a[i] * b[i] + a[i] / b[i] - b[i];
+    }
+  }
+
+  template<typename P>
+  double run(const std::string& name, std::vector<ValueWithError<double, P> >& y)
+  {
+    typedef ValueWithError<double, P> V;
+
+    std::vector<V> a, b;
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      a.push_back(V(1.0 + 1e-3 * static_cast<double>(i), 0.01));
+      b.push_back(V(2.0 - 1e-4 * static_cast<double>(i), 0.02));
+    }
+    y.resize(numElements);
+
+    const double time = benchmark::time_per_call([&]{ kernel(a, b, y); benchmark::do_not_optimize(y.front()); }, repetitions);
+    benchmark::report(name, time, numElements);
+    return time;
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_CombinationPolicy)
+
+BOOST_AUTO_TEST_CASE(arithmetic_kernel)
+{
+  std::vector<ValueWithError<double> > quadrature;
+  std::vector<ValueWithError<double, LinearPolicy> > linear;
+  std::vector<ValueWithError<double, MaximumPolicy> > maximum;
+
+  const double quadratureTime = run("QuadratureCombinationPolicy", quadrature);
+  const double linearTime = run("LinearCombinationPolicy", linear);
+  const double maximumTime = run("MaximumCombinationPolicy", maximum);
+
+  BOOST_TEST_MESSAGE("speedup linear: " << quadratureTime / linearTime << ", maximum: " << quadratureTime / maximumTime);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_EQUAL(linear[i].GetValue(), quadrature[i].GetValue());
+    BOOST_REQUIRE_EQUAL(maximum[i].GetValue(), quadrature[i].GetValue());
+    BOOST_REQUIRE_LE(maximum[i].GetError(), quadrature[i].GetError());
+    BOOST_REQUIRE_LE(quadrature[i].GetError(), linear[i].GetError());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_CombinationPolicy
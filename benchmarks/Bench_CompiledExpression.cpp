@@ -0,0 +1,94 @@
+#include "CompiledExpression.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>         VD;
+  typedef DeferredValueWithError<double> DD;
+  typedef CompiledExpression<double>     Expression;
+
+  const std::size_t numRows     = 1 << 16;
+  const std::size_t repetitions = 10;
+
+  /// Formula which in an application would be assembled from a configuration
+  template<typename X>
+  X formula(const X& x, const X& y, const X& z)
+  {
+    return exp(-1.0 * x * y) * sin(z) + sqrt(x * x + y) / (1.0 + z) - log1p(y * z) * 0.5;
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      xv(numRows), xe(numRows), yv(numRows), ye(numRows), zv(numRows), ze(numRows),
+      fv(numRows), fe(numRows)
+    {
+      for(std::size_t i = 0; i < numRows; i++)
+      {
+        const double t = static_cast<double>(i) / numRows;
+        xv[i] = 0.5 + t; xe[i] = 0.01;
+        yv[i] = 1.5 - t; ye[i] = 0.02;
+        zv[i] = 0.1 + t; ze[i] = 0.03;
+        rows.push_back({ VD(xv[i], xe[i]), VD(yv[i], ye[i]), VD(zv[i], ze[i]) });
+      }
+
+      result.resize(numRows);
+    }
+
+    std::vector<double> xv, xe, yv, ye, zv, ze, fv, fe;
+    std::vector<std::vector<VD> > rows;
+    std::vector<VD> result;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_CompiledExpression,Fixture)
+
+BOOST_AUTO_TEST_CASE(batched_replay)
+{
+  DeferredTape<double> tape;
+  const DD x = tape.Input(0.0, 0.0), y = tape.Input(0.0, 0.0), z = tape.Input(0.0, 0.0);
+  Expression expr({ x, y, z }, { formula(x, y, z) });
+
+  const std::vector<const double*> inValues { xv.data(), yv.data(), zv.data() }, inErrors { xe.data(), ye.data(), ze.data() };
+  const std::vector<double*> outValues { fv.data() }, outErrors { fe.data() };
+
+  const double scalar = benchmark::time_per_call([&]{
+    for(std::size_t i = 0; i < numRows; i++)
+    {
+      result[i] = formula(rows[i][0], rows[i][1], rows[i][2]);
+    }
+    benchmark::do_not_optimize(result.front());
+  }, repetitions);
+
+  const std::size_t tileSize = expr.GetTileSize();
+  expr.SetTileSize(1);
+  const double interpreted = benchmark::time_per_call([&]{ expr.Evaluate(numRows, inValues, inErrors, outValues, outErrors); benchmark::do_not_optimize(fv.front()); }, repetitions);
+
+  expr.SetTileSize(tileSize);
+  const double tiled = benchmark::time_per_call([&]{ expr.Evaluate(numRows, inValues, inErrors, outValues, outErrors); benchmark::do_not_optimize(fv.front()); }, repetitions);
+
+  ThreadPool pool;
+  const double parallel = benchmark::time_per_call([&]{ expr.Evaluate(numRows, inValues, inErrors, outValues, outErrors, pool); benchmark::do_not_optimize(fv.front()); }, repetitions);
+
+  BOOST_TEST_MESSAGE(expr.GetInstructions().size() << " instructions, " << expr.NumSlots() << " slots, tile size " << tileSize << ", " << pool.size() << " threads");
+  benchmark::report("compiled C++ formula, per element", scalar, numRows);
+  benchmark::report("bytecode, per element", interpreted, numRows);
+  benchmark::report("bytecode, tiled", tiled, numRows);
+  benchmark::report("bytecode, tiled, thread pool", parallel, numRows);
+  BOOST_TEST_MESSAGE("speedup tiled vs. per element bytecode: " << interpreted / tiled);
+
+  for(std::size_t i = 0; i < numRows; i++)
+  {
+    BOOST_REQUIRE_EQUAL(fv[i], result[i].GetValue());
+    BOOST_REQUIRE_EQUAL(fe[i], result[i].GetError());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_CompiledExpression
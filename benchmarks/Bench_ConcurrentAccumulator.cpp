@@ -0,0 +1,170 @@
+#include "ConcurrentAccumulator.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef SumAccumulator<double> AD;
+  typedef ConcurrentAccumulator<double> CD;
+
+  const std::size_t numElements = 1 << 18;
+  const std::size_t repetitions = 5;
+
+  /// Runs f(begin, end) on numThreads threads, each with an equal share of the elements
+  template<typename F>
+  void run_threads(std::size_t numThreads, F f)
+  {
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < numThreads; t++)
+    {
+      threads.push_back(std::thread(f, t * numElements / numThreads, (t + 1) * numElements / numThreads));
+    }
+
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        terms.push_back(VD(static_cast<double>(i % 1000), static_cast<double>(1 + i % 10)));
+        reference += terms.back();
+      }
+    }
+
+    /// Integer terms, so every grouping gives the exact sum
+    void check(const VD& sum) const
+    {
+      BOOST_REQUIRE_EQUAL(sum.GetValue(), reference.Result().GetValue());
+      BOOST_REQUIRE_EQUAL(sum.GetError(), reference.Result().GetError());
+    }
+
+    std::vector<VD> terms;
+    AD reference;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_ConcurrentAccumulator,Fixture)
+
+BOOST_AUTO_TEST_CASE(writer_threads)
+{
+  const std::size_t numThreads[] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+  for(std::size_t n : numThreads)
+  {
+    const std::string threads = ", " + std::to_string(n) + " threads";
+
+    // every term under a single mutex
+    AD locked;
+    std::mutex mutex;
+    const double lockedTime = benchmark::time_per_call([&]
+    {
+      locked = AD();
+      run_threads(n, [&](std::size_t begin, std::size_t end)
+      {
+        for(std::size_t i = begin; i < end; i++)
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          locked += terms[i];
+        }
+      });
+    }, repetitions);
+    benchmark::report("mutex" + threads, lockedTime, numElements);
+    check(locked.Result());
+
+    // every term to the slot of its thread
+    VD slotted;
+    const double slottedTime = benchmark::time_per_call([&]
+    {
+      CD sum;
+      run_threads(n, [&](std::size_t begin, std::size_t end)
+      {
+        for(std::size_t i = begin; i < end; i++)
+        {
+          sum += terms[i];
+        }
+      });
+      slotted = sum.Result();
+    }, repetitions);
+    benchmark::report("ConcurrentAccumulator" + threads, slottedTime, numElements);
+    BOOST_TEST_MESSAGE("  speedup vs. mutex: " << lockedTime / slottedTime);
+    check(slotted);
+
+    // thread local sums, merged once per thread
+    VD merged;
+    const double mergedTime = benchmark::time_per_call([&]
+    {
+      CD sum;
+      run_threads(n, [&](std::size_t begin, std::size_t end)
+      {
+        AD local;
+        for(std::size_t i = begin; i < end; i++)
+        {
+          local += terms[i];
+        }
+        sum += local;
+      });
+      merged = sum.Result();
+    }, repetitions);
+    benchmark::report("thread local, merged" + threads, mergedTime, numElements);
+    BOOST_TEST_MESSAGE("  speedup vs. mutex: " << lockedTime / mergedTime);
+    check(merged);
+  }
+
+  BOOST_TEST_MESSAGE("hardware threads: " << std::thread::hardware_concurrency());
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_snapshots)
+{
+  // writers on all but one hardware thread, one reader taking snapshots throughout
+  const std::size_t numWriters = std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1;
+
+  CD sum;
+  std::size_t numSnapshots = 0;
+  const double time = benchmark::time_per_call([&]
+  {
+    CD local;
+    std::atomic<bool> done(false);
+    std::thread reader([&]
+    {
+      while(!done)
+      {
+        benchmark::do_not_optimize(local.Result());
+        numSnapshots++;
+      }
+    });
+
+    run_threads(numWriters, [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        local += terms[i];
+      }
+    });
+
+    done = true;
+    reader.join();
+    sum += local.Snapshot();
+  }, repetitions);
+
+  benchmark::report("ConcurrentAccumulator with reader, " + std::to_string(numWriters) + " writers", time, numElements);
+  BOOST_TEST_MESSAGE("  snapshots: " << numSnapshots);
+  BOOST_REQUIRE_EQUAL(sum.Result().GetValue(), static_cast<double>(repetitions + 1) * reference.GetValue());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_ConcurrentAccumulator
@@ -0,0 +1,101 @@
+#include "CpuDispatch.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 200;
+
+  /// Only arithmetic operators
+  struct Arithmetic
+  {
+    static const char* Name()
+    {
+      return "a*b + a/b - b";
+    }
+
+    template<typename V>
+    V operator()(const V& a, const V& b) const
+    {
+      return a * b + a / b - b;
+    }
+  };
+
+  /// Math functions, these call the scalar functions for each lane
+  struct MathFunctions
+  {
+    static const char* Name()
+    {
+      return "exp(a)*b + sqrt(b)";
+    }
+
+    template<typename V>
+    V operator()(const V& a, const V& b) const
+    {
+      return exp(a) * b + sqrt(b);
+    }
+  };
+
+  /// Throughput of each supported instruction set relative to the generic loop
+  template<typename K>
+  void compare(const std::vector<VD>& a, const std::vector<VD>& b)
+  {
+    const InstructionSet levels[] = { InstructionSet::Generic, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 };
+
+    std::vector<VD> reference(numElements), y(numElements);
+    double generic = 0.0;
+
+    for(std::size_t l = 0; l < sizeof(levels) / sizeof(levels[0]) && levels[l] <= detected_instruction_set(); l++)
+    {
+      const double time = benchmark::time_per_call([&]
+      {
+        batch_transform(levels[l], a.data(), a.data() + a.size(), b.data(), y.data(), K());
+        benchmark::do_not_optimize(y.front());
+      }, repetitions);
+
+      if(levels[l] == InstructionSet::Generic)
+      {
+        generic = time;
+        reference = y;
+      }
+
+      benchmark::report(std::string(K::Name()) + ", " + instruction_set_name(levels[l]), time, numElements);
+      BOOST_TEST_MESSAGE("  " << 1e3 * static_cast<double>(numElements) / time << " M elements/s, speedup: " << generic / time);
+
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        BOOST_REQUIRE_EQUAL(y[i].GetValue(), reference[i].GetValue());
+        BOOST_REQUIRE_CLOSE(y[i].GetError(), reference[i].GetError(), 1e-12);
+      }
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_CpuDispatch)
+
+BOOST_AUTO_TEST_CASE(instruction_sets)
+{
+  BOOST_TEST_MESSAGE("detected: " << instruction_set_name(detected_instruction_set())
+                     << ", active: " << instruction_set_name(active_instruction_set()));
+
+  std::vector<VD> a, b;
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    a.push_back(VD(0.5 + 1e-4 * static_cast<double>(i), 0.01));
+    b.push_back(VD(2.0 - 1e-4 * static_cast<double>(i), 0.02));
+  }
+
+  compare<Arithmetic>(a, b);
+  compare<MathFunctions>(a, b);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_CpuDispatch
@@ -0,0 +1,178 @@
+#include "DeferredValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef boost::multiprecision::cpp_dec_float_50 MPF;
+
+  const std::size_t numPoints  = 64;
+  const std::size_t iterations = 400;
+
+  /// Sum of squared log residuals of the model a * x^b * exp(-c * x), X can be ValueWithError or DeferredValueWithError
+  template<typename X>
+  X objective(const std::vector<X>& data, double a, double b, double c)
+  {
+    X sum = data[0] * 0.0;
+
+    for(std::size_t i = 0; i < data.size(); i++)
+    {
+      const double target = 0.1 * static_cast<double>(i);
+      const X residual = log(a * pow(data[i], b) * exp(-c * data[i])) - target;
+      sum += residual * residual;
+    }
+
+    return sum;
+  }
+
+  /// Compass search, a candidate is accepted if its objective value is smaller
+  struct Optimizer
+  {
+    Optimizer()
+      :
+      params{1.0, 1.0, 1.0},
+      step(0.5),
+      candidate(0),
+      direction(1.0)
+    {}
+
+    /// Next candidate to try
+    std::vector<double> Propose() const
+    {
+      std::vector<double> p(params);
+      p[candidate] += direction * step;
+      return p;
+    }
+
+    void Update(const std::vector<double>& p, bool accepted)
+    {
+      if(accepted)
+      {
+        params = p;
+        return;
+      }
+
+      if(direction > 0.0)
+      {
+        direction = -1.0;
+        return;
+      }
+
+      direction = 1.0;
+      candidate = (candidate + 1) % params.size();
+      if(candidate == 0)
+      {
+        step *= 0.5;
+      }
+    }
+
+    std::vector<double> params;
+    double step;
+    std::size_t candidate;
+    double direction;
+  };
+
+  /// Runs the optimizer with eager and deferred evaluation, only the error of the final point is used
+  template<typename T>
+  void run(const std::string& label, std::size_t repetitions)
+  {
+    typedef ValueWithError<T>         VT;
+    typedef DeferredValueWithError<T> DT;
+    typedef DeferredTape<T>           Tape;
+
+    std::vector<VT> data;
+    for(std::size_t i = 0; i < numPoints; i++)
+    {
+      const double t = 0.1 * static_cast<double>(i);
+      data.push_back(VT(T(1.0 + t + 0.1 * std::sin(7.0 * t)), T(0.05)));
+    }
+
+    VT eagerBest;
+    const double eager = benchmark::time_per_call([&]{
+      Optimizer opt;
+      VT best = objective(data, opt.params[0], opt.params[1], opt.params[2]);
+
+      for(std::size_t i = 0; i < iterations; i++)
+      {
+        const std::vector<double> p = opt.Propose();
+        const VT result = objective(data, p[0], p[1], p[2]);
+        const bool accepted = result.GetValue() < best.GetValue();
+        if(accepted)
+        {
+          best = result;
+        }
+        opt.Update(p, accepted);
+      }
+
+      eagerBest = best;
+      benchmark::do_not_optimize(eagerBest);
+    }, repetitions);
+
+    // the tape of the best point is kept, the tape of the rejected candidates is truncated to the inputs
+    Tape tapes[2];
+    std::vector<DT> inputs[2];
+    for(int k = 0; k < 2; k++)
+    {
+      for(const VT& v : data)
+      {
+        inputs[k].push_back(tapes[k].Input(v));
+      }
+    }
+
+    VT deferredBest;
+    const double deferred = benchmark::time_per_call([&]{
+      int bestTape = 0, trialTape = 1;
+      tapes[bestTape].Truncate(numPoints);
+
+      Optimizer opt;
+      DT best = objective(inputs[bestTape], opt.params[0], opt.params[1], opt.params[2]);
+
+      for(std::size_t i = 0; i < iterations; i++)
+      {
+        tapes[trialTape].Truncate(numPoints);
+
+        const std::vector<double> p = opt.Propose();
+        const DT result = objective(inputs[trialTape], p[0], p[1], p[2]);
+        const bool accepted = result.GetValue() < best.GetValue();
+        if(accepted)
+        {
+          best = result;
+          std::swap(bestTape, trialTape);
+        }
+        opt.Update(p, accepted);
+      }
+
+      deferredBest = best.ToValueWithError();
+      benchmark::do_not_optimize(deferredBest);
+    }, repetitions);
+
+    benchmark::report("optimizer loop, eager, " + label, eager, iterations);
+    benchmark::report("optimizer loop, deferred, " + label, deferred, iterations);
+    BOOST_TEST_MESSAGE("speedup deferred vs. eager: " << eager / deferred);
+
+    BOOST_REQUIRE_EQUAL(deferredBest.GetValue(), eagerBest.GetValue());
+    BOOST_REQUIRE_EQUAL(deferredBest.GetError(), eagerBest.GetError());
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_DeferredValueWithError)
+
+BOOST_AUTO_TEST_CASE(optimizer_loop_double)
+{
+  run<double>("double", 20);
+}
+
+/// error arithmetic is expensive compared to recording a node
+BOOST_AUTO_TEST_CASE(optimizer_loop_multiprecision)
+{
+  run<MPF>("cpp_dec_float_50", 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_DeferredValueWithError
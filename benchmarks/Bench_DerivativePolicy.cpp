@@ -0,0 +1,108 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, FastDerivativePolicy> FastPolicy;
+
+  typedef ValueWithError<double>             VD;
+  typedef ValueWithError<double, FastPolicy> VF;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 50;
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        const double val = 0.05 + 4.0 * static_cast<double>(i) / numElements;
+        exact.push_back(VD(val, 0.01));
+        fast.push_back(VF(val, 0.01));
+      }
+
+      exactResult.resize(numElements);
+      fastResult.resize(numElements);
+    }
+
+    /// Times f with both policies and checks that the errors agree to the given relative tolerance
+    template<typename F>
+    void compare(const char* name, F f, double tolerance)
+    {
+      const double exactTime = benchmark::time_per_call([&]
+      {
+        for(std::size_t i = 0; i < numElements; i++)
+        {
+          exactResult[i] = f(exact[i]);
+        }
+        benchmark::do_not_optimize(exactResult.front());
+      }, repetitions);
+
+      const double fastTime = benchmark::time_per_call([&]
+      {
+        for(std::size_t i = 0; i < numElements; i++)
+        {
+          fastResult[i] = f(fast[i]);
+        }
+        benchmark::do_not_optimize(fastResult.front());
+      }, repetitions);
+
+      benchmark::report(std::string(name) + ", exact derivative", exactTime, numElements);
+      benchmark::report(std::string(name) + ", fast derivative", fastTime, numElements);
+      BOOST_TEST_MESSAGE("  speedup: " << exactTime / fastTime);
+
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        BOOST_REQUIRE_EQUAL(fastResult[i].GetValue(), exactResult[i].GetValue());
+        BOOST_REQUIRE_CLOSE(fastResult[i].GetError(), exactResult[i].GetError(), 100.0 * tolerance);
+      }
+    }
+
+    std::vector<VD> exact, exactResult;
+    std::vector<VF> fast, fastResult;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_DerivativePolicy,Fixture)
+
+// kernels with a template operator() for both policies, the test case names get a trailing underscore
+#define DERIVATIVE_BENCHMARK(function, expression, tolerance)                              \
+  struct function##_kernel                                                                  \
+  {                                                                                         \
+    template<typename V>                                                                    \
+    V operator()(const V& v) const { return expression; }                                   \
+  };                                                                                        \
+                                                                                            \
+  BOOST_AUTO_TEST_CASE(function##_)                                                         \
+  {                                                                                         \
+    compare(#expression, function##_kernel(), tolerance);                                   \
+  }
+
+DERIVATIVE_BENCHMARK(cbrt, cbrt(v), 2e-6)
+DERIVATIVE_BENCHMARK(cos, cos(v), 1e-6)
+DERIVATIVE_BENCHMARK(cosh, cosh(v), 1e-7)
+DERIVATIVE_BENCHMARK(erf, erf(v), 1e-7)
+DERIVATIVE_BENCHMARK(erfc, erfc(v), 1e-7)
+DERIVATIVE_BENCHMARK(exp, exp(v), 1e-7)
+DERIVATIVE_BENCHMARK(exp2, exp2(v), 1e-7)
+DERIVATIVE_BENCHMARK(expm1, expm1(v), 1e-7)
+DERIVATIVE_BENCHMARK(lgamma, lgamma(v), 1e-6)
+DERIVATIVE_BENCHMARK(pow, pow(v, 1.7), 1e-7)
+DERIVATIVE_BENCHMARK(pow_base, pow(2.5, v), 1e-7)
+DERIVATIVE_BENCHMARK(pow_both, pow(v, v), 1e-7)
+DERIVATIVE_BENCHMARK(sin, sin(v), 1e-6)
+DERIVATIVE_BENCHMARK(sinh, sinh(v), 1e-7)
+DERIVATIVE_BENCHMARK(tan, tan(v), 1e-6)
+DERIVATIVE_BENCHMARK(tanh, tanh(v), 1e-7)
+DERIVATIVE_BENCHMARK(tgamma, tgamma(v), 1e-6)
+
+#undef DERIVATIVE_BENCHMARK
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_DerivativePolicy
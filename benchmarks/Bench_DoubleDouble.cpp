@@ -0,0 +1,148 @@
+#include "DoubleDouble.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef boost::multiprecision::cpp_dec_float_50 MPF;
+  typedef ValueWithError<double>                  VD;
+  typedef ValueWithError<DoubleDouble>            VDD;
+  typedef ValueWithError<MPF>                     VMPF;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 50;
+
+  MPF to_mpf(const DoubleDouble& a)
+  {
+    return MPF(a.GetHigh()) + MPF(a.GetLow());
+  }
+
+  double relative_difference(const MPF& result, const MPF& reference)
+  {
+    return static_cast<double>(boost::multiprecision::abs((result - reference) / reference));
+  }
+
+  /// Small contributions on top of a large offset, which cancels at the end
+  template<typename T>
+  ValueWithError<T> offset_sum(const std::vector<ValueWithError<T> >& values)
+  {
+    ValueWithError<T> sum(T(1e16), T());
+    for(std::size_t i = 0; i < values.size(); i++)
+    {
+      sum += values[i];
+    }
+
+    return sum - T(1e16);
+  }
+
+  struct Formula
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return exp(-1.0 * a) * sin(b) / sqrt(a + b);
+    }
+  };
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        const double t = static_cast<double>(i) / numElements;
+        a.push_back(VD(0.1 + t, 0.01));
+        b.push_back(VD(2.0 - t, 0.02));
+        add.push_back(VDD(a.back().GetValue(), a.back().GetError()));
+        bdd.push_back(VDD(b.back().GetValue(), b.back().GetError()));
+        ampf.push_back(VMPF(a.back().GetValue(), a.back().GetError()));
+        bmpf.push_back(VMPF(b.back().GetValue(), b.back().GetError()));
+      }
+    }
+
+    std::vector<VD> a, b;
+    std::vector<VDD> add, bdd;
+    std::vector<VMPF> ampf, bmpf;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_DoubleDouble,Fixture)
+
+BOOST_AUTO_TEST_CASE(cancellation_prone_sum)
+{
+  VD sumD;
+  VDD sumDD;
+  VMPF sumMPF;
+
+  const double timeD = benchmark::time_per_call([&]{ sumD = offset_sum(a); benchmark::do_not_optimize(sumD); }, repetitions);
+  const double timeDD = benchmark::time_per_call([&]{ sumDD = offset_sum(add); benchmark::do_not_optimize(sumDD); }, repetitions);
+  const double timeMPF = benchmark::time_per_call([&]{ sumMPF = offset_sum(ampf); benchmark::do_not_optimize(sumMPF); }, 5);
+
+  const double errorD = relative_difference(MPF(sumD.GetValue()), sumMPF.GetValue());
+  const double errorDD = relative_difference(to_mpf(sumDD.GetValue()), sumMPF.GetValue());
+
+  benchmark::report("double", timeD, numElements);
+  benchmark::report("DoubleDouble", timeDD, numElements);
+  benchmark::report("cpp_dec_float_50", timeMPF, numElements);
+  BOOST_TEST_MESSAGE("relative error of the value, double " << errorD << ", DoubleDouble " << errorDD);
+  BOOST_TEST_MESSAGE("speedup DoubleDouble vs. cpp_dec_float_50: " << timeMPF / timeDD);
+
+  // the rounding errors are relative to the offset of 1e16
+  BOOST_REQUIRE_GT(errorD, 1e-6);
+  BOOST_REQUIRE_LT(errorDD, 1e-14);
+  BOOST_REQUIRE_LT(relative_difference(to_mpf(sumDD.GetError()), sumMPF.GetError()), 1e-28);
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  const Formula f;
+  std::vector<VD> yD(numElements);
+  std::vector<VDD> yDD(numElements);
+  std::vector<VMPF> yMPF(numElements);
+
+  const double timeD = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      yD[i] = f(a[i], b[i]);
+    }
+    benchmark::do_not_optimize(yD.front());
+  }, repetitions);
+
+  const double timeDD = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      yDD[i] = f(add[i], bdd[i]);
+    }
+    benchmark::do_not_optimize(yDD.front());
+  }, repetitions);
+
+  const double timeMPF = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      yMPF[i] = f(ampf[i], bmpf[i]);
+    }
+    benchmark::do_not_optimize(yMPF.front());
+  }, 1);
+
+  benchmark::report("double", timeD, numElements);
+  benchmark::report("DoubleDouble", timeDD, numElements);
+  benchmark::report("cpp_dec_float_50", timeMPF, numElements);
+  BOOST_TEST_MESSAGE("speedup DoubleDouble vs. cpp_dec_float_50: " << timeMPF / timeDD);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_LT(relative_difference(to_mpf(yDD[i].GetValue()), yMPF[i].GetValue()), 1e-29);
+    BOOST_REQUIRE_LT(relative_difference(to_mpf(yDD[i].GetError()), yMPF[i].GetError()), 1e-29);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_DoubleDouble
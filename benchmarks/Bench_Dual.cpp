@@ -0,0 +1,122 @@
+#include "Dual.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 300;
+
+  /// Every argument appears only once, so chaining the ValueWithError overloads gives the exact result as well
+  struct Formula
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b, const T& c) const
+    {
+      return exp(-1.0 * a) * atan2(sin(b), 2.0) / sqrt(c);
+    }
+  };
+
+  /// Uncorrelated errors from central differences with the usual step size of eps^(1/3)
+  VD finite_differences(const VD& a, const VD& b, const VD& c)
+  {
+    const Formula f;
+    const double x[3] = { a.GetValue(), b.GetValue(), c.GetValue() };
+    const double e[3] = { a.GetError(), b.GetError(), c.GetError() };
+    const double step = std::cbrt(std::numeric_limits<double>::epsilon());
+
+    double error = 0.0;
+    for(std::size_t i = 0; i < 3; i++)
+    {
+      double lo[3] = { x[0], x[1], x[2] };
+      double hi[3] = { x[0], x[1], x[2] };
+      const double h = step * std::max(std::abs(x[i]), 1.0);
+      lo[i] -= h;
+      hi[i] += h;
+
+      const double derivative = (f(hi[0], hi[1], hi[2]) - f(lo[0], lo[1], lo[2])) / (hi[i] - lo[i]);
+      error = detail::hypot(error, derivative * e[i]);
+    }
+
+    return VD(f(x[0], x[1], x[2]), error);
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      a(numElements),
+      b(numElements),
+      c(numElements),
+      y(numElements)
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        const double t = static_cast<double>(i) / numElements;
+        a[i] = VD(0.5 + t, 0.01);
+        b[i] = VD(2.0 - t, 0.02);
+        c[i] = VD(1.0 + 3.0 * t, 0.05);
+      }
+    }
+
+    std::vector<VD> a, b, c, y;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_Dual,Fixture)
+
+BOOST_AUTO_TEST_CASE(user_defined_function)
+{
+  std::vector<VD> overloads(numElements), differences(numElements);
+  const Formula f;
+
+  const double handWritten = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      overloads[i] = f(a[i], b[i], c[i]);
+    }
+    benchmark::do_not_optimize(overloads.front());
+  }, repetitions);
+
+  const double dual = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      y[i] = propagate(f, a[i], b[i], c[i]);
+    }
+    benchmark::do_not_optimize(y.front());
+  }, repetitions);
+
+  const double numeric = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      differences[i] = finite_differences(a[i], b[i], c[i]);
+    }
+    benchmark::do_not_optimize(differences.front());
+  }, repetitions);
+
+  benchmark::report("hand-written ValueWithError overloads", handWritten, numElements);
+  benchmark::report("propagate with Dual<double, 3>", dual, numElements);
+  benchmark::report("central finite differences", numeric, numElements);
+  BOOST_TEST_MESSAGE("speedup propagate vs. finite differences: " << numeric / dual);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_EQUAL(y[i].GetValue(), overloads[i].GetValue());
+    BOOST_REQUIRE_CLOSE(y[i].GetError(), overloads[i].GetError(), 1e-10);
+    BOOST_REQUIRE_CLOSE(differences[i].GetError(), overloads[i].GetError(), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_Dual
@@ -0,0 +1,70 @@
+#include "ExactValue.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 500;
+
+  /// Mixed chain of measured values x and constants c, a typical unit conversion and calibration formula
+  template<typename C>
+  void chain(const std::vector<VD>& x, std::vector<VD>& y, const C& c1, const C& c2, const C& c3, const C& c4)
+  {
+    for(std::size_t i = 0; i < x.size(); i++)
+    {
+      y[i] = ((x[i] * c1 + c2) * c3 - c4) / c1 * x[i] + sqrt(x[i] * c4) * c2;
+    }
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      x(numElements),
+      y(numElements)
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        x[i] = VD(1.0 + static_cast<double>(i) / numElements, 0.01);
+      }
+    }
+
+    std::vector<VD> x, y;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_ExactValue,Fixture)
+
+BOOST_AUTO_TEST_CASE(mixed_chain)
+{
+  const VD z1(1e-3, 0.0), z2(2.0, 0.0), z3(60.0, 0.0), z4(0.5, 0.0);
+  const ExactValue<double> e1(1e-3), e2(2.0), e3(60.0), e4(0.5);
+
+  std::vector<VD> reference(numElements);
+
+  const double zeroError = benchmark::time_per_call([&]{ chain(x, reference, z1, z2, z3, z4); benchmark::do_not_optimize(reference.front()); }, repetitions);
+  const double exact = benchmark::time_per_call([&]{ chain(x, y, e1, e2, e3, e4); benchmark::do_not_optimize(y.front()); }, repetitions);
+  const double plain = benchmark::time_per_call([&]{ chain(x, y, 1e-3, 2.0, 60.0, 0.5); benchmark::do_not_optimize(y.front()); }, repetitions);
+
+  benchmark::report("constants as ValueWithError with zero error", zeroError, numElements);
+  benchmark::report("constants as ExactValue", exact, numElements);
+  benchmark::report("constants as double", plain, numElements);
+  BOOST_TEST_MESSAGE("speedup ExactValue vs. zero error: " << zeroError / exact);
+
+  chain(x, y, e1, e2, e3, e4);
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_CLOSE(y[i].GetValue(), reference[i].GetValue(), 1e-12);
+    BOOST_REQUIRE_CLOSE(y[i].GetError(), reference[i].GetError(), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_ExactValue
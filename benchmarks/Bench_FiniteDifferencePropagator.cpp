@@ -0,0 +1,113 @@
+#include "FiniteDifferencePropagator.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>             VD;
+  typedef FiniteDifferencePropagator<double> Propagator;
+  typedef std::vector<std::array<VD, 3> >    Batch;
+
+  const std::size_t numTuples   = 2000;
+  const std::size_t repetitions = 3;
+
+  /// Stand-in for a third-party routine which only accepts double: trapezoidal integral of a damped oscillation
+  double black_box(double damping, double frequency, double length)
+  {
+    const std::size_t numSteps = 64;
+    const double dx = length / numSteps;
+
+    double sum = 0.0;
+    for(std::size_t i = 0; i <= numSteps; i++)
+    {
+      const double x = dx * static_cast<double>(i);
+      const double weight = (i == 0 || i == numSteps) ? 0.5 : 1.0;
+      sum += weight * std::exp(-damping * x) * std::cos(frequency * x);
+    }
+
+    return sum * dx;
+  }
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numTuples; i++)
+      {
+        const double t = static_cast<double>(i) / numTuples;
+        const std::array<VD, 3> args = {{ VD(0.5 + t, 0.05), VD(2.0 + t, 0.1), VD(3.0, 0.01) }};
+        batch.push_back(args);
+      }
+    }
+
+    Batch batch;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_FiniteDifferencePropagator,Fixture)
+
+BOOST_AUTO_TEST_CASE(evaluations_per_result)
+{
+  // a coarse initial step needs refinements, the cache keeps the refined steps for the following tuples
+  Propagator standard, adaptive, cached;
+  adaptive.SetInitialStep(0.05);
+  cached.SetInitialStep(0.05);
+  cached.SetStepCaching(true);
+
+  std::vector<VD> reference, results;
+
+  const double base = benchmark::time_per_call([&]{ reference = standard.PropagateBatch(black_box, batch); }, repetitions);
+  const double plain = benchmark::time_per_call([&]{ results = adaptive.PropagateBatch(black_box, batch); }, repetitions);
+  const double caching = benchmark::time_per_call([&]{ results = cached.PropagateBatch(black_box, batch); }, repetitions);
+
+  const double numResults = static_cast<double>((repetitions + 1) * numTuples);
+
+  benchmark::report("default initial step", base, numTuples);
+  benchmark::report("initial step 0.05", plain, numTuples);
+  benchmark::report("initial step 0.05 with step caching", caching, numTuples);
+  BOOST_TEST_MESSAGE("evaluations per result, default initial step: " << standard.GetNumEvaluations() / numResults);
+  BOOST_TEST_MESSAGE("evaluations per result, initial step 0.05:    " << adaptive.GetNumEvaluations() / numResults);
+  BOOST_TEST_MESSAGE("evaluations per result, with step caching:    " << cached.GetNumEvaluations() / numResults);
+
+  for(std::size_t i = 0; i < numTuples; i++)
+  {
+    BOOST_REQUIRE_EQUAL(results[i].GetValue(), reference[i].GetValue());
+    BOOST_REQUIRE_CLOSE(results[i].GetError(), reference[i].GetError(), 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(wall_clock_scaling)
+{
+  Propagator serial;
+  std::vector<VD> reference;
+  const double base = benchmark::time_per_call([&]{ reference = serial.PropagateBatch(black_box, batch); }, repetitions);
+  benchmark::report("batch without thread pool", base, numTuples);
+
+  const std::size_t numThreads[] = { 1, 2, 4, 8 };
+  for(std::size_t n : numThreads)
+  {
+    ThreadPool pool(n);
+    Propagator parallel(&pool);
+    std::vector<VD> results;
+
+    const double elapsed = benchmark::time_per_call([&]{ results = parallel.PropagateBatch(black_box, batch); }, repetitions);
+    benchmark::report("batch with " + std::to_string(n) + " threads", elapsed, numTuples);
+    BOOST_TEST_MESSAGE("speedup: " << base / elapsed);
+
+    for(std::size_t i = 0; i < numTuples; i++)
+    {
+      BOOST_REQUIRE_EQUAL(results[i].GetValue(), reference[i].GetValue());
+      BOOST_REQUIRE_EQUAL(results[i].GetError(), reference[i].GetError());
+    }
+  }
+
+  BOOST_TEST_MESSAGE("hardware threads: " << ThreadPool::DefaultNumThreads());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_FiniteDifferencePropagator
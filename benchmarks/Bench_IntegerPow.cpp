@@ -0,0 +1,93 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef boost::multiprecision::cpp_dec_float_50 MPF;
+
+  const std::size_t numElements = 4096;
+
+  /// pow(x, double(N)), pow(x, N) and pow<N>(x) for one element type
+  template<typename T, int N>
+  void compare(const std::string& type, std::size_t numValues, std::size_t repetitions)
+  {
+    typedef ValueWithError<T> V;
+
+    std::vector<V> x, y(numValues), z(numValues), w(numValues);
+    for(std::size_t i = 0; i < numValues; i++)
+    {
+      x.push_back(V(T(0.5) + T(static_cast<double>(i) / numValues), T(0.01)));
+    }
+
+    const double generic = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numValues; i++)
+      {
+        y[i] = pow(x[i], T(N));
+      }
+      benchmark::do_not_optimize(y.front());
+    }, repetitions);
+
+    const double runtime = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numValues; i++)
+      {
+        z[i] = pow(x[i], N);
+      }
+      benchmark::do_not_optimize(z.front());
+    }, repetitions);
+
+    const double compileTime = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numValues; i++)
+      {
+        w[i] = pow<N>(x[i]);
+      }
+      benchmark::do_not_optimize(w.front());
+    }, repetitions);
+
+    std::stringstream name;
+    name << type << ", N = " << N << ", ";
+    benchmark::report(name.str() + "pow(x, T(N))", generic, numValues);
+    benchmark::report(name.str() + "pow(x, N)", runtime, numValues);
+    benchmark::report(name.str() + "pow<N>(x)", compileTime, numValues);
+    BOOST_TEST_MESSAGE("  speedup pow(x, N): " << generic / runtime << ", pow<N>(x): " << generic / compileTime);
+
+    const T tolerance = std::numeric_limits<T>::epsilon() * 100;
+    for(std::size_t i = 0; i < numValues; i++)
+    {
+      BOOST_REQUIRE_LE(abs(z[i].GetValue() - y[i].GetValue()), tolerance * abs(y[i].GetValue()));
+      BOOST_REQUIRE_LE(abs(z[i].GetError() - y[i].GetError()), tolerance * y[i].GetError());
+      BOOST_REQUIRE_LE(abs(w[i].GetValue() - y[i].GetValue()), tolerance * abs(y[i].GetValue()));
+      BOOST_REQUIRE_LE(abs(w[i].GetError() - y[i].GetError()), tolerance * y[i].GetError());
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_IntegerPow)
+
+BOOST_AUTO_TEST_CASE(builtin)
+{
+  compare<double, 2>("double", numElements, 200);
+  compare<double, 3>("double", numElements, 200);
+  compare<double, 7>("double", numElements, 200);
+  compare<double, -2>("double", numElements, 200);
+}
+
+BOOST_AUTO_TEST_CASE(multiprecision)
+{
+  compare<MPF, 2>("cpp_dec_float_50", numElements / 16, 20);
+  compare<MPF, 3>("cpp_dec_float_50", numElements / 16, 20);
+  compare<MPF, 7>("cpp_dec_float_50", numElements / 16, 20);
+  compare<MPF, -2>("cpp_dec_float_50", numElements / 16, 20);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_IntegerPow
@@ -0,0 +1,150 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <vector>
+
+#include <boost/multiprecision/cpp_dec_float.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef boost::multiprecision::cpp_dec_float_100 MPH;
+
+  typedef MemoizedDerivativePolicy<> Memoized;
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, Memoized> MemoizedPolicy;
+
+  const std::size_t numDistinct = 16;
+
+  /// numElements arguments with numDistinct distinct values
+  template<typename T, typename P>
+  std::vector<ValueWithError<T, P> > arguments(std::size_t numElements)
+  {
+    std::vector<ValueWithError<T, P> > result;
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      const T value = T(1) / 4 + T(static_cast<int>(i % numDistinct)) / 8;
+      result.push_back(ValueWithError<T, P>(value, T(1) / 100));
+    }
+    return result;
+  }
+
+  /// The first of the repetitions fills the cache
+  template<typename T, typename F>
+  void compare(const char* name, F f, std::size_t numElements, std::size_t repetitions)
+  {
+    typedef ValueWithError<T>                 V;
+    typedef ValueWithError<T, MemoizedPolicy> M;
+
+    const std::vector<V> exact = arguments<T, ExactValueAndIgnoreErrorPolicy>(numElements);
+    const std::vector<M> memoized = arguments<T, MemoizedPolicy>(numElements);
+    std::vector<V> exactResult(numElements);
+    std::vector<M> memoizedResult(numElements);
+
+    Memoized::Clear<T>();
+
+    const double exactTime = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        exactResult[i] = f(exact[i]);
+      }
+      benchmark::do_not_optimize(exactResult.front());
+    }, repetitions);
+
+    const double memoizedTime = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        memoizedResult[i] = f(memoized[i]);
+      }
+      benchmark::do_not_optimize(memoizedResult.front());
+    }, repetitions);
+
+    benchmark::report(std::string(name) + ", exact", exactTime, numElements);
+    benchmark::report(std::string(name) + ", memoized", memoizedTime, numElements);
+    BOOST_TEST_MESSAGE("  speedup: " << exactTime / memoizedTime
+                       << ", hit rate: " << Memoized::Statistics<T>().GetHitRate());
+
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      BOOST_REQUIRE(memoizedResult[i].GetValue() == exactResult[i].GetValue());
+      BOOST_REQUIRE(memoizedResult[i].GetError() == exactResult[i].GetError());
+    }
+  }
+
+  struct Erf
+  {
+    template<typename V>
+    V operator()(const V& v) const { return erf(v); }
+  };
+
+  struct Erfc
+  {
+    template<typename V>
+    V operator()(const V& v) const { return erfc(v); }
+  };
+
+  struct Lgamma
+  {
+    template<typename V>
+    V operator()(const V& v) const { return lgamma(v); }
+  };
+
+  struct Tgamma
+  {
+    template<typename V>
+    V operator()(const V& v) const { return tgamma(v); }
+  };
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_Memoization)
+
+BOOST_AUTO_TEST_CASE(multiprecision)
+{
+  // erf and erfc take milliseconds
+  compare<MPH>("cpp_dec_float_100 erf", Erf(), 64, 1);
+  compare<MPH>("cpp_dec_float_100 erfc", Erfc(), 64, 1);
+  compare<MPH>("cpp_dec_float_100 lgamma", Lgamma(), 256, 2);
+  compare<MPH>("cpp_dec_float_100 tgamma", Tgamma(), 256, 2);
+}
+
+BOOST_AUTO_TEST_CASE(builtin)
+{
+  compare<double>("double erf", Erf(), 1024, 100);
+  compare<double>("double lgamma", Lgamma(), 1024, 100);
+  compare<double>("double tgamma", Tgamma(), 1024, 100);
+}
+
+BOOST_AUTO_TEST_CASE(constants)
+{
+  // boost::math computes the constants once per type, later calls only copy them
+  const std::size_t numElements = 1024;
+  const std::size_t repetitions = 5;
+  MPH sum = 0;
+  const double cached = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      sum += boost::math::constants::root_pi<MPH>();
+    }
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+
+  const double computed = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      sum += sqrt(boost::math::constants::pi<MPH>());
+    }
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+
+  benchmark::report("cpp_dec_float_100 root_pi<T>()", cached, numElements);
+  benchmark::report("cpp_dec_float_100 sqrt(pi<T>())", computed, numElements);
+  BOOST_REQUIRE_CLOSE(boost::math::constants::root_pi<MPH>(), sqrt(boost::math::constants::pi<MPH>()), MPH(1e-90));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_Memoization
@@ -0,0 +1,188 @@
+#include "MixedPrecisionValueWithError.hpp"
+#include "DoubleDouble.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef boost::multiprecision::cpp_dec_float_100 MP;
+
+  /// Large enough to exceed the caches, so that the affine kernel is limited by the memory bandwidth
+  const std::size_t numStreamElements = 1 << 21;
+  const std::size_t streamRepetitions = 20;
+
+  const std::size_t numChainElements = 256;
+  const std::size_t chainRepetitions = 5;
+
+  /// Times y = 2 x + 1 over arrays of objects
+  template<typename V>
+  double time_affine(const std::vector<V>& x, std::vector<V>& y)
+  {
+    return benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < x.size(); i++)
+      {
+        y[i] = 2.0 * x[i] + 1.0;
+      }
+      benchmark::do_not_optimize(y.front());
+    }, streamRepetitions);
+  }
+
+  /// Times y = 2 x + 1 with values and errors in separate arrays
+  template<typename E>
+  double time_affine_split(const std::vector<double>& xv, const std::vector<E>& xe, std::vector<double>& yv, std::vector<E>& ye)
+  {
+    typedef MixedPrecisionValueWithError<double, E> M;
+
+    return benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < xv.size(); i++)
+      {
+        const M y = 2.0 * M(xv[i], xe[i]) + 1.0;
+        yv[i] = y.GetValue();
+        ye[i] = y.GetError();
+      }
+      benchmark::do_not_optimize(yv.front());
+      benchmark::do_not_optimize(ye.front());
+    }, streamRepetitions);
+  }
+
+  struct Formula
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return exp(-1.0 * a) * atan2(sin(b), 2.0) / sqrt(a + b);
+    }
+  };
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_MixedPrecisionValueWithError)
+
+BOOST_AUTO_TEST_CASE(bandwidth_bound)
+{
+  std::vector<double> xv(numStreamElements), yv(numStreamElements);
+  std::vector<double> xe(numStreamElements), ye(numStreamElements);
+  std::vector<float> xf(numStreamElements), yf(numStreamElements);
+
+  for(std::size_t i = 0; i < numStreamElements; i++)
+  {
+    xv[i] = 1.0 + 1e-6 * static_cast<double>(i);
+    xe[i] = 0.01;
+    xf[i] = 0.01f;
+  }
+
+  {
+    std::vector<ValueWithError<double> > x(numStreamElements), y(numStreamElements);
+    std::vector<MixedPrecisionValueWithError<double, float> > mx(numStreamElements), my(numStreamElements);
+    for(std::size_t i = 0; i < numStreamElements; i++)
+    {
+      x[i] = ValueWithError<double>(xv[i], xe[i]);
+      mx[i] = MixedPrecisionValueWithError<double, float>(xv[i], xf[i]);
+    }
+
+    const double full = time_affine(x, y);
+    const double mixed = time_affine(mx, my);
+
+    BOOST_TEST_MESSAGE("array of objects, " << sizeof(x[0]) << " vs. " << sizeof(mx[0]) << " bytes per element");
+    benchmark::report("ValueWithError<double>", full, numStreamElements);
+    benchmark::report("MixedPrecisionValueWithError<double, float>", mixed, numStreamElements);
+
+    for(std::size_t i = 0; i < numStreamElements; i++)
+    {
+      BOOST_REQUIRE_EQUAL(my[i].GetValue(), y[i].GetValue());
+      BOOST_REQUIRE_CLOSE(static_cast<double>(my[i].GetError()), y[i].GetError(), 1e-4);
+    }
+  }
+
+  {
+    const double full = time_affine_split(xv, xe, yv, ye);
+    const double mixed = time_affine_split(xv, xf, yv, yf);
+
+    BOOST_TEST_MESSAGE("separate arrays, 16 vs. 12 bytes per element");
+    benchmark::report("double values, double errors", full, numStreamElements);
+    benchmark::report("double values, float errors", mixed, numStreamElements);
+    BOOST_TEST_MESSAGE("speedup: " << full / mixed);
+
+    for(std::size_t i = 0; i < numStreamElements; i++)
+    {
+      BOOST_REQUIRE_CLOSE(static_cast<double>(yf[i]), ye[i], 1e-4);
+    }
+  }
+
+  {
+    std::vector<ValueWithError<DoubleDouble> > x(numStreamElements), y(numStreamElements);
+    std::vector<MixedPrecisionValueWithError<DoubleDouble, double> > mx(numStreamElements), my(numStreamElements);
+    for(std::size_t i = 0; i < numStreamElements; i++)
+    {
+      x[i] = ValueWithError<DoubleDouble>(xv[i], xe[i]);
+      mx[i] = MixedPrecisionValueWithError<DoubleDouble, double>(xv[i], xe[i]);
+    }
+
+    const double full = time_affine(x, y);
+    const double mixed = time_affine(mx, my);
+
+    BOOST_TEST_MESSAGE("array of objects, " << sizeof(x[0]) << " vs. " << sizeof(mx[0]) << " bytes per element");
+    benchmark::report("ValueWithError<DoubleDouble>", full, numStreamElements);
+    benchmark::report("MixedPrecisionValueWithError<DoubleDouble, double>", mixed, numStreamElements);
+    BOOST_TEST_MESSAGE("speedup: " << full / mixed);
+
+    for(std::size_t i = 0; i < numStreamElements; i++)
+    {
+      BOOST_REQUIRE_EQUAL(my[i].GetValue(), y[i].GetValue());
+      BOOST_REQUIRE_CLOSE(my[i].GetError(), y[i].GetError().GetHigh(), 1e-13);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(multiprecision_chain)
+{
+  const Formula f;
+  std::vector<ValueWithError<MP> > a, b, y(numChainElements);
+  std::vector<MixedPrecisionValueWithError<MP, double> > ma, mb, my(numChainElements);
+
+  for(std::size_t i = 0; i < numChainElements; i++)
+  {
+    const double t = static_cast<double>(i) / numChainElements;
+    a.push_back(ValueWithError<MP>(MP(0.5 + t), MP(0.01)));
+    b.push_back(ValueWithError<MP>(MP(2.0 - t), MP(0.02)));
+    ma.push_back(MixedPrecisionValueWithError<MP, double>(MP(0.5 + t), 0.01));
+    mb.push_back(MixedPrecisionValueWithError<MP, double>(MP(2.0 - t), 0.02));
+  }
+
+  const double full = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numChainElements; i++)
+    {
+      y[i] = f(a[i], b[i]);
+    }
+    benchmark::do_not_optimize(y.front());
+  }, chainRepetitions);
+
+  const double mixed = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numChainElements; i++)
+    {
+      my[i] = f(ma[i], mb[i]);
+    }
+    benchmark::do_not_optimize(my.front());
+  }, chainRepetitions);
+
+  benchmark::report("ValueWithError<cpp_dec_float_100>", full, numChainElements);
+  benchmark::report("MixedPrecisionValueWithError<cpp_dec_float_100, double>", mixed, numChainElements);
+  BOOST_TEST_MESSAGE("speedup: " << full / mixed);
+
+  for(std::size_t i = 0; i < numChainElements; i++)
+  {
+    BOOST_REQUIRE_EQUAL(my[i].GetValue(), y[i].GetValue());
+    BOOST_REQUIRE_CLOSE(my[i].GetError(), static_cast<double>(y[i].GetError()), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_MixedPrecisionValueWithError
@@ -0,0 +1,102 @@
+#include "MultiComponentValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 1024;
+  const std::size_t repetitions = 100;
+
+  template<typename V>
+  V kernel(const V& a, const V& b)
+  {
+    return exp(a) * b + a / b - sqrt(b);
+  }
+
+  /// N separate ValueWithError computations against one MultiComponentValueWithError<double, N>
+  template<std::size_t N>
+  void compare()
+  {
+    typedef MultiComponentValueWithError<double, N> MD;
+
+    std::vector<MD> a, b, y(numElements);
+    std::vector<std::vector<VD> > sa(N), sb(N), sy(N, std::vector<VD>(numElements));
+
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      std::array<double, N> ea, eb;
+      for(std::size_t k = 0; k < N; k++)
+      {
+        ea[k] = 1e-3 * static_cast<double>(k + 1);
+        eb[k] = 2e-3 / static_cast<double>(k + 1);
+      }
+
+      a.push_back(MD(0.5 + 1e-4 * static_cast<double>(i), ea));
+      b.push_back(MD(2.0 - 1e-4 * static_cast<double>(i), eb));
+
+      for(std::size_t k = 0; k < N; k++)
+      {
+        sa[k].push_back(a.back().GetComponent(k));
+        sb[k].push_back(b.back().GetComponent(k));
+      }
+    }
+
+    const double separate = benchmark::time_per_call([&]
+    {
+      for(std::size_t k = 0; k < N; k++)
+      {
+        for(std::size_t i = 0; i < numElements; i++)
+        {
+          sy[k][i] = kernel(sa[k][i], sb[k][i]);
+        }
+        benchmark::do_not_optimize(sy[k].front());
+      }
+    }, repetitions);
+
+    const double multi = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        y[i] = kernel(a[i], b[i]);
+      }
+      benchmark::do_not_optimize(y.front());
+    }, repetitions);
+
+    std::stringstream name;
+    name << "N = " << N << ", ";
+    benchmark::report(name.str() + "separate ValueWithError", separate, numElements);
+    benchmark::report(name.str() + "MultiComponentValueWithError", multi, numElements);
+    BOOST_TEST_MESSAGE("  speedup: " << separate / multi);
+
+    for(std::size_t k = 0; k < N; k++)
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        BOOST_REQUIRE_EQUAL(y[i].GetValue(), sy[k][i].GetValue());
+        BOOST_REQUIRE_CLOSE(y[i].GetError(k), sy[k][i].GetError(), 1e-12);
+      }
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_MultiComponentValueWithError)
+
+BOOST_AUTO_TEST_CASE(components)
+{
+  compare<1>();
+  compare<2>();
+  compare<4>();
+  compare<8>();
+  compare<16>();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_MultiComponentValueWithError
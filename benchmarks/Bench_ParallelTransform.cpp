@@ -0,0 +1,130 @@
+#include "ParallelTransform.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 1 << 14;
+  const std::size_t repetitions = 5;
+
+  /// Cost proportional to the integer part of the value
+  struct Iterate
+  {
+    VD operator()(const VD& v) const
+    {
+      VD r = v;
+      for(int k = static_cast<int>(v.GetValue()); k > 0; k--)
+      {
+        r = sin(r) + v;
+      }
+      return r;
+    }
+  };
+
+  /// Eight iterations per element
+  std::vector<VD> uniform()
+  {
+    return std::vector<VD>(numElements, VD(8.5, 0.01));
+  }
+
+  /// Same total cost as uniform(), all of it in the first eighth of the elements
+  std::vector<VD> skewed()
+  {
+    std::vector<VD> result(numElements, VD(0.5, 0.01));
+    std::fill(result.begin(), result.begin() + numElements / 8, VD(64.5, 0.01));
+    return result;
+  }
+
+  /// One equal chunk per thread, as with static OpenMP scheduling
+  void static_chunks(ThreadPool& pool, const std::vector<VD>& x, std::vector<VD>& y)
+  {
+    const std::size_t numChunks = pool.size();
+    std::vector<std::future<void> > futures;
+
+    for(std::size_t c = 0; c < numChunks; c++)
+    {
+      const std::size_t begin = c * numElements / numChunks;
+      const std::size_t end = (c + 1) * numElements / numChunks;
+      futures.push_back(pool.Submit([&x, &y, begin, end]
+      {
+        for(std::size_t i = begin; i < end; i++)
+        {
+          y[i] = Iterate()(x[i]);
+        }
+      }));
+    }
+
+    for(std::future<void>& future : futures)
+    {
+      future.get();
+    }
+  }
+
+  void scaling(const std::string& name, const std::vector<VD>& x)
+  {
+    std::vector<VD> reference(numElements), y(numElements);
+
+    const double serial = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        reference[i] = Iterate()(x[i]);
+      }
+      benchmark::do_not_optimize(reference.front());
+    }, repetitions);
+    benchmark::report(name + ", serial", serial, numElements);
+
+    const std::size_t numThreads[] = { 1, 2, 4, 8 };
+    for(std::size_t n : numThreads)
+    {
+      ThreadPool pool(n);
+      const std::string threads = ", " + std::to_string(n) + " threads";
+
+      const double chunked = benchmark::time_per_call([&]
+      {
+        static_chunks(pool, x, y);
+        benchmark::do_not_optimize(y.front());
+      }, repetitions);
+      benchmark::report(name + ", static chunks" + threads, chunked, numElements);
+      BOOST_REQUIRE(y == reference);
+
+      const std::size_t grains[] = { 0, 16 };
+      for(std::size_t grain : grains)
+      {
+        const double stealing = benchmark::time_per_call([&]
+        {
+          parallel_transform(pool, x.data(), x.data() + x.size(), y.data(), Iterate(), grain);
+          benchmark::do_not_optimize(y.front());
+        }, repetitions);
+        benchmark::report(name + ", work stealing, grain " + (grain == 0 ? std::string("default") : std::to_string(grain)) + threads,
+                          stealing, numElements);
+        BOOST_TEST_MESSAGE("  speedup vs. serial: " << serial / stealing << ", vs. static chunks: " << chunked / stealing);
+        BOOST_REQUIRE(y == reference);
+      }
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_ParallelTransform)
+
+BOOST_AUTO_TEST_CASE(uniform_cost)
+{
+  scaling("uniform", uniform());
+  BOOST_TEST_MESSAGE("hardware threads: " << ThreadPool::DefaultNumThreads());
+}
+
+BOOST_AUTO_TEST_CASE(skewed_cost)
+{
+  scaling("skewed", skewed());
+  BOOST_TEST_MESSAGE("hardware threads: " << ThreadPool::DefaultNumThreads());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_ParallelTransform
@@ -0,0 +1,158 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <sstream>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 200;
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        const double val = -0.9 + 1.8 * static_cast<double>(i) / numElements;
+        x.push_back(VD(val, 0.01));
+        exact.push_back(val);
+        y.push_back(VD(1.0 + val, 0.02));
+        z.push_back(VD(0.5 * val, 0.03));
+      }
+
+      result.resize(numElements);
+      reference.resize(numElements);
+    }
+
+    std::vector<VD> x, y, z, result, reference;
+    std::vector<double> exact;
+  };
+
+  std::vector<VD> coefficients(std::size_t degree)
+  {
+    std::vector<VD> c;
+    for(std::size_t k = 0; k <= degree; k++)
+    {
+      c.push_back(VD(1.0 / static_cast<double>(k + 1), 0.001 * static_cast<double>(k + 1)));
+    }
+    return c;
+  }
+
+  /// ((c_n * x + c_{n-1}) * x + ...) + c_0
+  template<typename X>
+  VD chain(const std::vector<VD>& c, const X& x)
+  {
+    VD p = c.back();
+    for(std::size_t k = c.size() - 1; k > 0; k--)
+    {
+      p = p * x + c[k - 1];
+    }
+    return p;
+  }
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_Polynomial,Fixture)
+
+BOOST_AUTO_TEST_CASE(fused_multiply_add)
+{
+  const double operators = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      result[i] = x[i] * y[i] + z[i];
+    }
+    benchmark::do_not_optimize(result.front());
+  }, repetitions);
+
+  const double fused = benchmark::time_per_call([&]
+  {
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      reference[i] = fma(x[i], y[i], z[i]);
+    }
+    benchmark::do_not_optimize(reference.front());
+  }, repetitions);
+
+  benchmark::report("x * y + z", operators, numElements);
+  benchmark::report("fma(x, y, z)", fused, numElements);
+  BOOST_TEST_MESSAGE("  speedup: " << operators / fused);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_CLOSE(reference[i].GetError(), result[i].GetError(), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(horner)
+{
+  const std::size_t degrees[] = { 4, 8, 16, 32 };
+
+  for(std::size_t d = 0; d < sizeof(degrees) / sizeof(degrees[0]); d++)
+  {
+    const std::vector<VD> c = coefficients(degrees[d]);
+
+    std::stringstream name;
+    name << "degree " << degrees[d] << ", ";
+
+    // x with error, the chain misses the correlation of the terms, so only the values are compared
+    const double operators = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        reference[i] = chain(c, x[i]);
+      }
+      benchmark::do_not_optimize(reference.front());
+    }, repetitions);
+
+    const double horner = benchmark::time_per_call([&]
+    {
+      evaluate_polynomial(c.begin(), c.end(), x.begin(), x.end(), result.begin());
+      benchmark::do_not_optimize(result.front());
+    }, repetitions);
+
+    benchmark::report(name.str() + "operator chain", operators, numElements);
+    benchmark::report(name.str() + "evaluate_polynomial", horner, numElements);
+    BOOST_TEST_MESSAGE("  speedup: " << operators / horner);
+
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      BOOST_REQUIRE_CLOSE(result[i].GetValue(), reference[i].GetValue(), 1e-10);
+    }
+
+    // exact x, both give the same error
+    const double operatorsExact = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        reference[i] = chain(c, exact[i]);
+      }
+      benchmark::do_not_optimize(reference.front());
+    }, repetitions);
+
+    const double hornerExact = benchmark::time_per_call([&]
+    {
+      evaluate_polynomial(c.begin(), c.end(), exact.begin(), exact.end(), result.begin());
+      benchmark::do_not_optimize(result.front());
+    }, repetitions);
+
+    benchmark::report(name.str() + "exact x, operator chain", operatorsExact, numElements);
+    benchmark::report(name.str() + "exact x, evaluate_polynomial", hornerExact, numElements);
+    BOOST_TEST_MESSAGE("  speedup: " << operatorsExact / hornerExact);
+
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      BOOST_REQUIRE_CLOSE(result[i].GetValue(), reference[i].GetValue(), 1e-10);
+      BOOST_REQUIRE_CLOSE(result[i].GetError(), reference[i].GetError(), 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_Polynomial
@@ -0,0 +1,102 @@
+#include "QuantizedErrorArray.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<float> VF;
+
+  /// Large enough to exceed the caches
+  const std::size_t numElements = 1 << 22;
+  const std::size_t repetitions = 20;
+
+  /// Sum of the values and of the squared errors, decoding block by block
+  template<typename Array>
+  VF quadrature_sum(const Array& array)
+  {
+    std::array<float, Array::BlockSize()> errors;
+    const std::vector<float>& values = array.GetValues();
+
+    float sum = 0.0f, variance = 0.0f;
+    for(std::size_t first = 0; first < array.size(); first += Array::BlockSize())
+    {
+      const std::size_t last = std::min(first + Array::BlockSize(), array.size());
+      array.DecodeErrors(first, last, errors.data());
+
+      for(std::size_t i = first; i < last; i++)
+      {
+        sum += values[i];
+        variance += errors[i - first] * errors[i - first];
+      }
+    }
+
+    return VF(sum, std::sqrt(variance));
+  }
+
+  /// Same with the errors stored as float
+  VF quadrature_sum(const std::vector<float>& values, const std::vector<float>& errors)
+  {
+    float sum = 0.0f, variance = 0.0f;
+    for(std::size_t i = 0; i < values.size(); i++)
+    {
+      sum += values[i];
+      variance += errors[i] * errors[i];
+    }
+
+    return VF(sum, std::sqrt(variance));
+  }
+
+  template<typename Encoding>
+  void run(const std::string& name, const std::vector<float>& values, const std::vector<float>& errors, const VF& reference,
+           double precision)
+  {
+    typedef QuantizedErrorArray<float, Encoding> Array;
+    const Array array(values, errors);
+
+    VF result;
+    const double time = benchmark::time_per_call([&]{ result = quadrature_sum(array); benchmark::do_not_optimize(result); }, repetitions);
+
+    benchmark::report(name + ", " + std::to_string(Array::BytesPerElement()) + " bytes/element", time, numElements);
+    BOOST_TEST_MESSAGE("  " << Array::BytesPerElement() * numElements / time << " GB/s, relative deviation of the error "
+                       << std::abs(result.GetError() / reference.GetError() - 1.0f));
+
+    BOOST_REQUIRE_EQUAL(result.GetValue(), reference.GetValue());
+    BOOST_REQUIRE_CLOSE(result.GetError(), reference.GetError(), 100 * precision);
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_QuantizedErrorArray)
+
+BOOST_AUTO_TEST_CASE(streaming_quadrature_sum)
+{
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<float> value(1.0f, 2.0f);
+  std::uniform_real_distribution<float> relative(-3.0f, -1.0f);
+
+  std::vector<float> values(numElements), errors(numElements);
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    values[i] = value(engine);
+    errors[i] = values[i] * std::pow(10.0f, relative(engine));
+  }
+
+  VF reference;
+  const double time = benchmark::time_per_call([&]{ reference = quadrature_sum(values, errors); benchmark::do_not_optimize(reference); }, repetitions);
+  benchmark::report("float errors, 8 bytes/element", time, numElements);
+  BOOST_TEST_MESSAGE("  " << 8.0 * numElements / time << " GB/s");
+
+  run<HalfErrorEncoding>("half errors", values, errors, reference, 1e-3);
+  run<BFloat16ErrorEncoding>("bfloat16 errors", values, errors, reference, 1e-2);
+  run<LogQuantized8ErrorEncoding>("8 bit log-quantized errors", values, errors, reference, 5e-2);
+  run<LogQuantized16ErrorEncoding>("16 bit log-quantized errors", values, errors, reference, 1e-3);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_QuantizedErrorArray
@@ -0,0 +1,74 @@
+#include "RelativeValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  const std::size_t numElements = 1 << 12;
+  const std::size_t numFactors = 8;
+  const std::size_t repetitions = 200;
+
+  /// Alternating products and quotients of all factors, plus scalings
+  template<typename V>
+  V chain(const std::vector<V>& factors, std::size_t i)
+  {
+    V result = factors[i];
+    for(std::size_t k = 1; k < numFactors; k++)
+    {
+      const V& factor = factors[(i + k * numElements / numFactors) % numElements];
+      result = k % 2 ? result * factor : result / factor;
+      result *= 1.5;
+    }
+
+    return result;
+  }
+
+  template<typename V>
+  double time_chain(const std::vector<V>& factors, std::vector<V>& result)
+  {
+    return benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        result[i] = chain(factors, i);
+      }
+      benchmark::do_not_optimize(result.front());
+    }, repetitions);
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_RelativeValueWithError)
+
+BOOST_AUTO_TEST_CASE(product_chain)
+{
+  std::vector<ValueWithError<double> > factors, result(numElements);
+  std::vector<RelativeValueWithError<double> > relativeFactors, relativeResult(numElements);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    factors.push_back(ValueWithError<double>(1.0 + 1e-3 * static_cast<double>(i), 1e-3 + 1e-6 * static_cast<double>(i)));
+    relativeFactors.push_back(RelativeValueWithError<double>(factors.back()));
+  }
+
+  const double absolute = time_chain(factors, result);
+  const double relative = time_chain(relativeFactors, relativeResult);
+
+  BOOST_TEST_MESSAGE(numFactors << " factors and scalings per element");
+  benchmark::report("ValueWithError<double>", absolute, numElements);
+  benchmark::report("RelativeValueWithError<double>", relative, numElements);
+  BOOST_TEST_MESSAGE("speedup: " << absolute / relative);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_CLOSE(relativeResult[i].GetValue(), result[i].GetValue(), 1e-12);
+    BOOST_REQUIRE_CLOSE(relativeResult[i].GetError(), result[i].GetError(), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_RelativeValueWithError
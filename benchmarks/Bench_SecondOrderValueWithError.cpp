@@ -0,0 +1,171 @@
+#include "SecondOrderValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>            VD;
+  typedef SecondOrderValueWithError<double> SD;
+
+  const std::size_t numElements = 1024;
+  const std::size_t repetitions = 200;
+  const std::size_t numReferenceSamples = 4000000;
+
+  /// Mean and standard deviation from Monte Carlo sampling of independent normal arguments
+  template<typename F>
+  VD monte_carlo(F f, const VD& a, const VD& b, std::size_t numSamples, std::mt19937_64& engine)
+  {
+    std::normal_distribution<double> da(a.GetValue(), a.GetError()), db(b.GetValue(), b.GetError());
+
+    // Welford's algorithm
+    double mean = 0.0, m2 = 0.0;
+    for(std::size_t i = 1; i <= numSamples; i++)
+    {
+      const double y = f(da(engine), db(engine));
+      const double delta = y - mean;
+      mean += delta / static_cast<double>(i);
+      m2 += delta * (y - mean);
+    }
+
+    return VD(mean, std::sqrt(m2 / static_cast<double>(numSamples - 1)));
+  }
+
+  /// Times first and second order propagation and the Monte Carlo sample count with the same accuracy of the mean
+  template<typename F>
+  void compare(const std::string& name, F f, const VD& a, const VD& b)
+  {
+    std::mt19937_64 engine(42);
+    const VD truth = monte_carlo(f, a, b, numReferenceSamples, engine);
+
+    // slightly varying inputs, so the compiler can't hoist the computation out of the timing loop
+    std::vector<VD> va, vb, first(numElements);
+    std::vector<SD> sa, sb, second(numElements);
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      const double scale = 1.0 + 1e-6 * static_cast<double>(i);
+      va.push_back(VD(a.GetValue() * scale, a.GetError()));
+      vb.push_back(VD(b.GetValue() * scale, b.GetError()));
+      sa.push_back(SD(va.back()));
+      sb.push_back(SD(vb.back()));
+    }
+
+    const double firstTime = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        first[i] = f(va[i], vb[i]);
+      }
+      benchmark::do_not_optimize(first.front());
+    }, repetitions);
+
+    const double secondTime = benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        second[i] = f(sa[i], sb[i]);
+      }
+      benchmark::do_not_optimize(second.front());
+    }, repetitions);
+
+    const double firstBias = std::abs(first.front().GetValue() - truth.GetValue());
+    const double secondBias = std::abs(second.front().GetValue() - truth.GetValue());
+
+    // the standard error of the Monte Carlo mean is sigma / sqrt(n)
+    const double equalSamples = std::ceil(std::pow(truth.GetError() / secondBias, 2));
+    const std::size_t timedSamples = 10000;
+    VD sampled;
+    const double perSample = benchmark::time_per_call([&]{ sampled = monte_carlo(f, a, b, timedSamples, engine); benchmark::do_not_optimize(sampled); }, 10)
+                             / timedSamples;
+
+    BOOST_TEST_MESSAGE(name << ": mean " << truth.GetValue() << ", std " << truth.GetError()
+                            << ", bias/std first order " << firstBias / truth.GetError()
+                            << ", second order " << secondBias / truth.GetError()
+                            << ", std first order " << first.front().GetError() << ", second order " << second.front().GetError());
+    benchmark::report("  first order", firstTime, numElements);
+    benchmark::report("  second order", secondTime, numElements);
+    benchmark::report("  Monte Carlo with " + std::to_string(static_cast<long long>(equalSamples)) + " samples",
+                      perSample * equalSamples, static_cast<std::size_t>(equalSamples));
+    BOOST_TEST_MESSAGE("  speedup second order vs. Monte Carlo of equal accuracy: "
+                       << perSample * equalSamples / (secondTime / numElements));
+
+    BOOST_REQUIRE_LT(secondBias, firstBias);
+    BOOST_REQUIRE_LT(std::abs(second.front().GetError() - truth.GetError()), std::abs(first.front().GetError() - truth.GetError()) + 1e-3 * truth.GetError());
+  }
+
+  /// Test functions, the arguments have relative errors of 10% to 30%
+  struct Exp
+  {
+    template<typename T>
+    T operator()(const T& a, const T& /* b */) const
+    {
+      return exp(a);
+    }
+  };
+
+  struct Inverse
+  {
+    template<typename T>
+    T operator()(const T& a, const T& /* b */) const
+    {
+      return 1.0 / a;
+    }
+  };
+
+  struct Log
+  {
+    template<typename T>
+    T operator()(const T& a, const T& /* b */) const
+    {
+      return log(a);
+    }
+  };
+
+  struct Tgamma
+  {
+    template<typename T>
+    T operator()(const T& a, const T& /* b */) const
+    {
+      return tgamma(a);
+    }
+  };
+
+  struct Pow
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return pow(a, b);
+    }
+  };
+
+  struct Damped
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return a * exp(-1.0 * b);
+    }
+  };
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_SecondOrderValueWithError)
+
+BOOST_AUTO_TEST_CASE(versus_monte_carlo)
+{
+  compare("exp(x), x = 1 +- 0.3", Exp(), VD(1.0, 0.3), VD(1.0, 0.0));
+  compare("1 / x, x = 2 +- 0.3", Inverse(), VD(2.0, 0.3), VD(1.0, 0.0));
+  compare("log(x), x = 1 +- 0.15", Log(), VD(1.0, 0.15), VD(1.0, 0.0));
+  compare("tgamma(x), x = 3 +- 0.3", Tgamma(), VD(3.0, 0.3), VD(1.0, 0.0));
+  compare("pow(x, y), x = 2 +- 0.3, y = 1.5 +- 0.15", Pow(), VD(2.0, 0.3), VD(1.5, 0.15));
+  compare("x exp(-y), x = 1 +- 0.1, y = 1 +- 0.3", Damped(), VD(1.0, 0.1), VD(1.0, 0.3));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_SecondOrderValueWithError
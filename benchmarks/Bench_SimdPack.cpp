@@ -0,0 +1,116 @@
+#include "SimdPack.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 200;
+
+  /// Only arithmetic operators, these are vectorized for packs
+  struct Arithmetic
+  {
+    static const char* Name()
+    {
+      return "a*b + a/b - b";
+    }
+
+    template<typename V>
+    static V Apply(const V& a, const V& b)
+    {
+      return a * b + a / b - b;
+    }
+  };
+
+  /// Math functions, these call the scalar functions for each lane
+  struct MathFunctions
+  {
+    static const char* Name()
+    {
+      return "exp(a)*b + sqrt(b)";
+    }
+
+    template<typename V>
+    static V Apply(const V& a, const V& b)
+    {
+      return exp(a) * b + sqrt(b);
+    }
+  };
+
+  template<typename K, typename V>
+  double run(const std::vector<V>& a, const std::vector<V>& b, std::vector<V>& y)
+  {
+    y.resize(a.size());
+
+    return benchmark::time_per_call([&]
+    {
+      for(std::size_t i = 0; i < a.size(); i++)
+      {
+        y[i] = K::Apply(a[i], b[i]);
+      }
+      benchmark::do_not_optimize(y.front());
+    }, repetitions);
+  }
+
+  /// numElements ValueWithError<double> against numElements / W ValueWithError<SimdPack<double, W> >
+  template<typename K, std::size_t W>
+  void compare(const std::vector<VD>& a, const std::vector<VD>& b)
+  {
+    std::vector<VD> y;
+    const double scalar = run<K>(a, b, y);
+
+    std::vector<ValueWithError<SimdPack<double, W> > > pa = pack_lanes<W>(a), pb = pack_lanes<W>(b), py;
+    const double packed = run<K>(pa, pb, py);
+
+    std::stringstream name;
+    name << K::Name() << ", W = " << W << ", ";
+    benchmark::report(name.str() + "ValueWithError<double>", scalar, numElements);
+    benchmark::report(name.str() + "ValueWithError<SimdPack>", packed, numElements);
+    BOOST_TEST_MESSAGE("  speedup: " << scalar / packed);
+
+    const std::vector<VD> unpacked = unpack_lanes(py, numElements);
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      BOOST_REQUIRE_EQUAL(unpacked[i].GetValue(), y[i].GetValue());
+      BOOST_REQUIRE_CLOSE(unpacked[i].GetError(), y[i].GetError(), 1e-12);
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_SimdPack)
+
+BOOST_AUTO_TEST_CASE(lanes)
+{
+  std::vector<VD> a, b;
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    a.push_back(VD(0.5 + 1e-4 * static_cast<double>(i), 0.01));
+    b.push_back(VD(2.0 - 1e-4 * static_cast<double>(i), 0.02));
+  }
+
+  compare<Arithmetic, 2>(a, b);
+  compare<Arithmetic, 4>(a, b);
+  compare<Arithmetic, 8>(a, b);
+  compare<MathFunctions, 4>(a, b);
+  compare<MathFunctions, 8>(a, b);
+
+  // conversion overhead
+  std::vector<ValueWithError<SimdPack<double, 4> > > packs;
+  const double conversion = benchmark::time_per_call([&]
+  {
+    packs = pack_lanes<4>(a);
+    benchmark::do_not_optimize(unpack_lanes(packs, numElements).front());
+  }, repetitions);
+  benchmark::report("pack_lanes<4> and unpack_lanes", conversion, numElements);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_SimdPack
@@ -0,0 +1,95 @@
+#include "SparseErrorArray.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <sstream>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>   VD;
+  typedef SparseErrorArray<double> SA;
+
+  const std::size_t numElements = 4096;
+  const std::size_t repetitions = 500;
+
+  /// Dataset where every n-th element carries an error, everything else is exact
+  std::vector<VD> CreateDataset(std::size_t n, double offset)
+  {
+    std::vector<VD> data(numElements);
+
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      const double val = offset + static_cast<double>(i) / numElements;
+      data[i] = (n > 0 && i % n == 0) ? VD(val, 0.01) : VD(val);
+    }
+
+    return data;
+  }
+
+  void dense_kernel(const std::vector<VD>& a, const std::vector<VD>& b, std::vector<VD>& c)
+  {
+    for(std::size_t i = 0; i < a.size(); i++)
+    {
+      c[i] = (a[i] * b[i] + a[i]) / b[i] - 2.0;
+    }
+  }
+
+  SA sparse_kernel(const SA& a, const SA& b)
+  {
+    return (a * b + a) / b - 2.0;
+  }
+
+  void run(std::size_t n, const char* label)
+  {
+    const std::vector<VD> denseA = CreateDataset(n, 1.0), denseB = CreateDataset(n, 2.0);
+    const SA a(denseA), b(denseB);
+    std::vector<VD> denseC(numElements);
+    SA c;
+
+    const double dense = benchmark::time_per_call([&]{ dense_kernel(denseA, denseB, denseC); benchmark::do_not_optimize(denseC.front()); }, repetitions);
+    const double sparse = benchmark::time_per_call([&]{ c = sparse_kernel(a, b); benchmark::do_not_optimize(c.GetValues().front()); }, repetitions);
+
+    std::stringstream sstr;
+    sstr << label << " exact, dense";
+    benchmark::report(sstr.str(), dense, numElements);
+    sstr.str("");
+    sstr << label << " exact, sparse";
+    benchmark::report(sstr.str(), sparse, numElements);
+    BOOST_TEST_MESSAGE("speedup sparse vs. dense: " << dense / sparse);
+
+    const std::vector<VD> result = c.ToDense();
+    for(std::size_t i = 0; i < numElements; i++)
+    {
+      BOOST_REQUIRE_EQUAL(result[i].GetValue(), denseC[i].GetValue());
+      BOOST_REQUIRE_EQUAL(result[i].GetError(), denseC[i].GetError());
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Bench_SparseErrorArray)
+
+BOOST_AUTO_TEST_CASE(sparsity_0)
+{
+  run(1, "0%");
+}
+
+BOOST_AUTO_TEST_CASE(sparsity_50)
+{
+  run(2, "50%");
+}
+
+BOOST_AUTO_TEST_CASE(sparsity_90)
+{
+  run(10, "90%");
+}
+
+BOOST_AUTO_TEST_CASE(sparsity_99)
+{
+  run(100, "99%");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_SparseErrorArray
@@ -0,0 +1,192 @@
+#include "SumAccumulator.hpp"
+#include "ThreadPool.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <execution>
+#endif
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef SumAccumulator<double> AD;
+
+  const std::size_t numElements = 1 << 20;
+  const std::size_t repetitions = 10;
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        terms.push_back(VD(1.0 + 1e-3 * static_cast<double>(i % 1000), 0.01 + 1e-4 * static_cast<double>(i % 100)));
+      }
+
+      VD sum(0.0, 0.0);
+      serial = benchmark::time_per_call([&]
+      {
+        sum = VD(0.0, 0.0);
+        for(const VD& term : terms)
+        {
+          sum = sum + term;
+        }
+        benchmark::do_not_optimize(sum);
+      }, repetitions);
+
+      reference = sum;
+    }
+
+    /// Reports the time of a reduction relative to chained operator+ and checks its result
+    void compare(const std::string& name, double time, const AD& sum)
+    {
+      benchmark::report(name, time, numElements);
+      BOOST_TEST_MESSAGE("  speedup vs. operator+: " << serial / time);
+      BOOST_REQUIRE_CLOSE(sum.Result().GetValue(), reference.GetValue(), 1e-9);
+      BOOST_REQUIRE_CLOSE(sum.Result().GetError(), reference.GetError(), 1e-9);
+    }
+
+    std::vector<VD> terms;
+    VD reference;
+    double serial;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_SumAccumulator,Fixture)
+
+BOOST_AUTO_TEST_CASE(serial_accumulation)
+{
+  benchmark::report("operator+", serial, numElements);
+
+  AD sum;
+  const double accumulated = benchmark::time_per_call([&]
+  {
+    sum = std::accumulate(terms.begin(), terms.end(), AD(), SumReduction<double>());
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+  compare("SumAccumulator, std::accumulate", accumulated, sum);
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool)
+{
+  ThreadPool pool;
+  const std::size_t grain = numElements / (8 * pool.size());
+  std::vector<AD> partial((numElements - 1) / grain + 1);
+
+  AD sum;
+  const double time = benchmark::time_per_call([&]
+  {
+    pool.ParallelFor(numElements, grain, [&](std::size_t begin, std::size_t end)
+    {
+      partial[begin / grain] = std::accumulate(terms.begin() + begin, terms.begin() + end, AD(), SumReduction<double>());
+    });
+    sum = std::accumulate(partial.begin(), partial.end(), AD());
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+  compare("SumAccumulator, ThreadPool::ParallelFor, " + std::to_string(pool.size()) + " threads", time, sum);
+}
+
+BOOST_AUTO_TEST_CASE(summation_modes)
+{
+  typedef SumAccumulator<double, ExactValueAndIgnoreErrorPolicy, CompensatedSummation>  CompensatedAD;
+  typedef SumAccumulator<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> ReproducibleAD;
+
+  AD plain;
+  const double plainTime = benchmark::time_per_call([&]
+  {
+    plain = std::accumulate(terms.begin(), terms.end(), AD(), SumReduction<double>());
+    benchmark::do_not_optimize(plain);
+  }, repetitions);
+  compare("PlainSummation", plainTime, plain);
+
+  CompensatedAD compensated;
+  const double compensatedTime = benchmark::time_per_call([&]
+  {
+    compensated = std::accumulate(terms.begin(), terms.end(), CompensatedAD(),
+                                  SumReduction<double, ExactValueAndIgnoreErrorPolicy, CompensatedSummation>());
+    benchmark::do_not_optimize(compensated);
+  }, repetitions);
+  benchmark::report("CompensatedSummation", compensatedTime, numElements);
+  BOOST_TEST_MESSAGE("  cost relative to PlainSummation: " << compensatedTime / plainTime);
+
+  ReproducibleAD reproducible;
+  const double reproducibleTime = benchmark::time_per_call([&]
+  {
+    reproducible = std::accumulate(terms.begin(), terms.end(), ReproducibleAD(),
+                                   SumReduction<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation>());
+    benchmark::do_not_optimize(reproducible);
+  }, repetitions);
+  benchmark::report("ReproducibleSummation", reproducibleTime, numElements);
+  BOOST_TEST_MESSAGE("  cost relative to PlainSummation: " << reproducibleTime / plainTime);
+
+  // std::accumulate copies the accumulator per term, which dominates for the larger binned sums
+  ReproducibleAD inPlace;
+  const double inPlaceTime = benchmark::time_per_call([&]
+  {
+    inPlace = ReproducibleAD();
+    for(const VD& term : terms)
+    {
+      inPlace += term;
+    }
+    benchmark::do_not_optimize(inPlace);
+  }, repetitions);
+  benchmark::report("ReproducibleSummation, operator+=", inPlaceTime, numElements);
+  BOOST_TEST_MESSAGE("  cost relative to PlainSummation: " << inPlaceTime / plainTime);
+  BOOST_REQUIRE_EQUAL(inPlace.GetValue(), reproducible.GetValue());
+
+  // the correctly rounded sum is the reference for the accuracy of the others
+  const VD exact = reproducible.Result();
+  BOOST_TEST_MESSAGE("relative error of the value, plain: " << std::abs(plain.GetValue() / exact.GetValue() - 1.0)
+                     << ", compensated: " << std::abs(compensated.GetValue() / exact.GetValue() - 1.0));
+  BOOST_TEST_MESSAGE("relative error of the error, plain: " << std::abs(plain.Result().GetError() / exact.GetError() - 1.0)
+                     << ", compensated: " << std::abs(compensated.Result().GetError() / exact.GetError() - 1.0));
+  BOOST_REQUIRE_CLOSE(compensated.GetValue(), exact.GetValue(), 1e-13);
+  BOOST_REQUIRE_CLOSE(compensated.Result().GetError(), exact.GetError(), 1e-13);
+}
+
+#ifdef __cpp_lib_parallel_algorithm
+BOOST_AUTO_TEST_CASE(execution_policies)
+{
+  AD sum;
+
+  const double sequenced = benchmark::time_per_call([&]
+  {
+    sum = std::reduce(std::execution::seq, terms.begin(), terms.end(), AD(), SumReduction<double>());
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+  compare("SumAccumulator, std::reduce(seq)", sequenced, sum);
+
+  const double parallel = benchmark::time_per_call([&]
+  {
+    sum = std::reduce(std::execution::par, terms.begin(), terms.end(), AD(), SumReduction<double>());
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+  compare("SumAccumulator, std::reduce(par)", parallel, sum);
+
+  const double unsequenced = benchmark::time_per_call([&]
+  {
+    sum = std::reduce(std::execution::par_unseq, terms.begin(), terms.end(), AD(), SumReduction<double>());
+    benchmark::do_not_optimize(sum);
+  }, repetitions);
+  compare("SumAccumulator, std::reduce(par_unseq)", unsequenced, sum);
+
+  VD chained(0.0, 0.0);
+  const double chainedParallel = benchmark::time_per_call([&]
+  {
+    chained = std::reduce(std::execution::par_unseq, terms.begin(), terms.end(), VD(0.0, 0.0));
+    benchmark::do_not_optimize(chained);
+  }, repetitions);
+  benchmark::report("operator+, std::reduce(par_unseq)", chainedParallel, numElements);
+  BOOST_TEST_MESSAGE("  speedup vs. operator+: " << serial / chainedParallel);
+}
+#endif // __cpp_lib_parallel_algorithm
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_SumAccumulator
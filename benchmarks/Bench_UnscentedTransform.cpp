@@ -0,0 +1,143 @@
+#include "UnscentedTransform.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>     VD;
+  typedef UnscentedTransform<double> Transform;
+
+  const std::size_t repetitions = 20000;
+  const std::size_t numReferenceSamples = 4000000;
+
+  /// Every argument appears only once, so the linear overloads are exact to first order
+  struct Formula
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b, const T& c) const
+    {
+      return exp(a) * sin(b) / (1.0 + pow(c, 2.0));
+    }
+  };
+
+  /// Stand-in for an expensive routine: trapezoidal integral of a damped oscillation
+  double expensive(double damping, double frequency, double length)
+  {
+    const std::size_t numSteps = 2000;
+    const double dx = length / numSteps;
+
+    double sum = 0.0;
+    for(std::size_t i = 0; i <= numSteps; i++)
+    {
+      const double x = dx * static_cast<double>(i);
+      const double weight = (i == 0 || i == numSteps) ? 0.5 : 1.0;
+      sum += weight * std::exp(-damping * x) * std::cos(frequency * x);
+    }
+
+    return sum * dx;
+  }
+
+  template<typename F>
+  VD monte_carlo(F f, const VD& a, const VD& b, const VD& c, std::size_t numSamples, std::mt19937_64& engine)
+  {
+    std::normal_distribution<double> da(a.GetValue(), a.GetError()), db(b.GetValue(), b.GetError()),
+                                     dc(c.GetValue(), c.GetError());
+
+    // Welford's algorithm
+    double mean = 0.0, m2 = 0.0;
+    for(std::size_t i = 1; i <= numSamples; i++)
+    {
+      const double y = f(da(engine), db(engine), dc(engine));
+      const double delta = y - mean;
+      mean += delta / static_cast<double>(i);
+      m2 += delta * (y - mean);
+    }
+
+    return VD(mean, std::sqrt(m2 / static_cast<double>(numSamples - 1)));
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      a(0.5, 0.2),
+      b(1.0, 0.3),
+      c(0.5, 0.25)
+    {}
+
+    const VD a, b, c;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_UnscentedTransform,Fixture)
+
+BOOST_AUTO_TEST_CASE(versus_linear_and_monte_carlo)
+{
+  const Formula f;
+  Transform transform;
+
+  std::mt19937_64 engine(42);
+  const VD truth = monte_carlo(f, a, b, c, numReferenceSamples, engine);
+
+  VD linear, unscented;
+  const double linearTime = benchmark::time_per_call([&]{ linear = f(a, b, c); benchmark::do_not_optimize(linear); }, repetitions);
+  const double unscentedTime = benchmark::time_per_call([&]{ unscented = transform.Propagate(f, a, b, c); benchmark::do_not_optimize(unscented); }, repetitions);
+
+  const double linearBias = std::abs(linear.GetValue() - truth.GetValue());
+  const double unscentedBias = std::abs(unscented.GetValue() - truth.GetValue());
+
+  // the standard error of the Monte Carlo mean is sigma / sqrt(n)
+  const double equalSamples = std::ceil(std::pow(truth.GetError() / unscentedBias, 2));
+  const std::size_t timedSamples = 10000;
+  VD sampled;
+  const double perSample = benchmark::time_per_call([&]{ sampled = monte_carlo(f, a, b, c, timedSamples, engine); benchmark::do_not_optimize(sampled); }, 10)
+                           / timedSamples;
+
+  BOOST_TEST_MESSAGE("Monte Carlo reference:  " << truth);
+  BOOST_TEST_MESSAGE("linear overloads:       " << linear << ", bias/std " << linearBias / truth.GetError());
+  BOOST_TEST_MESSAGE("unscented transform:    " << unscented << ", bias/std " << unscentedBias / truth.GetError()
+                     << ", " << Transform::NumSigmaPoints(3) << " evaluations");
+  benchmark::report("linear overloads", linearTime);
+  benchmark::report("unscented transform", unscentedTime);
+  benchmark::report("Monte Carlo with " + std::to_string(static_cast<long long>(equalSamples)) + " samples",
+                    perSample * equalSamples, static_cast<std::size_t>(equalSamples));
+  BOOST_TEST_MESSAGE("speedup unscented transform vs. Monte Carlo of equal accuracy: " << perSample * equalSamples / unscentedTime);
+
+  BOOST_REQUIRE_LT(unscentedBias, linearBias);
+  BOOST_REQUIRE_LT(std::abs(unscented.GetError() - truth.GetError()), std::abs(linear.GetError() - truth.GetError()));
+}
+
+BOOST_AUTO_TEST_CASE(parallel_sigma_points)
+{
+  const VD damping(0.5, 0.05), frequency(2.0, 0.1), length(3.0, 0.01);
+
+  Transform serial;
+  VD reference;
+  const double serialTime = benchmark::time_per_call([&]{ reference = serial.Propagate(expensive, damping, frequency, length); }, 200);
+  benchmark::report("expensive function, serial", serialTime);
+
+  const std::size_t numThreads[] = { 2, 4, 7 };
+  for(std::size_t n : numThreads)
+  {
+    ThreadPool pool(n);
+    Transform parallel(&pool);
+    VD result;
+
+    const double elapsed = benchmark::time_per_call([&]{ result = parallel.Propagate(expensive, damping, frequency, length); }, 200);
+    benchmark::report("expensive function, " + std::to_string(n) + " threads", elapsed);
+    BOOST_TEST_MESSAGE("speedup: " << serialTime / elapsed);
+    BOOST_REQUIRE_EQUAL(result.GetValue(), reference.GetValue());
+    BOOST_REQUIRE_EQUAL(result.GetError(), reference.GetError());
+  }
+
+  BOOST_TEST_MESSAGE("hardware threads: " << ThreadPool::DefaultNumThreads());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_UnscentedTransform
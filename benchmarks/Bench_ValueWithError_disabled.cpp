@@ -0,0 +1,94 @@
+#define DISABLE_ERROR_PROPAGATION
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "benchmark.hpp"
+
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  const std::size_t numElements  = 4096;
+  const std::size_t repetitions  = 2000;
+
+  /// Kernel mixing arithmetic operators and math overloads, instantiated for double and ValueWithError<double>
+  template<typename T>
+  void kernel(const std::vector<T>& x, std::vector<T>& y)
+  {
+    using std::exp;
+    using std::sin;
+    using std::sqrt;
+
+    for(std::size_t i = 0; i < x.size(); i++)
+    {
+      y[i] = exp(sin(x[i]) * 0.5) * x[i] + x[i] * x[i] / (1.0 + sqrt(x[i]));
+    }
+  }
+
+  /// Kernel with only arithmetic operators, this one is vectorized by the compiler for plain double
+  template<typename T>
+  void axpy(const std::vector<T>& x, std::vector<T>& y)
+  {
+    for(std::size_t i = 0; i < x.size(); i++)
+    {
+      y[i] = 2.5 * x[i] + y[i];
+    }
+  }
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      for(std::size_t i = 0; i < numElements; i++)
+      {
+        const double val = 0.1 + static_cast<double>(i) / numElements;
+        xd.push_back(val);
+        xv.push_back(VD(val, 0.1));
+      }
+
+      yd.resize(numElements);
+      yv.resize(numElements);
+    }
+
+    std::vector<double> xd, yd;
+    std::vector<VD> xv, yv;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Bench_ValueWithError_disabled,Fixture)
+
+BOOST_AUTO_TEST_CASE(math_kernel)
+{
+  const double plain = benchmark::time_per_call([&]{ kernel(xd, yd); benchmark::do_not_optimize(yd.front()); }, repetitions);
+  const double disabled = benchmark::time_per_call([&]{ kernel(xv, yv); benchmark::do_not_optimize(yv.front()); }, repetitions);
+
+  benchmark::report("math kernel, double", plain, numElements);
+  benchmark::report("math kernel, ValueWithError<double> disabled", disabled, numElements);
+  BOOST_TEST_MESSAGE("ratio disabled/double: " << disabled / plain);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_EQUAL(yv[i].GetValue(), yd[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(axpy_kernel)
+{
+  const double plain = benchmark::time_per_call([&]{ axpy(xd, yd); benchmark::do_not_optimize(yd.front()); }, repetitions);
+  const double disabled = benchmark::time_per_call([&]{ axpy(xv, yv); benchmark::do_not_optimize(yv.front()); }, repetitions);
+
+  benchmark::report("axpy, double", plain, numElements);
+  benchmark::report("axpy, ValueWithError<double> disabled", disabled, numElements);
+  BOOST_TEST_MESSAGE("ratio disabled/double: " << disabled / plain);
+
+  for(std::size_t i = 0; i < numElements; i++)
+  {
+    BOOST_REQUIRE_EQUAL(yv[i].GetValue(), yd[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bench_ValueWithError_disabled
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <boost/timer/timer.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <iomanip>
+#include <string>
+
+/// Helpers for the benchmarks, every benchmark is a test case which reports its timings with BOOST_TEST_MESSAGE
+/// and checks that the benchmarked variants agree. Run them with "make benchmark".
+namespace benchmark {
+
+  /// Prevents the compiler from optimizing away the computation of value
+  template<typename T>
+  inline void do_not_optimize(const T& value)
+  {
+#if defined __GNUC__ || defined __clang__
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  /// Returns the wall clock time in nanoseconds per call of f, f is called once for warm up and then repetitions times
+  template<typename F>
+  double time_per_call(F f, std::size_t repetitions)
+  {
+    f();
+
+    boost::timer::cpu_timer timer;
+    for(std::size_t i = 0; i < repetitions; i++)
+    {
+      f();
+    }
+
+    return static_cast<double>(timer.elapsed().wall) / static_cast<double>(repetitions);
+  }
+
+  /// Reports the time per call and optionally the time per element
+  inline void report(const std::string& name, double nanoseconds, std::size_t elements = 1)
+  {
+    BOOST_TEST_MESSAGE(std::left << std::setw(56) << name << std::right
+                       << std::setw(14) << std::fixed << std::setprecision(1) << nanoseconds << " ns/call"
+                       << std::setw(12) << std::setprecision(3) << nanoseconds / static_cast<double>(elements) << " ns/element");
+  }
+
+} // namespace benchmark
@@ -0,0 +1,18 @@
+#include "precompiled.hpp"
+
+#define BOOST_TEST_MODULE "C++ Benchmarks for ValueWithError"
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
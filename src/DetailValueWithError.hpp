@@ -1,6 +1,7 @@
 #ifndef DETAIL_VALUE_WITH_ERROR_HPP
 #define DETAIL_VALUE_WITH_ERROR_HPP
 
+#include <cassert>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
@@ -75,10 +76,219 @@ namespace error_propagation {
       return hypot_impl<T, U, boost::has_less<T,U,bool>::value>()(a,b);
     }
 
+    // Element-wise formula for types without std::less, e.g. std::valarray
+    template<typename T, typename U, bool has_less_op>
+    struct max_abs_impl;
+
+    template<typename T, typename U>
+    struct max_abs_impl<T, U, false>
+    {
+      CONSTEXPR typename promote_args<T, U>::type
+      operator()(const T& a, const U& b) const
+      {
+        using std::abs;
+        return (abs(a) + abs(b) + abs(abs(a) - abs(b))) / 2;
+      }
+    };
+
+    template<typename T, typename U>
+    struct max_abs_impl<T, U, true>
+    {
+      CONSTEXPR typename promote_args<T, U>::type
+      operator()(const T& a, const U& b) const
+      {
+        using std::abs;
+        typedef typename promote_args<T, U>::type R;
+        return abs(a) < abs(b) ? R(abs(b)) : R(abs(a));
+      }
+    };
+
+    template<typename T, typename U>
+    CONSTEXPR typename promote_args<T,U>::type
+    max_abs(const T& a, const U& b)
+    {
+      return max_abs_impl<T, U, boost::has_less<T,U,bool>::value>()(a,b);
+    }
+
+    // Specialized for types which boost::math::digamma does not support, e.g. SimdPack
+    template<typename T>
+    struct digamma_impl
+    {
+      T operator()(const T& a) const
+      {
+        return boost::math::digamma(a,policy_errno_on_error());
+      }
+    };
+
     template<typename T>
     CONSTEXPR T digamma(const T& a)
     {
-      return boost::math::digamma(a,policy_errno_on_error());
+      return digamma_impl<T>()(a);
+    }
+
+    // a * b + c, fused for the builtin types if the target has a fast fma (FP_FAST_FMA, e.g. with -mfma)
+    template<typename T>
+    CONSTEXPR T multiply_add(const T& a, const T& b, const T& c)
+    {
+      return a * b + c;
+    }
+
+#if __cplusplus >= 201103L
+#ifdef FP_FAST_FMAF
+    inline float multiply_add(float a, float b, float c)
+    {
+      return std::fma(a, b, c);
+    }
+#endif // FP_FAST_FMAF
+
+#ifdef FP_FAST_FMA
+    inline double multiply_add(double a, double b, double c)
+    {
+      return std::fma(a, b, c);
+    }
+#endif // FP_FAST_FMA
+
+#ifdef FP_FAST_FMAL
+    inline long double multiply_add(long double a, long double b, long double c)
+    {
+      return std::fma(a, b, c);
+    }
+#endif // FP_FAST_FMAL
+#endif // __cplusplus >= 201103L
+
+    // x^n for n >= 1 by binary exponentiation
+    template<typename T>
+    T integer_power(const T& x, unsigned int n)
+    {
+      assert(n >= 1);
+
+      T base = x;
+      for(; n % 2 == 0; n /= 2)
+      {
+        base = base * base;
+      }
+
+      T result = base;
+      while((n /= 2) > 0)
+      {
+        base = base * base;
+        if(n % 2 == 1)
+        {
+          result = result * base;
+        }
+      }
+
+      return result;
+    }
+
+    // x^N for N >= 1 by repeated squaring, unrolled at compile time
+    template<typename T, int N, bool odd = N % 2 == 1>
+    struct static_power
+    {
+      static T apply(const T& x)
+      {
+        return static_power<T, N / 2>::apply(x * x);
+      }
+    };
+
+    template<typename T, int N>
+    struct static_power<T, N, true>
+    {
+      static T apply(const T& x)
+      {
+        return static_power<T, N - 1>::apply(x) * x;
+      }
+    };
+
+    template<typename T>
+    struct static_power<T, 1, true>
+    {
+      static T apply(const T& x)
+      {
+        return x;
+      }
+    };
+
+    // Value of x^N and the propagated error N*x^(N-1)*e with multiplications only, separately for N < 0, N == 0,
+    // N == 1 and N > 1. The error for N == 0 is zero, also for x == 0.
+    template<typename T, int N, int Case = (N < 0 ? -1 : (N < 2 ? N : 2))>
+    struct power_with_error
+    {
+      static T apply(const T& x, const T& e, T& error)
+      {
+        const T p = static_power<T, N - 1>::apply(x);
+        error = N * p * e;
+        return p * x;
+      }
+    };
+
+    template<typename T, int N>
+    struct power_with_error<T, N, 1>
+    {
+      static T apply(const T& x, const T& e, T& error)
+      {
+        error = e;
+        return x;
+      }
+    };
+
+    template<typename T, int N>
+    struct power_with_error<T, N, 0>
+    {
+      static T apply(const T& x, const T& e, T& error)
+      {
+        using std::pow;
+        error = 0 * e;
+        return pow(x, 0);
+      }
+    };
+
+    template<typename T, int N>
+    struct power_with_error<T, N, -1>
+    {
+      static T apply(const T& x, const T& e, T& error)
+      {
+        // the value is the reciprocal of x^-N like std::pow, N x^(N-1) e as N x^N (e/x) doesn't overflow in x^(1-N)
+        const T r = 1 / static_power<T, -N>::apply(x);
+        error = N * r * (e / x);
+        return r;
+      }
+    };
+
+    // Runtime variant of power_with_error
+    template<typename T>
+    T power_with_error_n(const T& x, int n, const T& e, T& error)
+    {
+      using std::pow;
+      if(n > 1)
+      {
+        const T p = integer_power(x, static_cast<unsigned int>(n - 1));
+        error = n * p * e;
+        return p * x;
+      }
+
+      if(n == 1)
+      {
+        error = e;
+        return x;
+      }
+
+      if(n == 0)
+      {
+        error = 0 * e;
+        return pow(x, 0);
+      }
+
+      const T r = 1 / integer_power(x, 0u - static_cast<unsigned int>(n));
+      error = n * r * (e / x);
+      return r;
+    }
+
+    // Value of arguments which may or may not carry an error, overloaded for ValueWithError
+    template<typename T>
+    CONSTEXPR const T& value_of(const T& a)
+    {
+      return a;
     }
 
   } // namespace detail
@@ -0,0 +1,951 @@
+#ifndef DISABLED_VALUE_WITH_ERROR_HPP
+#define DISABLED_VALUE_WITH_ERROR_HPP
+
+#include <iterator>
+
+#include "DetailValueWithError.hpp"
+#include "ValueWithErrorComparisonPolicy.hpp"
+
+/// Value only variant of ValueWithError, selected by defining DISABLE_ERROR_PROPAGATION before including ValueWithError.hpp.
+///
+/// The interface is the same as in ../cpp11/ValueWithError.hpp but the error is neither stored nor computed,
+/// GetError() always returns T(). Every operator and mathematical function overload only performs the operation on the value
+/// so that the generated code is identical to the code for a plain T.
+namespace error_propagation {
+
+  BEGIN_VALUE_WITH_ERROR_NAMESPACE
+
+  template<typename T, typename P>
+  void swap(ValueWithError<T, P>& lhs, ValueWithError<T, P>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  template<typename T, typename P>
+  class ValueWithError
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+
+    ///@name Constructor
+    ///@{
+    CONSTEXPR explicit ValueWithError(const T& value, const T& /* error */)
+      :
+      m_value(value)
+    {}
+
+    CONSTEXPR explicit ValueWithError(const T& value)
+      :
+      m_value(value)
+    {}
+
+    CONSTEXPR ValueWithError()
+      :
+      m_value()
+    {}
+
+#if __cplusplus >= 201103L
+    /// All list elements except the first one are silently skipped
+    CONSTEXPR ValueWithError(std::initializer_list<T> list)
+      :
+      m_value(list.size() > 0 ? list.begin()[0] : T())
+    {}
+#endif // __cplusplus >= 201103L
+
+    template<typename U>
+    CONSTEXPR ValueWithError(const ValueWithError<U, P>& rhs)
+      :
+      m_value(rhs.GetValue())
+    {}
+    ///@}
+
+    ///@name Copy assignment
+    ///@{
+    template<typename U>
+    ValueWithError<T, P>& operator=(const ValueWithError<U, P>& rhs)
+    {
+      this->m_value = rhs.GetValue();
+
+      return *this;
+    }
+
+    template<typename U>
+    ValueWithError<T, P>& operator=(const U& other)
+    {
+      this->m_value = other;
+
+      return *this;
+    }
+
+#if __cplusplus >= 201103L
+    /// All list elements except the first one are silently skipped
+    template<typename U>
+    ValueWithError<T, P>& operator=(std::initializer_list<U> list)
+    {
+      m_value = list.size() > 0 ? list.begin()[0] : T();
+
+      return *this;
+    }
+#endif // __cplusplus >= 201103L
+    ///@}
+
+    ///@name Getters
+    ///@{
+    CONSTEXPR inline const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    /// Always returns a default constructed T, this is also the error of ValueWithError(value) in the non-disabled variant
+    CONSTEXPR inline T GetError() const
+    {
+      return T();
+    }
+    ///@}
+
+    ///@name Arithmetic operators
+    ///@{
+    template<typename U>
+    ValueWithError<T, P>&
+    operator*=(const U& rhs)
+    {
+      *this = (*this) * rhs;
+      return *this;
+    }
+
+    template<typename U>
+    ValueWithError<T, P>&
+    operator/=(const U& rhs)
+    {
+      *this = (*this) / rhs;
+      return *this;
+    }
+
+    template<typename U>
+    ValueWithError<T, P>&
+    operator+=(const U& rhs)
+    {
+      *this = (*this) + rhs;
+      return *this;
+    }
+
+    template<typename U>
+    ValueWithError<T, P>&
+    operator-=(const U& rhs)
+    {
+      *this = (*this) - rhs;
+      return *this;
+    }
+    ///@}
+
+    void swap(ValueWithError<T, P>& obj)
+    {
+      using std::swap;
+      swap(this->m_value, obj.m_value);
+    }
+
+  private:
+    T m_value;
+  };
+
+  /// Helper function using template argument deduction, the error is ignored
+#if __cplusplus >= 201103L
+  template<typename T, typename U, typename P = DEFAULT_POLICY_CLASS>
+  CONSTEXPR ValueWithError< typename detail::promote_args< typename std::decay<T>::type, typename std::decay<U>::type>::type, P>
+  make_value(T&& value, U&& /* error */)
+  {
+    typedef typename std::decay<T>::type TV;
+    typedef typename std::decay<U>::type UV;
+    typedef typename detail::promote_args<TV, UV>::type R;
+    return ValueWithError<R, P>(std::forward<T>(value));
+  }
+#else
+  template<typename T, typename U>
+  const ValueWithError<typename detail::promote_args<T, U>::type, DEFAULT_POLICY_CLASS>
+  make_value(T value, U /* error */)
+  {
+    typedef typename detail::promote_args<T, U>::type R;
+    return ValueWithError<R, DEFAULT_POLICY_CLASS>(value);
+  }
+#endif // __cplusplus >= 201103L
+
+  ///@name Arithmetic operator definitions
+  ///@{
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator*(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() * rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator*(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() * rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<V, U>::type, P>
+  operator*(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<V, U>::type R;
+    return ValueWithError<R, P>(lhs * rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator/(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() / rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator/(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() / rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<V, U>::type, P>
+  operator/(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<V, U>::type R;
+    return ValueWithError<R, P>(lhs / rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator+(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() + rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator+(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() + rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<V, U>::type, P>
+  operator+(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<V, U>::type R;
+    return ValueWithError<R, P>(lhs + rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator-(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() - rhs.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator-(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(lhs.GetValue() - rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<V, U>::type, P>
+  operator-(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<V, U>::type R;
+    return ValueWithError<R, P>(lhs - rhs.GetValue());
+  }
+  ///@}
+
+  ///@name Comparison operator definitions
+  ///@{
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator==(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return P::Equal(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator==(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    return P::Equal(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator==(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return P::Equal(lhs,rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator!=(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return ( ! (lhs==rhs) );
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator!=(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    return ( ! (lhs==rhs) );
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator!=(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return ( ! (lhs==rhs) );
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return (rhs > lhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    return (rhs > lhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return (rhs > lhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return P::GreaterThan(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    return P::GreaterThan(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return P::GreaterThan(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<=(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return (rhs >= lhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<=(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    return (rhs >= lhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<=(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return (rhs >= lhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>=(const ValueWithError<U, P>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return P::GreaterOrEqual(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>=(const ValueWithError<U, P>& lhs, const V& rhs)
+  {
+    return P::GreaterOrEqual(lhs, rhs);
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>=(const U& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return P::GreaterOrEqual(lhs, rhs);
+  }
+  ///@}
+
+  ///@name Conversion operators
+  ///
+  /// Same format as the non-disabled variant: "(value+-error)", the error is ignored on input.
+  ///@{
+  template<typename charT, typename traits, typename T, typename P>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const ValueWithError<T, P>& v)
+  {
+    // use a temporary stringstream to honour width
+    std::basic_ostringstream<charT,traits> sstr;
+    sstr.copyfmt(out);
+    sstr.width(0);
+
+    sstr << '(' << v.GetValue() << "+-" << v.GetError() << ')';
+
+    out << sstr.str();
+
+    return out;
+  }
+
+  template<typename charT, typename traits, typename T, typename P>
+  std::basic_istream<charT,traits>&
+  operator>>(std::basic_istream<charT,traits>& in, ValueWithError<T, P>& v)
+  {
+    in >> std::ws;
+    if( in.peek() == '(' )
+    {
+      in.ignore();
+      T value;
+      in >> value;
+
+      in >> std::ws;
+      if( in.peek() == '+' )
+      {
+        in.ignore();
+
+        in >> std::ws;
+        if( in.peek() == '-' )
+        {
+          in.ignore();
+          T error;
+          in >> error;
+
+          in >> std::ws;
+          if( in.peek() == ')' )
+          {
+            in.ignore();
+
+            if(!in.fail())
+            {
+              v = ValueWithError<T, P>(value);
+            }
+
+            return in;
+          }
+        }
+      }
+    }
+
+    in.setstate(std::ios::failbit);
+
+    return in;
+  }
+  ///@}
+
+  ///@name Mathematical function overloads
+  ///
+  /// Same set of functions as the non-disabled variant
+  ///@{
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  abs(const ValueWithError<T, P>& v)
+  {
+    using std::abs;
+    return ValueWithError<T, P>(abs(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  acos(const ValueWithError<T, P>& v)
+  {
+    using std::acos;
+    return ValueWithError<T, P>(acos(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  asin(const ValueWithError<T, P>& v)
+  {
+    using std::asin;
+    return ValueWithError<T, P>(asin(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  atan(const ValueWithError<T, P>& v)
+  {
+    using std::atan;
+    return ValueWithError<T, P>(atan(v.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  atan2(const ValueWithError<U, P>& y, const ValueWithError<V, P>& x)
+  {
+    using std::atan2;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(atan2(y.GetValue(), x.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  atan2(const U& y, const ValueWithError<V, P>& x)
+  {
+    using std::atan2;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(atan2(y, x.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  atan2(const ValueWithError<U, P>& y, const V& x)
+  {
+    using std::atan2;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(atan2(y.GetValue(), x));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  cos(const ValueWithError<T, P>& v)
+  {
+    using std::cos;
+    return ValueWithError<T, P>(cos(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  cosh(const ValueWithError<T, P>& v)
+  {
+    using std::cosh;
+    return ValueWithError<T, P>(cosh(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  exp(const ValueWithError<T, P>& v)
+  {
+    using std::exp;
+    return ValueWithError<T, P>(exp(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  fabs(const ValueWithError<T, P>& v)
+  {
+    using std::fabs;
+    return ValueWithError<T, P>(fabs(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  log(const ValueWithError<T, P>& v)
+  {
+    using std::log;
+    return ValueWithError<T, P>(log(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  log10(const ValueWithError<T, P>& v)
+  {
+    using std::log10;
+    return ValueWithError<T, P>(log10(v.GetValue()));
+  }
+
+  template<typename T, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<T, V>::type, P>
+  pow(const ValueWithError<T, P>& base, const V& exponent)
+  {
+    using std::pow;
+    typedef typename detail::promote_args<T, V>::type R;
+    return ValueWithError<R, P>(pow(base.GetValue(), exponent));
+  }
+
+  template<typename T, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<V, T>::type, P>
+  pow(const V& base, const ValueWithError<T, P>& exponent)
+  {
+    using std::pow;
+    typedef typename detail::promote_args<V, T>::type R;
+    return ValueWithError<R, P>(pow(base, exponent.GetValue()));
+  }
+
+  template<typename T, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<T, V>::type, P>
+  pow(const ValueWithError<T, P>& base, const ValueWithError<V, P>& exponent)
+  {
+    using std::pow;
+    typedef typename detail::promote_args<T, V>::type R;
+    return ValueWithError<R, P>(pow(base.GetValue(), exponent.GetValue()));
+  }
+
+  // The error is discarded, the value is only passed to have a T of the right size, e.g. for std::valarray
+  template<int N, typename T, typename P>
+  ValueWithError<T, P>
+  pow(const ValueWithError<T, P>& base)
+  {
+    T error;
+    return ValueWithError<T, P>(detail::power_with_error<T, N>::apply(base.GetValue(), base.GetValue(), error));
+  }
+
+  template<typename T, typename P>
+  ValueWithError<typename detail::promote_args<T, int>::type, P>
+  pow(const ValueWithError<T, P>& base, int exponent)
+  {
+    typedef typename detail::promote_args<T, int>::type R;
+    R error;
+    return ValueWithError<R, P>(detail::power_with_error_n<R>(base.GetValue(), exponent, base.GetValue(), error));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  sin(const ValueWithError<T, P>& v)
+  {
+    using std::sin;
+    return ValueWithError<T, P>(sin(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  sinh(const ValueWithError<T, P>& v)
+  {
+    using std::sinh;
+    return ValueWithError<T, P>(sinh(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  sqrt(const ValueWithError<T, P>& v)
+  {
+    using std::sqrt;
+    return ValueWithError<T, P>(sqrt(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  tan(const ValueWithError<T, P>& v)
+  {
+    using std::tan;
+    return ValueWithError<T, P>(tan(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  tanh(const ValueWithError<T, P>& v)
+  {
+    using std::tanh;
+    return ValueWithError<T, P>(tanh(v.GetValue()));
+  }
+
+#if __cplusplus >= 201103L
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  asinh(const ValueWithError<T, P>& v)
+  {
+    using std::asinh;
+    return ValueWithError<T, P>(asinh(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  acosh(const ValueWithError<T, P>& v)
+  {
+    using std::acosh;
+    return ValueWithError<T, P>(acosh(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  atanh(const ValueWithError<T, P>& v)
+  {
+    using std::atanh;
+    return ValueWithError<T, P>(atanh(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  cbrt(const ValueWithError<T, P>& v)
+  {
+    using std::cbrt;
+    return ValueWithError<T, P>(cbrt(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  erf(const ValueWithError<T, P>& v)
+  {
+    using std::erf;
+    return ValueWithError<T, P>(erf(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  erfc(const ValueWithError<T, P>& v)
+  {
+    using std::erfc;
+    return ValueWithError<T, P>(erfc(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  exp2(const ValueWithError<T, P>& v)
+  {
+    using std::exp2;
+    return ValueWithError<T, P>(exp2(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  expm1(const ValueWithError<T, P>& v)
+  {
+    using std::expm1;
+    return ValueWithError<T, P>(expm1(v.GetValue()));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const ValueWithError<V, P>& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x.GetValue(), y.GetValue(), z.GetValue()));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const ValueWithError<V, P>& y, const W& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x.GetValue(), y.GetValue(), z));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const V& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x.GetValue(), y, z.GetValue()));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const U& x, const ValueWithError<V, P>& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x, y.GetValue(), z.GetValue()));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const V& y, const W& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x.GetValue(), y, z));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const U& x, const ValueWithError<V, P>& y, const W& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x, y.GetValue(), z));
+  }
+
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const U& x, const V& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(fma(x, y, z.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  hypot(const ValueWithError<U, P>& x, const ValueWithError<V, P>& y)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(detail::hypot(x.GetValue(), y.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<V, U>::type, P>
+  hypot(const U& x, const ValueWithError<V, P>& y)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(detail::hypot(x, y.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  hypot(const ValueWithError<U, P>& x, const V& y)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ValueWithError<R, P>(detail::hypot(x.GetValue(), y));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  lgamma(const ValueWithError<T, P>& v)
+  {
+    using std::lgamma;
+    return ValueWithError<T, P>(lgamma(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  log1p(const ValueWithError<T, P>& v)
+  {
+    using std::log1p;
+    return ValueWithError<T, P>(log1p(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  log2(const ValueWithError<T, P>& v)
+  {
+    using std::log2;
+    return ValueWithError<T, P>(log2(v.GetValue()));
+  }
+
+  template<typename T, typename P>
+  CONSTEXPR ValueWithError<T, P>
+  tgamma(const ValueWithError<T, P>& v)
+  {
+    using std::tgamma;
+    return ValueWithError<T, P>(tgamma(v.GetValue()));
+  }
+  ///@}
+
+  END_VALUE_WITH_ERROR_NAMESPACE
+
+  namespace detail {
+
+    template<typename T, typename P>
+    CONSTEXPR const T& value_of(const ValueWithError<T, P>& a)
+    {
+      return a.GetValue();
+    }
+
+    template<typename T, typename P, typename Iterator>
+    ValueWithError<T, P> horner(Iterator first, Iterator last, const T& x)
+    {
+      if(first == last)
+      {
+        return ValueWithError<T, P>();
+      }
+
+      --last;
+      T value = T(value_of(*last));
+      while(last != first)
+      {
+        --last;
+        value = multiply_add(value, x, T(value_of(*last)));
+      }
+
+      return ValueWithError<T, P>(value);
+    }
+
+  } // namespace detail
+
+  BEGIN_VALUE_WITH_ERROR_NAMESPACE
+
+  ///@name Polynomial evaluation
+  ///@{
+  template<typename Iterator, typename T, typename P>
+  ValueWithError<T, P>
+  evaluate_polynomial(Iterator first, Iterator last, const ValueWithError<T, P>& x)
+  {
+    return detail::horner<T, P>(first, last, x.GetValue());
+  }
+
+  template<typename Iterator>
+  typename std::iterator_traits<Iterator>::value_type
+  evaluate_polynomial(Iterator first, Iterator last, const typename std::iterator_traits<Iterator>::value_type::value_type& x)
+  {
+    typedef typename std::iterator_traits<Iterator>::value_type R;
+    return detail::horner<typename R::value_type, typename R::policy_type>(first, last, x);
+  }
+
+  template<typename Iterator, typename InputIterator, typename OutputIterator>
+  OutputIterator
+  evaluate_polynomial(Iterator first, Iterator last, InputIterator xFirst, InputIterator xLast, OutputIterator result)
+  {
+    for(; xFirst != xLast; ++xFirst, ++result)
+    {
+      *result = evaluate_polynomial(first, last, *xFirst);
+    }
+
+    return result;
+  }
+#endif // __cplusplus >= 201103L
+  ///@}
+
+  ///@name Partial specializations for invalid types
+  ///@{
+  template<typename T, typename P>
+  class ValueWithError<std::complex<T>, P> {};
+
+  template<typename P>
+  class ValueWithError<short, P> {};
+  template<typename P>
+  class ValueWithError<unsigned short, P> {};
+  template<typename P>
+  class ValueWithError<const unsigned short, P> {};
+
+  template<typename P>
+  class ValueWithError<int, P> {};
+  template<typename P>
+  class ValueWithError<unsigned int, P> {};
+  template<typename P>
+  class ValueWithError<const unsigned int, P> {};
+
+  template<typename P>
+  class ValueWithError<long, P> {};
+  template<typename P>
+  class ValueWithError<unsigned long, P> {};
+  template<typename P>
+  class ValueWithError<const unsigned long, P> {};
+
+#if __cplusplus >= 201103L
+  template<typename P>
+  class ValueWithError<long long, P> {};
+  template<typename P>
+  class ValueWithError<unsigned long long, P> {};
+  template<typename P>
+  class ValueWithError<const unsigned long long, P> {};
+#endif // __cplusplus >= 201103L
+  ///@}
+
+  END_VALUE_WITH_ERROR_NAMESPACE
+
+} // namespace error_propagation
+
+#endif // DISABLED_VALUE_WITH_ERROR_HPP
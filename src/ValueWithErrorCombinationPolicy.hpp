@@ -0,0 +1,265 @@
+#ifndef VALUE_WITH_ERROR_COMBINATIONPOLICY_HPP
+#define VALUE_WITH_ERROR_COMBINATIONPOLICY_HPP
+
+#include <limits>
+#include <boost/mpl/has_xxx.hpp>
+
+#include "DetailValueWithError.hpp"
+#include "fwd.hpp"
+
+namespace error_propagation {
+
+  /** @name Error combination policies
+   *
+   * Rule for combining the error contributions of two arguments, e.g. of @f$ v_y e_x @f$ and @f$ v_x e_y @f$ in a
+   * product. Selected with the nested typedef combination_policy of the policy class P of ValueWithError, see
+   * CombinedPolicy. Policy classes without that typedef, like the comparison policies, use
+   * QuadratureCombinationPolicy.
+   *
+   * The rule is applied by the binary operators and math functions of ValueWithError, MixedPrecisionValueWithError,
+   * RelativeValueWithError and FiniteDifferencePropagator, and by DeferredValueWithError and CompiledExpression,
+   * which replay the operations of ValueWithError. Only Dual, SecondOrderValueWithError and UnscentedTransform
+   * ignore it and always combine in quadrature.
+   *@{
+   */
+
+  /// Gaussian error propagation of uncorrelated errors, @f$ \sqrt{a^2 + b^2} @f$
+  class QuadratureCombinationPolicy
+  {
+  public:
+    template<typename T, typename U>
+    CONST static typename detail::promote_args<T, U>::type Combine(const T& a, const U& b)
+    {
+      return detail::hypot(a, b);
+    }
+
+  private:
+    QuadratureCombinationPolicy();
+    ~QuadratureCombinationPolicy();
+  };
+
+  /// Worst case bound for fully correlated errors, @f$ |a| + |b| @f$, needs no square root
+  class LinearCombinationPolicy
+  {
+  public:
+    template<typename T, typename U>
+    CONST static typename detail::promote_args<T, U>::type Combine(const T& a, const U& b)
+    {
+      using std::abs;
+      return abs(a) + abs(b);
+    }
+
+  private:
+    LinearCombinationPolicy();
+    ~LinearCombinationPolicy();
+  };
+
+  /// Largest single contribution, @f$ \max(|a|, |b|) @f$, a lower bound of the other two rules
+  class MaximumCombinationPolicy
+  {
+  public:
+    template<typename T, typename U>
+    CONST static typename detail::promote_args<T, U>::type Combine(const T& a, const U& b)
+    {
+      return detail::max_abs(a, b);
+    }
+
+  private:
+    MaximumCombinationPolicy();
+    ~MaximumCombinationPolicy();
+  };
+
+  /** @brief Policy class with a comparison, a combination and a derivative policy
+   *
+   * @code{cpp}
+     typedef CombinedPolicy<CompareWithinErrorIntervalsPolicy, LinearCombinationPolicy> WorstCase;
+     ValueWithError<double, WorstCase> x(1.0, 0.1), y(2.0, 0.2);
+     x * y; // 2.0 +- 0.4
+     @endcode
+   *
+   * @tparam ComparisonPolicy  e.g. ExactValueAndIgnoreErrorPolicy or CompareWithinErrorIntervalsPolicy
+   * @tparam CombinationPolicy e.g. QuadratureCombinationPolicy, LinearCombinationPolicy or MaximumCombinationPolicy
+   * @tparam DerivativePolicy  ExactDerivativePolicy (default) or FastDerivativePolicy, only used by the C++11 math
+   *                           functions
+   */
+  template<typename ComparisonPolicy, typename CombinationPolicy, typename DerivativePolicy>
+  class CombinedPolicy : public ComparisonPolicy
+  {
+  public:
+    typedef CombinationPolicy combination_policy;
+    typedef DerivativePolicy derivative_policy;
+
+  private:
+    CombinedPolicy();
+    ~CombinedPolicy();
+  };
+  ///@}
+
+  namespace detail {
+
+    BOOST_MPL_HAS_XXX_TRAIT_DEF(combination_policy)
+
+    /// Combination policy of the policy class P, QuadratureCombinationPolicy if P doesn't define one
+    template<typename P, bool has_policy = has_combination_policy<P>::value>
+    struct combination_policy
+    {
+      typedef QuadratureCombinationPolicy type;
+    };
+
+    template<typename P>
+    struct combination_policy<P, true>
+    {
+      typedef typename P::combination_policy type;
+    };
+
+    /// Combines two error contributions according to the policy class P
+    template<typename P, typename T, typename U>
+    CONSTEXPR typename promote_args<T, U>::type
+    combine_errors(const T& a, const U& b)
+    {
+      return combination_policy<P>::type::Combine(a, b);
+    }
+
+    /** Combines many error contributions one by one with Combine()
+     *
+     * Scale(k) multiplies all contributions added so far by k, which requires Combine(k*a, k*b) == |k|*Combine(a, b).
+     * Merge() adds the contributions of another accumulator, which requires an associative Combine. Both hold for
+     * the three provided rules.
+     */
+    template<typename CombinationPolicy, typename T>
+    class combining_error_accumulator
+    {
+    public:
+      /// No contributions, requires Combine(0, a) == |a|
+      combining_error_accumulator()
+        :
+        m_error(0)
+      {}
+
+      explicit combining_error_accumulator(const T& contribution)
+        :
+        m_error(abs(contribution))
+      {}
+
+      void Add(const T& contribution)
+      {
+        m_error = CombinationPolicy::Combine(m_error, contribution);
+      }
+
+      void Merge(const combining_error_accumulator& other)
+      {
+        m_error = CombinationPolicy::Combine(m_error, other.m_error);
+      }
+
+      void Scale(const T& factor)
+      {
+        m_error = m_error * abs(factor);
+      }
+
+      T Result() const
+      {
+        return m_error;
+      }
+
+      /// Always true, the result is as accurate as Combine()
+      bool InRange() const
+      {
+        return true;
+      }
+
+    private:
+      static T abs(const T& a)
+      {
+        using std::abs;
+        return abs(a);
+      }
+
+      T m_error;
+    };
+
+    /** Combines many error contributions in one pass, e.g. for fma and polynomials
+     *
+     * Same interface as combining_error_accumulator. If InRange() is false, the result may be inaccurate and the
+     * caller repeats the contributions with combining_error_accumulator.
+     */
+    template<typename CombinationPolicy, typename T>
+    class error_accumulator : public combining_error_accumulator<CombinationPolicy, T>
+    {
+    public:
+      error_accumulator()
+      {}
+
+      explicit error_accumulator(const T& contribution)
+        :
+        combining_error_accumulator<CombinationPolicy, T>(contribution)
+      {}
+    };
+
+    /** Sums the squares with multiply-adds and takes a single square root
+     *
+     * InRange() is false if the sum overflowed or if a nonzero contribution left a sum below
+     * @f$ \epsilon^{-1} @f$ times the smallest normal number, where its underflowing square may not be negligible.
+     * Overflow and a sum scaled into that range are checked once at the end, the contributions with two comparisons
+     * off the chain of multiply-adds.
+     */
+    template<typename T>
+    class error_accumulator<QuadratureCombinationPolicy, T>
+    {
+    public:
+      error_accumulator()
+        :
+        m_sum(0),
+        m_inRange(true)
+      {}
+
+      explicit error_accumulator(const T& contribution)
+        :
+        m_sum(0),
+        m_inRange(true)
+      {
+        Add(contribution);
+      }
+
+      void Add(const T& contribution)
+      {
+        m_sum = multiply_add(contribution, contribution, m_sum);
+        m_inRange = m_inRange & ((m_sum >= Smallest()) | (contribution == 0));
+      }
+
+      void Merge(const error_accumulator& other)
+      {
+        m_sum = m_sum + other.m_sum;
+        m_inRange = m_inRange & other.m_inRange;
+      }
+
+      void Scale(const T& factor)
+      {
+        m_sum = m_sum * (factor * factor);
+      }
+
+      T Result() const
+      {
+        using std::sqrt;
+        return sqrt(m_sum);
+      }
+
+      bool InRange() const
+      {
+        return m_inRange && (m_sum >= Smallest() || m_sum == 0) && m_sum <= std::numeric_limits<T>::max();
+      }
+
+    private:
+      static T Smallest()
+      {
+        return std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+      }
+
+      T m_sum;
+      bool m_inRange;
+    };
+
+  } // namespace detail
+
+} // namespace error_propagation
+
+#endif // VALUE_WITH_ERROR_COMBINATIONPOLICY_HPP
@@ -0,0 +1,464 @@
+#ifndef COMPILED_EXPRESSION_HPP
+#define COMPILED_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "ValueWithError.hpp"
+#include "DeferredValueWithError.hpp"
+#include "DetailOpcodes.hpp"
+#include "ThreadPool.hpp"
+
+namespace error_propagation {
+
+  /** @brief Computation recorded once and evaluated for many input tuples
+   *
+   * The operations are recorded with DeferredValueWithError on a DeferredTape, e.g. while assembling a formula
+   * from a configuration at runtime. The constructor translates the nodes the outputs depend on into a compact
+   * bytecode operating on slots, slots are reused as soon as their value is not needed anymore.
+   *
+   * Evaluate() replays the bytecode over columns of values and errors (structure of arrays). The rows are
+   * processed in tiles, every instruction runs as one loop over the tile with the operation selected once per
+   * tile. The tile size is chosen such that all slots of a tile fit in the L1 data cache. Each element is
+   * computed with the ValueWithError overloads, so the results are identical to evaluating the formula with
+   * ValueWithError<T, P> directly.
+   *
+   * @code{cpp}
+     DeferredTape<double> tape;
+     auto x = tape.Input(0.0, 0.0);        // placeholders, only the position on the tape matters
+     auto y = tape.Input(0.0, 0.0);
+     auto f = exp(x) * y + 2.0;
+
+     CompiledExpression<double> expr({ x, y }, { f });
+     expr.Evaluate(n, { xv, yv }, { xe, ye }, { fv }, { fe });
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class CompiledExpression
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef std::size_t size_type;
+    typedef DeferredValueWithError<T, P> variable_type;
+    typedef std::uint32_t index_type;
+
+    /// Assumed size of the L1 data cache in bytes, used for the default tile size
+    static const size_type l1CacheSize = 32768;
+
+    /// Operation on slots, lhs and rhs are unused for constant operands
+    struct Instruction
+    {
+      detail::Opcode op;
+      detail::Operands operands;
+      index_type lhs;
+      index_type rhs;
+      index_type result;
+      T constant;
+    };
+
+    /** @brief Compile the operations between inputs and outputs
+     *
+     * @param inputs  recorded inputs, all inputs the outputs depend on must be listed
+     * @param outputs results, must be recorded on the same tape as the inputs
+     */
+    CompiledExpression(const std::vector<variable_type>& inputs, const std::vector<variable_type>& outputs)
+      :
+      m_numInputs(inputs.size()),
+      m_numSlots(0)
+    {
+      assert(!outputs.empty());
+      Compile(inputs, outputs);
+      m_tileSize = DefaultTileSize();
+    }
+
+    ///@name Getters
+    ///@{
+    size_type NumInputs() const
+    {
+      return m_numInputs;
+    }
+
+    size_type NumOutputs() const
+    {
+      return m_outputSlots.size();
+    }
+
+    /// Number of value and error slots required for one element
+    size_type NumSlots() const
+    {
+      return m_numSlots;
+    }
+
+    const std::vector<Instruction>& GetInstructions() const
+    {
+      return m_instructions;
+    }
+
+    size_type GetTileSize() const
+    {
+      return m_tileSize;
+    }
+    ///@}
+
+    /// Change the number of rows processed per tile, a tile size of one evaluates element by element
+    void SetTileSize(size_type tileSize)
+    {
+      assert(tileSize > 0);
+      m_tileSize = tileSize;
+    }
+
+    /// Evaluate a single input tuple
+    std::vector<ValueWithError<T, P> > Evaluate(const std::vector<ValueWithError<T, P> >& inputs) const
+    {
+      assert(inputs.size() == m_numInputs);
+
+      std::vector<T> values(m_numInputs + NumOutputs()), errors(m_numInputs + NumOutputs());
+      std::vector<const T*> inputValues, inputErrors;
+      std::vector<T*> outputValues, outputErrors;
+
+      for(size_type i = 0; i < m_numInputs; i++)
+      {
+        values[i] = inputs[i].GetValue();
+        errors[i] = inputs[i].GetError();
+        inputValues.push_back(&values[i]);
+        inputErrors.push_back(&errors[i]);
+      }
+
+      for(size_type i = m_numInputs; i < values.size(); i++)
+      {
+        outputValues.push_back(&values[i]);
+        outputErrors.push_back(&errors[i]);
+      }
+
+      Evaluate(1, inputValues, inputErrors, outputValues, outputErrors);
+
+      std::vector<ValueWithError<T, P> > result;
+      for(size_type i = m_numInputs; i < values.size(); i++)
+      {
+        result.push_back(ValueWithError<T, P>(values[i], errors[i]));
+      }
+
+      return result;
+    }
+
+    /** @brief Evaluate n input tuples given as columns
+     *
+     * @param n            number of rows
+     * @param inputValues  one column of n values per input
+     * @param inputErrors  one column of n errors per input
+     * @param outputValues one column of n values per output
+     * @param outputErrors one column of n errors per output
+     */
+    void Evaluate(size_type n,
+                  const std::vector<const T*>& inputValues, const std::vector<const T*>& inputErrors,
+                  const std::vector<T*>& outputValues, const std::vector<T*>& outputErrors) const
+    {
+      CheckColumns(inputValues, inputErrors, outputValues, outputErrors);
+
+      std::vector<T> scratch(2 * m_numSlots * m_tileSize);
+      EvaluateRange(0, n, inputValues, inputErrors, outputValues, outputErrors, scratch);
+    }
+
+    /// Evaluate n input tuples given as columns, the rows are distributed over the threads of pool
+    void Evaluate(size_type n,
+                  const std::vector<const T*>& inputValues, const std::vector<const T*>& inputErrors,
+                  const std::vector<T*>& outputValues, const std::vector<T*>& outputErrors,
+                  ThreadPool& pool) const
+    {
+      CheckColumns(inputValues, inputErrors, outputValues, outputErrors);
+
+      // whole tiles per block, enough of them that the scratch allocation does not matter
+      const size_type tiles = std::max<size_type>(pool.DefaultGrain(n) / m_tileSize, 1);
+      pool.ParallelFor(n, tiles * m_tileSize, [&](size_type begin, size_type end)
+      {
+        std::vector<T> scratch(2 * m_numSlots * m_tileSize);
+        EvaluateRange(begin, end, inputValues, inputErrors, outputValues, outputErrors, scratch);
+      });
+    }
+
+  private:
+    typedef ValueWithError<T, P> VT;
+
+    /// Runs a unary function over a tile
+    struct UnaryLoop
+    {
+      size_type n;
+      const T* av;
+      const T* ae;
+      T* rv;
+      T* re;
+
+      template<typename F>
+      void Run() const
+      {
+        for(size_type k = 0; k < n; k++)
+        {
+          const VT r = F::apply(VT(av[k], ae[k]));
+          rv[k] = r.GetValue();
+          re[k] = r.GetError();
+        }
+      }
+    };
+
+    /// Runs a binary function over a tile
+    struct BinaryLoop
+    {
+      detail::Operands operands;
+      size_type n;
+      const T* lv;
+      const T* le;
+      const T* rv;
+      const T* re;
+      T constant;
+      T* ov;
+      T* oe;
+
+      template<typename F>
+      void Run() const
+      {
+        switch(operands)
+        {
+          case detail::Operands::Both:
+            for(size_type k = 0; k < n; k++)
+            {
+              const VT r = F::template apply<VT>(VT(lv[k], le[k]), VT(rv[k], re[k]));
+              ov[k] = r.GetValue();
+              oe[k] = r.GetError();
+            }
+            break;
+          case detail::Operands::ConstantLhs:
+            for(size_type k = 0; k < n; k++)
+            {
+              const VT r = F::template apply<VT>(constant, VT(rv[k], re[k]));
+              ov[k] = r.GetValue();
+              oe[k] = r.GetError();
+            }
+            break;
+          case detail::Operands::ConstantRhs:
+            for(size_type k = 0; k < n; k++)
+            {
+              const VT r = F::template apply<VT>(VT(lv[k], le[k]), constant);
+              ov[k] = r.GetValue();
+              oe[k] = r.GetError();
+            }
+            break;
+          default:
+            assert(!"invalid operands");
+            break;
+        }
+      }
+    };
+
+    /// Largest multiple of 8 rows for which all slots fit into the L1 cache, limited to [8, 1024]
+    size_type DefaultTileSize() const
+    {
+      const size_type rows = l1CacheSize / (2 * sizeof(T) * std::max<size_type>(m_numSlots, 1));
+      return std::min<size_type>(std::max<size_type>(rows / 8 * 8, 8), 1024);
+    }
+
+    void Compile(const std::vector<variable_type>& inputs, const std::vector<variable_type>& outputs)
+    {
+      typedef typename DeferredTape<T, P>::Node Node;
+
+      const DeferredTape<T, P>& tape = outputs.front().GetTape();
+      const index_type none = std::numeric_limits<index_type>::max();
+
+      size_type numNodes = 0;
+      for(const variable_type& output : outputs)
+      {
+        assert(&output.GetTape() == &tape);
+        numNodes = std::max(numNodes, output.GetIndex() + 1);
+      }
+
+      // mark the nodes the outputs depend on, operands are always recorded before their users
+      std::vector<bool> needed(numNodes, false);
+      for(const variable_type& output : outputs)
+      {
+        needed[output.GetIndex()] = true;
+      }
+
+      // last instruction reading a node, outputs are kept until the end
+      std::vector<size_type> lastUse(numNodes, 0);
+      for(const variable_type& output : outputs)
+      {
+        lastUse[output.GetIndex()] = std::numeric_limits<size_type>::max();
+      }
+
+      for(size_type i = numNodes; i-- > 0;)
+      {
+        if(!needed[i])
+        {
+          continue;
+        }
+
+        const Node& node = tape.GetNode(i);
+
+        if(node.operands == detail::Operands::Unary || node.operands == detail::Operands::Both || node.operands == detail::Operands::ConstantRhs)
+        {
+          needed[node.lhs] = true;
+          lastUse[node.lhs] = std::max(lastUse[node.lhs], i);
+        }
+
+        if(node.operands == detail::Operands::Both || node.operands == detail::Operands::ConstantLhs)
+        {
+          needed[node.rhs] = true;
+          lastUse[node.rhs] = std::max(lastUse[node.rhs], i);
+        }
+      }
+
+      std::vector<index_type> slot(numNodes, none);
+      std::vector<index_type> freeSlots;
+
+      // inputs occupy the first slots
+      for(const variable_type& input : inputs)
+      {
+        assert(&input.GetTape() == &tape);
+        assert(tape.GetNode(input.GetIndex()).op == detail::Opcode::Input);
+
+        m_inputSlots.push_back(static_cast<index_type>(m_numSlots));
+
+        if(input.GetIndex() < numNodes)
+        {
+          slot[input.GetIndex()] = static_cast<index_type>(m_numSlots);
+        }
+
+        m_numSlots++;
+      }
+
+      const auto release = [&](size_type index, size_type i)
+      {
+        if(lastUse[index] == i)
+        {
+          freeSlots.push_back(slot[index]);
+        }
+      };
+
+      for(size_type i = 0; i < numNodes; i++)
+      {
+        const Node& node = tape.GetNode(i);
+
+        if(!needed[i] || node.operands == detail::Operands::None)
+        {
+          assert(!needed[i] || slot[i] != none); // inputs the outputs depend on must be listed
+          continue;
+        }
+
+        Instruction instruction{node.op, node.operands, 0, 0, 0, node.constant};
+
+        if(node.operands != detail::Operands::ConstantLhs)
+        {
+          instruction.lhs = slot[node.lhs];
+        }
+
+        if(node.operands == detail::Operands::Both || node.operands == detail::Operands::ConstantLhs)
+        {
+          instruction.rhs = slot[node.rhs];
+        }
+
+        // allocate before releasing the operands, so that the result never aliases an operand
+        if(freeSlots.empty())
+        {
+          slot[i] = static_cast<index_type>(m_numSlots++);
+        }
+        else
+        {
+          slot[i] = freeSlots.back();
+          freeSlots.pop_back();
+        }
+
+        instruction.result = slot[i];
+        m_instructions.push_back(instruction);
+
+        if(node.operands != detail::Operands::ConstantLhs)
+        {
+          release(node.lhs, i);
+        }
+
+        if((node.operands == detail::Operands::Both && node.rhs != node.lhs) || node.operands == detail::Operands::ConstantLhs)
+        {
+          release(node.rhs, i);
+        }
+      }
+
+      for(const variable_type& output : outputs)
+      {
+        m_outputSlots.push_back(slot[output.GetIndex()]);
+      }
+    }
+
+    void CheckColumns(const std::vector<const T*>& inputValues, const std::vector<const T*>& inputErrors,
+                      const std::vector<T*>& outputValues, const std::vector<T*>& outputErrors) const
+    {
+      assert(inputValues.size() == m_numInputs && inputErrors.size() == m_numInputs);
+      assert(outputValues.size() == NumOutputs() && outputErrors.size() == NumOutputs());
+      (void) inputValues; (void) inputErrors; (void) outputValues; (void) outputErrors;
+    }
+
+    void EvaluateRange(size_type begin, size_type end,
+                       const std::vector<const T*>& inputValues, const std::vector<const T*>& inputErrors,
+                       const std::vector<T*>& outputValues, const std::vector<T*>& outputErrors,
+                       std::vector<T>& scratch) const
+    {
+      T* values = scratch.data();
+      T* errors = scratch.data() + m_numSlots * m_tileSize;
+
+      for(size_type start = begin; start < end; start += m_tileSize)
+      {
+        const size_type n = std::min(m_tileSize, end - start);
+
+        for(size_type i = 0; i < m_numInputs; i++)
+        {
+          std::copy(inputValues[i] + start, inputValues[i] + start + n, values + m_inputSlots[i] * m_tileSize);
+          std::copy(inputErrors[i] + start, inputErrors[i] + start + n, errors + m_inputSlots[i] * m_tileSize);
+        }
+
+        for(const Instruction& instruction : m_instructions)
+        {
+          T* rv = values + instruction.result * m_tileSize;
+          T* re = errors + instruction.result * m_tileSize;
+
+          if(instruction.operands == detail::Operands::Unary)
+          {
+            UnaryLoop loop{n, values + instruction.lhs * m_tileSize, errors + instruction.lhs * m_tileSize, rv, re};
+            detail::visit_unary(instruction.op, loop);
+          }
+          else
+          {
+            BinaryLoop loop{instruction.operands, n,
+                            values + instruction.lhs * m_tileSize, errors + instruction.lhs * m_tileSize,
+                            values + instruction.rhs * m_tileSize, errors + instruction.rhs * m_tileSize,
+                            instruction.constant, rv, re};
+            detail::visit_binary(instruction.op, loop);
+          }
+        }
+
+        for(size_type i = 0; i < m_outputSlots.size(); i++)
+        {
+          std::copy(values + m_outputSlots[i] * m_tileSize, values + m_outputSlots[i] * m_tileSize + n, outputValues[i] + start);
+          std::copy(errors + m_outputSlots[i] * m_tileSize, errors + m_outputSlots[i] * m_tileSize + n, outputErrors[i] + start);
+        }
+      }
+    }
+
+    size_type m_numInputs;
+    size_type m_numSlots;
+    size_type m_tileSize;
+    std::vector<Instruction> m_instructions;
+    std::vector<index_type> m_inputSlots;
+    std::vector<index_type> m_outputSlots;
+  };
+
+  template<typename T, typename P>
+  const typename CompiledExpression<T, P>::size_type CompiledExpression<T, P>::l1CacheSize;
+
+} // namespace error_propagation
+
+#endif // COMPILED_EXPRESSION_HPP
@@ -0,0 +1,261 @@
+#ifndef CONCURRENT_ACCUMULATOR_HPP
+#define CONCURRENT_ACCUMULATOR_HPP
+
+#include "SumAccumulator.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace error_propagation {
+
+  namespace detail {
+
+    /** @brief Partial sum of a single writer thread of ConcurrentAccumulator
+     *
+     * The owner adds to sum, which no other thread touches, and publishes a copy of it word by word in relaxed
+     * atomics, guarded by a sequence counter which is odd while the copy is being written (a seqlock). Padded against
+     * false sharing with the slots of other threads.
+     */
+    template<typename A>
+    struct accumulator_slot
+    {
+      static_assert(std::is_trivially_copyable<A>::value, "the partial sum is published as a copy of its bytes");
+
+      static const std::size_t numWords = (sizeof(A) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+      explicit accumulator_slot(std::size_t owner_)
+        :
+        owner(owner_),
+        next(nullptr),
+        sequence(0)
+      {
+        Publish();
+      }
+
+      /// Copies sum to the published words, called by the owner only
+      void Publish()
+      {
+        std::uint64_t words[numWords] = {};
+        std::memcpy(words, &sum, sizeof(A));
+
+        const std::uint64_t s = sequence.load(std::memory_order_relaxed);
+        sequence.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for(std::size_t i = 0; i < numWords; i++)
+        {
+          published[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence.store(s + 2, std::memory_order_release);
+      }
+
+      /// Copy of the last published sum, retried while the owner is publishing, called by any thread
+      A Read() const
+      {
+        std::uint64_t words[numWords];
+        for(;;)
+        {
+          const std::uint64_t s = sequence.load(std::memory_order_acquire);
+          if(s % 2 == 0)
+          {
+            for(std::size_t i = 0; i < numWords; i++)
+            {
+              words[i] = published[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(sequence.load(std::memory_order_relaxed) == s)
+            {
+              break;
+            }
+          }
+          std::this_thread::yield();
+        }
+
+        A result;
+        std::memcpy(&result, words, sizeof(A));
+        return result;
+      }
+
+      const std::size_t owner;
+      accumulator_slot* next;
+      A sum;
+      std::atomic<std::uint64_t> sequence;
+      std::atomic<std::uint64_t> published[numWords];
+      char padding[64];
+    };
+
+    /// Unique index of the calling thread, assigned on first use and never reused
+    inline std::size_t thread_index()
+    {
+      static std::atomic<std::size_t> next(0);
+      static thread_local std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+      return index;
+    }
+
+    /// Unique id of a ConcurrentAccumulator, 0 is never assigned
+    inline std::size_t concurrent_accumulator_id()
+    {
+      static std::atomic<std::size_t> next(1);
+      return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+  } // namespace detail
+
+  /** @brief Sum of ValueWithError terms shared by many writer threads
+   *
+   * Every writer thread adds to a slot of its own, a SumAccumulator on its own cache line. The first term of a thread
+   * allocates its slot and pushes it to a lock-free list. Afterwards the writers are wait-free: a term is added to
+   * the slot and published with a seqlock, a sequence counter which is odd while the partial sum is being copied, in
+   * a fixed number of steps without waiting for any other thread. The slot of the last accumulator a thread wrote to
+   * is cached per thread, alternating writes to several accumulators search the list of slots instead. The slots of
+   * threads which have finished stay in the sum, so the memory grows with the number of threads that ever wrote.
+   *
+   * Snapshot() reads the slots one after another and adds up copies, retrying a slot while its sequence counter is
+   * odd or changed during the copy. Every term is therefore either fully contained or missing in a snapshot: the
+   * value and the error always describe the same terms, which the value and the variance in separate atomics could
+   * not guarantee. Terms added concurrently with a snapshot may be contained or not.
+   *
+   * For many terms per thread, adding them to a thread local SumAccumulator and merging that once with
+   * operator+=(const accumulator_type&) is faster still, see Bench_ConcurrentAccumulator.
+   *
+   * @code{cpp}
+     ConcurrentAccumulator<double> total;
+     // from any number of threads
+     total += ValueWithError<double>(x, dx);
+     // from any thread, concurrently with the writers
+     ValueWithError<double> current = total.Result();
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   * @tparam S  Summation policy of the slots, see SumAccumulator
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS, typename S = PlainSummation>
+  class ConcurrentAccumulator
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef SumAccumulator<T, P, S> accumulator_type;
+    typedef ValueWithError<T, P> result_type;
+
+    /// Empty sum without slots
+    ConcurrentAccumulator()
+      :
+      m_id(detail::concurrent_accumulator_id()),
+      m_slots(nullptr)
+    {
+    }
+
+    ConcurrentAccumulator(const ConcurrentAccumulator&) = delete;
+    ConcurrentAccumulator& operator=(const ConcurrentAccumulator&) = delete;
+
+    /// Not thread safe, all writers and readers must have finished
+    ~ConcurrentAccumulator()
+    {
+      Slot* slot = m_slots.load(std::memory_order_acquire);
+      while(slot)
+      {
+        Slot* next = slot->next;
+        delete slot;
+        slot = next;
+      }
+    }
+
+    /// Adds a term, thread safe
+    ConcurrentAccumulator& operator+=(const result_type& v)
+    {
+      Slot& slot = OwnSlot();
+      slot.sum += v;
+      slot.Publish();
+      return *this;
+    }
+
+    /// Adds a partial sum, e.g. the thread local sum of a writer, thread safe
+    ConcurrentAccumulator& operator+=(const accumulator_type& partial)
+    {
+      Slot& slot = OwnSlot();
+      slot.sum += partial;
+      slot.Publish();
+      return *this;
+    }
+
+    /// Sum of the slots, thread safe
+    accumulator_type Snapshot() const
+    {
+      accumulator_type result;
+
+      for(const Slot* slot = m_slots.load(std::memory_order_acquire); slot; slot = slot->next)
+      {
+        result += slot->Read();
+      }
+
+      return result;
+    }
+
+    /// Sum of the terms, the error combined according to the combination policy of P, thread safe
+    result_type Result() const
+    {
+      return Snapshot().Result();
+    }
+
+    /// Number of slots, i.e. of threads which have written, thread safe
+    std::size_t size() const
+    {
+      std::size_t result = 0;
+      for(const Slot* slot = m_slots.load(std::memory_order_acquire); slot; slot = slot->next)
+      {
+        result++;
+      }
+      return result;
+    }
+
+    private:
+    typedef detail::accumulator_slot<accumulator_type> Slot;
+
+    /// Slot of the calling thread, allocated on its first term
+    Slot& OwnSlot()
+    {
+      // the ids are never reused, so the cache cannot refer to a destroyed accumulator at the same address
+      static thread_local std::size_t cachedId = 0;
+      static thread_local Slot* cachedSlot = nullptr;
+
+      if(cachedId == m_id)
+      {
+        return *cachedSlot;
+      }
+
+      const std::size_t owner = detail::thread_index();
+      Slot* head = m_slots.load(std::memory_order_acquire);
+      Slot* slot = head;
+      while(slot && slot->owner != owner)
+      {
+        slot = slot->next;
+      }
+
+      if(!slot)
+      {
+        // only this thread pushes a slot for owner, other threads may push theirs in the meantime
+        slot = new Slot(owner);
+        do
+        {
+          slot->next = head;
+        }
+        while(!m_slots.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_acquire));
+      }
+
+      cachedId = m_id;
+      cachedSlot = slot;
+      return *slot;
+    }
+
+    const std::size_t m_id;
+    std::atomic<Slot*> m_slots;
+  };
+
+} // namespace error_propagation
+
+#endif // CONCURRENT_ACCUMULATOR_HPP
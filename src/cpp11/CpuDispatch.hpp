@@ -0,0 +1,344 @@
+#ifndef CPU_DISPATCH_HPP
+#define CPU_DISPATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+#include "ValueWithError.hpp"
+#include "SimdPack.hpp"
+
+// Runtime dispatch needs __builtin_cpu_supports and the target attribute of GCC and clang, flatten inlines the
+// whole kernel so that it is compiled for the target as well
+#if (defined __GNUC__ || defined __clang__) && (defined __x86_64__ || defined __i386__)
+  #define HAS_CPU_DISPATCH
+  #define CPU_DISPATCH_TARGET(isa) __attribute__((target(isa), flatten))
+#endif
+
+namespace error_propagation {
+
+  /// Instruction set levels of the batch kernels, ordered from the narrowest to the widest
+  enum class InstructionSet : unsigned char
+  {
+    Generic, ///< Plain loop over ValueWithError, any CPU
+    SSE2,    ///< 128 bit registers, 2 doubles or 4 floats per SimdPack
+    AVX2,    ///< 256 bit registers and FMA, 4 doubles or 8 floats per SimdPack
+    AVX512   ///< 512 bit registers (AVX-512F), 8 doubles or 16 floats per SimdPack
+  };
+
+  namespace detail {
+
+    inline InstructionSet detect_instruction_set()
+    {
+#ifdef HAS_CPU_DISPATCH
+      __builtin_cpu_init();
+
+      if(__builtin_cpu_supports("avx512f"))
+      {
+        return InstructionSet::AVX512;
+      }
+
+      if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      {
+        return InstructionSet::AVX2;
+      }
+
+      if(__builtin_cpu_supports("sse2"))
+      {
+        return InstructionSet::SSE2;
+      }
+#endif // HAS_CPU_DISPATCH
+
+      return InstructionSet::Generic;
+    }
+
+    /// Returns false for unknown names
+    inline bool parse_instruction_set(const char* name, InstructionSet& isa)
+    {
+      static const char* const names[] = { "generic", "sse2", "avx2", "avx512" };
+
+      for(std::size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+      {
+        if(std::strcmp(name, names[i]) == 0)
+        {
+          isa = static_cast<InstructionSet>(i);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    /// The requested level if it is known and supported, the detected level otherwise
+    inline InstructionSet select_instruction_set(const char* requested, InstructionSet detected)
+    {
+      InstructionSet isa;
+
+      if(requested != nullptr && parse_instruction_set(requested, isa) && isa <= detected)
+      {
+        return isa;
+      }
+
+      return detected;
+    }
+
+    /// Number of lanes of T in a register with the given size, at least one
+    template<typename T, std::size_t RegisterBytes>
+    struct lanes_per_register
+    {
+      static const std::size_t value = RegisterBytes / sizeof(T) > 0 ? RegisterBytes / sizeof(T) : 1;
+    };
+
+    template<typename T, std::size_t RegisterBytes>
+    const std::size_t lanes_per_register<T, RegisterBytes>::value;
+
+    template<typename T, typename P, typename F>
+    void batch_generic(const ValueWithError<T, P>* first, std::size_t size, ValueWithError<T, P>* result, F& f)
+    {
+      for(std::size_t i = 0; i < size; i++)
+      {
+        result[i] = f(first[i]);
+      }
+    }
+
+    template<typename T, typename P, typename F>
+    void batch_generic(const ValueWithError<T, P>* first1, const ValueWithError<T, P>* first2, std::size_t size,
+                       ValueWithError<T, P>* result, F& f)
+    {
+      for(std::size_t i = 0; i < size; i++)
+      {
+        result[i] = f(first1[i], first2[i]);
+      }
+    }
+
+    /// Gathers W consecutive elements into one pack
+    template<std::size_t W, typename T, typename P>
+    ValueWithError<SimdPack<T, W>, P> load_lanes(const ValueWithError<T, P>* first)
+    {
+      SimdPack<T, W> value, error;
+      for(std::size_t k = 0; k < W; k++)
+      {
+        value[k] = first[k].GetValue();
+        error[k] = first[k].GetError();
+      }
+      return ValueWithError<SimdPack<T, W>, P>(value, error);
+    }
+
+    template<std::size_t W, typename T, typename P>
+    void store_lanes(const ValueWithError<SimdPack<T, W>, P>& pack, ValueWithError<T, P>* result)
+    {
+      for(std::size_t k = 0; k < W; k++)
+      {
+        result[k] = get_lane(pack, k);
+      }
+    }
+
+    /// W elements at a time with SimdPack, the remainder with the plain loop. result may be equal to first.
+    template<std::size_t W, typename T, typename P, typename F>
+    void batch_packed(const ValueWithError<T, P>* first, std::size_t size, ValueWithError<T, P>* result, F& f)
+    {
+      const std::size_t packed = size - size % W;
+
+      for(std::size_t i = 0; i < packed; i += W)
+      {
+        store_lanes(f(load_lanes<W>(first + i)), result + i);
+      }
+
+      batch_generic(first + packed, size - packed, result + packed, f);
+    }
+
+    template<std::size_t W, typename T, typename P, typename F>
+    void batch_packed(const ValueWithError<T, P>* first1, const ValueWithError<T, P>* first2, std::size_t size,
+                      ValueWithError<T, P>* result, F& f)
+    {
+      const std::size_t packed = size - size % W;
+
+      for(std::size_t i = 0; i < packed; i += W)
+      {
+        store_lanes(f(load_lanes<W>(first1 + i), load_lanes<W>(first2 + i)), result + i);
+      }
+
+      batch_generic(first1 + packed, first2 + packed, size - packed, result + packed, f);
+    }
+
+#ifdef HAS_CPU_DISPATCH
+    template<typename T, typename P, typename F>
+    CPU_DISPATCH_TARGET("sse2")
+    void batch_sse2(const ValueWithError<T, P>* first, std::size_t size, ValueWithError<T, P>* result, F& f)
+    {
+      batch_packed<lanes_per_register<T, 16>::value>(first, size, result, f);
+    }
+
+    template<typename T, typename P, typename F>
+    CPU_DISPATCH_TARGET("avx2,fma")
+    void batch_avx2(const ValueWithError<T, P>* first, std::size_t size, ValueWithError<T, P>* result, F& f)
+    {
+      batch_packed<lanes_per_register<T, 32>::value>(first, size, result, f);
+    }
+
+    template<typename T, typename P, typename F>
+    CPU_DISPATCH_TARGET("avx512f")
+    void batch_avx512(const ValueWithError<T, P>* first, std::size_t size, ValueWithError<T, P>* result, F& f)
+    {
+      batch_packed<lanes_per_register<T, 64>::value>(first, size, result, f);
+    }
+
+    template<typename T, typename P, typename F>
+    CPU_DISPATCH_TARGET("sse2")
+    void batch_sse2(const ValueWithError<T, P>* first1, const ValueWithError<T, P>* first2, std::size_t size,
+                    ValueWithError<T, P>* result, F& f)
+    {
+      batch_packed<lanes_per_register<T, 16>::value>(first1, first2, size, result, f);
+    }
+
+    template<typename T, typename P, typename F>
+    CPU_DISPATCH_TARGET("avx2,fma")
+    void batch_avx2(const ValueWithError<T, P>* first1, const ValueWithError<T, P>* first2, std::size_t size,
+                    ValueWithError<T, P>* result, F& f)
+    {
+      batch_packed<lanes_per_register<T, 32>::value>(first1, first2, size, result, f);
+    }
+
+    template<typename T, typename P, typename F>
+    CPU_DISPATCH_TARGET("avx512f")
+    void batch_avx512(const ValueWithError<T, P>* first1, const ValueWithError<T, P>* first2, std::size_t size,
+                      ValueWithError<T, P>* result, F& f)
+    {
+      batch_packed<lanes_per_register<T, 64>::value>(first1, first2, size, result, f);
+    }
+#endif // HAS_CPU_DISPATCH
+
+  } // namespace detail
+
+  /**@name Instruction set selection
+   *@{
+   */
+
+  /// Widest instruction set supported by the CPU, detected once
+  inline InstructionSet detected_instruction_set()
+  {
+    static const InstructionSet isa = detail::detect_instruction_set();
+    return isa;
+  }
+
+  /** @brief Instruction set used by batch_transform(), selected once
+   *
+   * The detected instruction set, unless the environment variable ERROR_PROPAGATION_ISA requests a narrower one
+   * with one of generic, sse2, avx2 or avx512, e.g. to compare results between machines. Unknown and unsupported
+   * requests are ignored.
+   */
+  inline InstructionSet active_instruction_set()
+  {
+    static const InstructionSet isa = detail::select_instruction_set(std::getenv("ERROR_PROPAGATION_ISA"),
+                                                                     detected_instruction_set());
+    return isa;
+  }
+
+  inline const char* instruction_set_name(InstructionSet isa)
+  {
+    switch(isa)
+    {
+      case InstructionSet::SSE2:
+        return "sse2";
+      case InstructionSet::AVX2:
+        return "avx2";
+      case InstructionSet::AVX512:
+        return "avx512";
+      default:
+        return "generic";
+    }
+  }
+  ///@}
+
+  /**@name Batch kernels
+   *
+   * Apply f to every element of contiguous arrays, like std::transform. f must accept ValueWithError<T, P> and
+   * ValueWithError<SimdPack<T, W>, P> for any W, e.g. a function object with a template operator() that only uses
+   * ValueWithError operators and math functions. Except for the Generic level, W consecutive elements are
+   * processed as one ValueWithError<SimdPack<T, W>, P>, where W fills a register of the instruction set, and the
+   * code is compiled for that instruction set. result may be equal to the first input.
+   *
+   * @code{cpp}
+     struct Kernel
+     {
+       template<typename V>
+       V operator()(const V& a, const V& b) const { return a * b + exp(a); }
+     };
+
+     batch_transform(a.data(), a.data() + a.size(), b.data(), result.data(), Kernel());
+     @endcode
+   *@{
+   */
+
+  /// Unary kernel with an explicit instruction set, limited to the detected one
+  template<typename T, typename P, typename F>
+  void batch_transform(InstructionSet isa, const ValueWithError<T, P>* first, const ValueWithError<T, P>* last,
+                       ValueWithError<T, P>* result, F f)
+  {
+    const std::size_t size = static_cast<std::size_t>(last - first);
+
+    switch(std::min(isa, detected_instruction_set()))
+    {
+#ifdef HAS_CPU_DISPATCH
+      case InstructionSet::AVX512:
+        detail::batch_avx512(first, size, result, f);
+        break;
+      case InstructionSet::AVX2:
+        detail::batch_avx2(first, size, result, f);
+        break;
+      case InstructionSet::SSE2:
+        detail::batch_sse2(first, size, result, f);
+        break;
+#endif // HAS_CPU_DISPATCH
+      default:
+        detail::batch_generic(first, size, result, f);
+        break;
+    }
+  }
+
+  /// Binary kernel with an explicit instruction set, limited to the detected one
+  template<typename T, typename P, typename F>
+  void batch_transform(InstructionSet isa, const ValueWithError<T, P>* first1, const ValueWithError<T, P>* last1,
+                       const ValueWithError<T, P>* first2, ValueWithError<T, P>* result, F f)
+  {
+    const std::size_t size = static_cast<std::size_t>(last1 - first1);
+
+    switch(std::min(isa, detected_instruction_set()))
+    {
+#ifdef HAS_CPU_DISPATCH
+      case InstructionSet::AVX512:
+        detail::batch_avx512(first1, first2, size, result, f);
+        break;
+      case InstructionSet::AVX2:
+        detail::batch_avx2(first1, first2, size, result, f);
+        break;
+      case InstructionSet::SSE2:
+        detail::batch_sse2(first1, first2, size, result, f);
+        break;
+#endif // HAS_CPU_DISPATCH
+      default:
+        detail::batch_generic(first1, first2, size, result, f);
+        break;
+    }
+  }
+
+  /// Unary kernel with active_instruction_set()
+  template<typename T, typename P, typename F>
+  void batch_transform(const ValueWithError<T, P>* first, const ValueWithError<T, P>* last, ValueWithError<T, P>* result, F f)
+  {
+    batch_transform(active_instruction_set(), first, last, result, f);
+  }
+
+  /// Binary kernel with active_instruction_set()
+  template<typename T, typename P, typename F>
+  void batch_transform(const ValueWithError<T, P>* first1, const ValueWithError<T, P>* last1,
+                       const ValueWithError<T, P>* first2, ValueWithError<T, P>* result, F f)
+  {
+    batch_transform(active_instruction_set(), first1, last1, first2, result, f);
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // CPU_DISPATCH_HPP
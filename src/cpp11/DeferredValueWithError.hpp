@@ -0,0 +1,798 @@
+#ifndef DEFERRED_VALUE_WITH_ERROR_HPP
+#define DEFERRED_VALUE_WITH_ERROR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "ValueWithError.hpp"
+#include "DetailOpcodes.hpp"
+
+namespace error_propagation {
+
+  template<typename T, typename P>
+  class DeferredValueWithError;
+
+  /** @brief Reusable arena recording the operations on DeferredValueWithError objects
+   *
+   * Every operation appends one node holding the opcode, the operand indices and the resulting value. Errors
+   * are only computed in GetError(), which walks the nodes the requested result depends on and replays them
+   * with the ValueWithError overloads. Computed errors are memoized in separate arrays which are only allocated
+   * on the first GetError() call, results which are never asked for their error don't cost any error arithmetic
+   * and recording stays a single append of a small node.
+   *
+   * Clear() removes all nodes but keeps the allocated memory, all DeferredValueWithError objects of the tape
+   * are invalid afterwards.
+   *
+   * @code{cpp}
+     DeferredTape<double> tape;
+     for(...)
+     {
+       tape.Clear();
+       auto x = tape.Input(make_value(2.0, 0.1));
+       auto y = exp(x) * 3.0 + x;            // values only
+       if(accepted)
+         std::cout << y.GetError();          // error is computed here
+     }
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class DeferredTape
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef std::size_t size_type;
+
+    // 32bit indices keep a node at 32 bytes for double
+    typedef std::uint32_t index_type;
+
+    /// Recorded operation, constant holds the constant operand or the error of an input
+    struct Node
+    {
+      detail::Opcode op;
+      detail::Operands operands;
+      index_type lhs;
+      index_type rhs;
+      T constant;
+      T value;
+    };
+
+    ///@name Constructor
+    ///@{
+    DeferredTape()
+    {}
+
+    explicit DeferredTape(size_type capacity)
+    {
+      Reserve(capacity);
+    }
+
+    DeferredTape(const DeferredTape<T, P>&) = delete;
+    DeferredTape<T, P>& operator=(const DeferredTape<T, P>&) = delete;
+    ///@}
+
+    ///@name Inputs
+    ///@{
+    DeferredValueWithError<T, P> Input(const ValueWithError<T, P>& v)
+    {
+      // the error of an input is stored in the constant
+      return Record(detail::Opcode::Input, detail::Operands::None, 0, 0, v.GetError(), v.GetValue());
+    }
+
+    DeferredValueWithError<T, P> Input(const T& value, const T& error)
+    {
+      return Input(ValueWithError<T, P>(value, error));
+    }
+    ///@}
+
+    /// Number of recorded nodes
+    size_type size() const
+    {
+      return m_nodes.size();
+    }
+
+    size_type capacity() const
+    {
+      return m_nodes.capacity();
+    }
+
+    void Reserve(size_type capacity)
+    {
+      assert(capacity <= std::numeric_limits<index_type>::max());
+      m_nodes.reserve(capacity);
+    }
+
+    /// Remove all nodes, the memory is kept for the next round
+    void Clear()
+    {
+      Truncate(0);
+    }
+
+    /** @brief Remove all nodes recorded after the first size nodes
+     *
+     * Allows to record the inputs once and discard only the operations on them, the DeferredValueWithError
+     * objects of the remaining nodes stay valid.
+     */
+    void Truncate(size_type size)
+    {
+      assert(size <= m_nodes.size());
+      m_nodes.resize(size);
+
+      if(m_known.size() > size)
+      {
+        m_known.resize(size);
+        m_errors.resize(size);
+      }
+
+      m_stack.clear();
+    }
+
+    /// Recorded node at index, e.g. for compiling the recorded operations
+    const Node& GetNode(size_type index) const
+    {
+      assert(index < m_nodes.size());
+      return m_nodes[index];
+    }
+
+    /// Value of the node at index
+    T GetValue(size_type index) const
+    {
+      assert(index < m_nodes.size());
+      return m_nodes[index].value;
+    }
+
+    /// Error of the node at index, computes the errors of all nodes it depends on which are not yet known
+    /// Returned by value, as recording or materializing further nodes reallocates the errors
+    T GetError(size_type index)
+    {
+      assert(index < m_nodes.size());
+
+      if(m_known.size() < m_nodes.size())
+      {
+        m_known.resize(m_nodes.size(), false);
+        m_errors.resize(m_nodes.size());
+      }
+
+      if(!m_known[index])
+      {
+        Materialize(index);
+      }
+
+      return m_errors[index];
+    }
+
+    ///@name Recording, used by the operators and math functions of DeferredValueWithError
+    ///@{
+    DeferredValueWithError<T, P> RecordUnary(detail::Opcode op, size_type arg, const T& value)
+    {
+      assert(arg < m_nodes.size());
+      return Record(op, detail::Operands::Unary, arg, 0, T(), value);
+    }
+
+    DeferredValueWithError<T, P> RecordBinary(detail::Opcode op, size_type lhs, size_type rhs, const T& value)
+    {
+      assert(lhs < m_nodes.size() && rhs < m_nodes.size());
+      return Record(op, detail::Operands::Both, lhs, rhs, T(), value);
+    }
+
+    DeferredValueWithError<T, P> RecordConstantLhs(detail::Opcode op, const T& lhs, size_type rhs, const T& value)
+    {
+      assert(rhs < m_nodes.size());
+      return Record(op, detail::Operands::ConstantLhs, 0, rhs, lhs, value);
+    }
+
+    DeferredValueWithError<T, P> RecordConstantRhs(detail::Opcode op, size_type lhs, const T& rhs, const T& value)
+    {
+      assert(lhs < m_nodes.size());
+      return Record(op, detail::Operands::ConstantRhs, lhs, 0, rhs, value);
+    }
+    ///@}
+
+  private:
+
+    typedef ValueWithError<T, P> VT;
+
+    DeferredValueWithError<T, P> Record(detail::Opcode op, detail::Operands operands, size_type lhs, size_type rhs, const T& constant, const T& value)
+    {
+      assert(m_nodes.size() < std::numeric_limits<index_type>::max());
+      m_nodes.push_back(Node{op, operands, static_cast<index_type>(lhs), static_cast<index_type>(rhs), constant, value});
+      return DeferredValueWithError<T, P>(*this, m_nodes.size() - 1, value);
+    }
+
+    bool LhsKnown(const Node& node) const
+    {
+      if(node.operands == detail::Operands::Unary || node.operands == detail::Operands::Both || node.operands == detail::Operands::ConstantRhs)
+      {
+        return m_known[node.lhs];
+      }
+
+      return true;
+    }
+
+    bool RhsKnown(const Node& node) const
+    {
+      if(node.operands == detail::Operands::Both || node.operands == detail::Operands::ConstantLhs)
+      {
+        return m_known[node.rhs];
+      }
+
+      return true;
+    }
+
+    VT Operand(size_type index) const
+    {
+      return VT(m_nodes[index].value, m_errors[index]);
+    }
+
+    /// Replays the node with ValueWithError, all operand errors must be known
+    T Evaluate(const Node& node) const
+    {
+      switch(node.operands)
+      {
+        case detail::Operands::Unary:
+          return detail::apply_unary(node.op, Operand(node.lhs)).GetError();
+        case detail::Operands::Both:
+          return detail::apply_binary<VT>(node.op, Operand(node.lhs), Operand(node.rhs)).GetError();
+        case detail::Operands::ConstantLhs:
+          return detail::apply_binary<VT>(node.op, node.constant, Operand(node.rhs)).GetError();
+        case detail::Operands::ConstantRhs:
+          return detail::apply_binary<VT>(node.op, Operand(node.lhs), node.constant).GetError();
+        default:
+          return node.constant;
+      }
+    }
+
+    /// Depth first traversal without recursion, so that long chains don't overflow the stack
+    void Materialize(size_type index)
+    {
+      m_stack.push_back(index);
+
+      while(!m_stack.empty())
+      {
+        const size_type i = m_stack.back();
+        const Node& node = m_nodes[i];
+
+        if(m_known[i])
+        {
+          m_stack.pop_back();
+          continue;
+        }
+
+        const bool lhsKnown = LhsKnown(node);
+        const bool rhsKnown = RhsKnown(node);
+
+        if(!lhsKnown)
+        {
+          m_stack.push_back(node.lhs);
+        }
+
+        if(!rhsKnown)
+        {
+          m_stack.push_back(node.rhs);
+        }
+
+        if(lhsKnown && rhsKnown)
+        {
+          m_errors[i] = Evaluate(node);
+          m_known[i] = true;
+          m_stack.pop_back();
+        }
+      }
+    }
+
+    std::vector<Node> m_nodes;
+    std::vector<T> m_errors;
+    std::vector<bool> m_known;
+    std::vector<size_type> m_stack;
+  };
+
+  /** @brief Value with error whose error is computed on demand
+   *
+   * The value is computed immediately, the operation is recorded on the DeferredTape of the operands. The
+   * error is computed by GetError() and is identical to the error of the same expression evaluated with
+   * ValueWithError<T, P>. All recorded operands of an operation must belong to the same tape.
+   *
+   * Supported are the arithmetic operators and all math overloads of ValueWithError, the other operand can be
+   * a DeferredValueWithError or an arithmetic type. Comparisons are not provided as the comparison policies need
+   * the errors, compare GetValue() or ToValueWithError() instead.
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class DeferredValueWithError
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef DeferredTape<T, P> tape_type;
+    typedef typename tape_type::size_type size_type;
+
+    DeferredValueWithError(tape_type& tape, size_type index, const T& value)
+      :
+      m_tape(&tape),
+      m_index(index),
+      m_value(value)
+    {}
+
+    ///@name Getters
+    ///@{
+    const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    /// Computes the error if it is not yet known
+    T GetError() const
+    {
+      return m_tape->GetError(m_index);
+    }
+
+    ValueWithError<T, P> ToValueWithError() const
+    {
+      return ValueWithError<T, P>(m_value, GetError());
+    }
+
+    tape_type& GetTape() const
+    {
+      return *m_tape;
+    }
+
+    /// Position on the tape
+    size_type GetIndex() const
+    {
+      return m_index;
+    }
+    ///@}
+
+    ///@name Arithmetic operators
+    ///@{
+    template<typename U>
+    DeferredValueWithError<T, P>&
+    operator*=(const U& rhs)
+    {
+      *this = (*this) * rhs;
+      return *this;
+    }
+
+    template<typename U>
+    DeferredValueWithError<T, P>&
+    operator/=(const U& rhs)
+    {
+      *this = (*this) / rhs;
+      return *this;
+    }
+
+    template<typename U>
+    DeferredValueWithError<T, P>&
+    operator+=(const U& rhs)
+    {
+      *this = (*this) + rhs;
+      return *this;
+    }
+
+    template<typename U>
+    DeferredValueWithError<T, P>&
+    operator-=(const U& rhs)
+    {
+      *this = (*this) - rhs;
+      return *this;
+    }
+    ///@}
+
+  private:
+    tape_type* m_tape;
+    size_type m_index;
+    T m_value;
+  };
+
+  namespace detail {
+
+    template<typename T, typename P>
+    DeferredValueWithError<T, P>
+    deferred_binary(Opcode op, const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+    {
+      assert(&lhs.GetTape() == &rhs.GetTape());
+      return lhs.GetTape().RecordBinary(op, lhs.GetIndex(), rhs.GetIndex(), apply_binary<T>(op, lhs.GetValue(), rhs.GetValue()));
+    }
+
+    template<typename T, typename P>
+    DeferredValueWithError<T, P>
+    deferred_binary(Opcode op, const T& lhs, const DeferredValueWithError<T, P>& rhs)
+    {
+      return rhs.GetTape().RecordConstantLhs(op, lhs, rhs.GetIndex(), apply_binary<T>(op, lhs, rhs.GetValue()));
+    }
+
+    template<typename T, typename P>
+    DeferredValueWithError<T, P>
+    deferred_binary(Opcode op, const DeferredValueWithError<T, P>& lhs, const T& rhs)
+    {
+      return lhs.GetTape().RecordConstantRhs(op, lhs.GetIndex(), rhs, apply_binary<T>(op, lhs.GetValue(), rhs));
+    }
+
+    template<typename T, typename P>
+    DeferredValueWithError<T, P>
+    deferred_unary(Opcode op, const DeferredValueWithError<T, P>& v)
+    {
+      return v.GetTape().RecordUnary(op, v.GetIndex(), apply_unary(op, v.GetValue()));
+    }
+
+  } // namespace detail
+
+  /**@name Arithmetic operator definitions
+   *@{
+   */
+  /// Product. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  operator*(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Multiply, lhs, rhs);
+  }
+
+  /// Product. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  operator*(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Multiply, lhs, static_cast<T>(rhs));
+  }
+
+  /// Product. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  operator*(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Multiply, static_cast<T>(lhs), rhs);
+  }
+
+  /// Division. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  operator/(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Divide, lhs, rhs);
+  }
+
+  /// Division. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  operator/(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Divide, lhs, static_cast<T>(rhs));
+  }
+
+  /// Division. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  operator/(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Divide, static_cast<T>(lhs), rhs);
+  }
+
+  /// Addition. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  operator+(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Plus, lhs, rhs);
+  }
+
+  /// Addition. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  operator+(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Plus, lhs, static_cast<T>(rhs));
+  }
+
+  /// Addition. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  operator+(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Plus, static_cast<T>(lhs), rhs);
+  }
+
+  /// Subtraction. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  operator-(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Minus, lhs, rhs);
+  }
+
+  /// Subtraction. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  operator-(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Minus, lhs, static_cast<T>(rhs));
+  }
+
+  /// Subtraction. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  operator-(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Minus, static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+  /**@name Math function overloads
+   *
+   * Same set of functions as for ValueWithError.
+   *@{
+   */
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  abs(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Abs, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  acos(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Acos, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  acosh(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Acosh, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  asin(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Asin, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  asinh(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Asinh, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  atan(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Atan, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  atanh(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Atanh, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  cbrt(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Cbrt, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  cos(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Cos, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  cosh(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Cosh, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  erf(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Erf, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  erfc(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Erfc, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  exp(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Exp, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  exp2(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Exp2, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  expm1(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Expm1, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  fabs(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Fabs, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  lgamma(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Lgamma, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  log(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Log, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  log10(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Log10, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  log1p(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Log1p, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  log2(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Log2, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  sin(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Sin, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  sinh(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Sinh, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  sqrt(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Sqrt, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  tan(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Tan, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  tanh(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Tanh, v);
+  }
+
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  tgamma(const DeferredValueWithError<T, P>& v)
+  {
+    return detail::deferred_unary(detail::Opcode::Tgamma, v);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  atan2(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Atan2, lhs, rhs);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  atan2(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Atan2, lhs, static_cast<T>(rhs));
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  atan2(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Atan2, static_cast<T>(lhs), rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  hypot(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Hypot, lhs, rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  hypot(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Hypot, lhs, static_cast<T>(rhs));
+  }
+
+  /// Square root of the sum of the squares. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  hypot(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Hypot, static_cast<T>(lhs), rhs);
+  }
+
+  /// Raises a number to the given power. Overload for two DeferredValueWithError arguments.
+  template<typename T, typename P>
+  DeferredValueWithError<T, P>
+  pow(const DeferredValueWithError<T, P>& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Pow, lhs, rhs);
+  }
+
+  /// Raises a number to the given power. Overload for a DeferredValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, DeferredValueWithError<T, P> >::type
+  pow(const DeferredValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Pow, lhs, static_cast<T>(rhs));
+  }
+
+  /// Raises a number to the given power. Overload for an arithmetic type and a DeferredValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, DeferredValueWithError<T, P> >::type
+  pow(const U& lhs, const DeferredValueWithError<T, P>& rhs)
+  {
+    return detail::deferred_binary(detail::Opcode::Pow, static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // DEFERRED_VALUE_WITH_ERROR_HPP
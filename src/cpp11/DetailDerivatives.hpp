@@ -0,0 +1,671 @@
+#ifndef DETAIL_DERIVATIVES_HPP
+#define DETAIL_DERIVATIVES_HPP
+
+#include <cmath>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/trigamma.hpp>
+
+#include "DetailOpcodes.hpp"
+
+namespace error_propagation {
+  namespace detail {
+
+    template<typename T>
+    T trigamma(const T& a)
+    {
+      return boost::math::trigamma(a, policy_errno_on_error());
+    }
+
+    /** @brief First and second derivatives of the functions behind the opcodes
+     *
+     * Unary opcodes provide `T first(const T& v)` and `T second(const T& v)`, binary ones
+     * `void first(lhs, rhs, dlhs, drhs)` with the partial derivatives with respect to both arguments and
+     * `void second(lhs, rhs, dll, drr, dlr)` with the second partial derivatives. Contrary to the error formulas
+     * of the ValueWithError overloads the derivatives keep their sign, which is required for combining them by
+     * the chain rule.
+     */
+    template<Opcode op>
+    struct derivative;
+
+    template<>
+    struct derivative<Opcode::Multiply>
+    {
+      template<typename T>
+      static void first(const T& lhs, const T& rhs, T& dlhs, T& drhs)
+      {
+        dlhs = rhs;
+        drhs = lhs;
+      }
+
+      template<typename T>
+      static void second(const T& /* lhs */, const T& /* rhs */, T& dll, T& drr, T& dlr)
+      {
+        dll = T();
+        drr = T();
+        dlr = T(1);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Divide>
+    {
+      template<typename T>
+      static void first(const T& lhs, const T& rhs, T& dlhs, T& drhs)
+      {
+        dlhs = T(1) / rhs;
+        drhs = -lhs / (rhs * rhs);
+      }
+
+      template<typename T>
+      static void second(const T& lhs, const T& rhs, T& dll, T& drr, T& dlr)
+      {
+        dll = T();
+        drr = T(2) * lhs / (rhs * rhs * rhs);
+        dlr = T(-1) / (rhs * rhs);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Plus>
+    {
+      template<typename T>
+      static void first(const T& /* lhs */, const T& /* rhs */, T& dlhs, T& drhs)
+      {
+        dlhs = T(1);
+        drhs = T(1);
+      }
+
+      template<typename T>
+      static void second(const T& /* lhs */, const T& /* rhs */, T& dll, T& drr, T& dlr)
+      {
+        dll = T();
+        drr = T();
+        dlr = T();
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Minus>
+    {
+      template<typename T>
+      static void first(const T& /* lhs */, const T& /* rhs */, T& dlhs, T& drhs)
+      {
+        dlhs = T(1);
+        drhs = T(-1);
+      }
+
+      template<typename T>
+      static void second(const T& /* lhs */, const T& /* rhs */, T& dll, T& drr, T& dlr)
+      {
+        dll = T();
+        drr = T();
+        dlr = T();
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Atan2>
+    {
+      template<typename T>
+      static void first(const T& lhs, const T& rhs, T& dlhs, T& drhs)
+      {
+        const T norm = lhs * lhs + rhs * rhs;
+        dlhs = rhs / norm;
+        drhs = -lhs / norm;
+      }
+
+      template<typename T>
+      static void second(const T& lhs, const T& rhs, T& dll, T& drr, T& dlr)
+      {
+        const T norm = lhs * lhs + rhs * rhs;
+        dll = T(-2) * lhs * rhs / (norm * norm);
+        drr = -dll;
+        dlr = (lhs * lhs - rhs * rhs) / (norm * norm);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Hypot>
+    {
+      template<typename T>
+      static void first(const T& lhs, const T& rhs, T& dlhs, T& drhs)
+      {
+        const T h = hypot(lhs, rhs);
+        dlhs = lhs / h;
+        drhs = rhs / h;
+      }
+
+      template<typename T>
+      static void second(const T& lhs, const T& rhs, T& dll, T& drr, T& dlr)
+      {
+        const T h = hypot(lhs, rhs);
+        const T h3 = h * h * h;
+        dll = rhs * rhs / h3;
+        drr = lhs * lhs / h3;
+        dlr = -lhs * rhs / h3;
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Pow>
+    {
+      template<typename T>
+      static void first(const T& lhs, const T& rhs, T& dlhs, T& drhs)
+      {
+        using std::log;
+        using std::pow;
+        const T p = pow(lhs, rhs);
+        dlhs = rhs * pow(lhs, rhs - T(1));
+        drhs = log(lhs) * p;
+      }
+
+      template<typename T>
+      static void second(const T& lhs, const T& rhs, T& dll, T& drr, T& dlr)
+      {
+        using std::log;
+        using std::pow;
+        const T l = log(lhs);
+        const T p = pow(lhs, rhs);
+        const T q = pow(lhs, rhs - T(1));
+        dll = rhs * (rhs - T(1)) * pow(lhs, rhs - T(2));
+        drr = l * l * p;
+        dlr = q * (T(1) + rhs * l);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Abs>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return v < T() ? T(-1) : T(1);
+      }
+
+      template<typename T>
+      static T second(const T& /* v */)
+      {
+        return T();
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Acos>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sqrt;
+        return T(-1) / sqrt(T(1) - v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sqrt;
+        const T s = T(1) - v * v;
+        return -v / (s * sqrt(s));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Acosh>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sqrt;
+        return T(1) / sqrt(v * v - T(1));
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sqrt;
+        const T s = v * v - T(1);
+        return -v / (s * sqrt(s));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Asin>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sqrt;
+        return T(1) / sqrt(T(1) - v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sqrt;
+        const T s = T(1) - v * v;
+        return v / (s * sqrt(s));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Asinh>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sqrt;
+        return T(1) / sqrt(T(1) + v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sqrt;
+        const T s = T(1) + v * v;
+        return -v / (s * sqrt(s));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Atan>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return T(1) / (T(1) + v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        const T s = T(1) + v * v;
+        return T(-2) * v / (s * s);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Atanh>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return T(1) / (T(1) - v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        const T s = T(1) - v * v;
+        return T(2) * v / (s * s);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Cbrt>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::cbrt;
+        return T(1) / (T(3) * cbrt(v * v));
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::cbrt;
+        return T(-2) / (T(9) * v * cbrt(v * v));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Cos>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sin;
+        return -sin(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::cos;
+        return -cos(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Cosh>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sinh;
+        return sinh(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::cosh;
+        return cosh(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Erf>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::exp;
+        using boost::math::constants::root_pi;
+        return T(2) / root_pi<T>() * exp(-v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::exp;
+        using boost::math::constants::root_pi;
+        return T(-4) * v / root_pi<T>() * exp(-v * v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Erfc>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::exp;
+        using boost::math::constants::root_pi;
+        return T(-2) / root_pi<T>() * exp(-v * v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::exp;
+        using boost::math::constants::root_pi;
+        return T(4) * v / root_pi<T>() * exp(-v * v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Exp>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::exp;
+        return exp(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::exp;
+        return exp(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Exp2>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::exp2;
+        using boost::math::constants::ln_two;
+        return ln_two<T>() * exp2(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::exp2;
+        using boost::math::constants::ln_two;
+        return ln_two<T>() * ln_two<T>() * exp2(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Expm1>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::exp;
+        return exp(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::exp;
+        return exp(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Fabs>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return v < T() ? T(-1) : T(1);
+      }
+
+      template<typename T>
+      static T second(const T& /* v */)
+      {
+        return T();
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Lgamma>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return digamma(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        return trigamma(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Log>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return T(1) / v;
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        return T(-1) / (v * v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Log10>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using boost::math::constants::ln_ten;
+        return T(1) / (v * ln_ten<T>());
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using boost::math::constants::ln_ten;
+        return T(-1) / (v * v * ln_ten<T>());
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Log1p>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        return T(1) / (T(1) + v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        return T(-1) / ((T(1) + v) * (T(1) + v));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Log2>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using boost::math::constants::ln_two;
+        return T(1) / (v * ln_two<T>());
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using boost::math::constants::ln_two;
+        return T(-1) / (v * v * ln_two<T>());
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Sin>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::cos;
+        return cos(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sin;
+        return -sin(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Sinh>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::cosh;
+        return cosh(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sinh;
+        return sinh(v);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Sqrt>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::sqrt;
+        return T(1) / (T(2) * sqrt(v));
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::sqrt;
+        return T(-1) / (T(4) * v * sqrt(v));
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Tan>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::cos;
+        const T c = cos(v);
+        return T(1) / (c * c);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::cos;
+        using std::tan;
+        const T c = cos(v);
+        return T(2) * tan(v) / (c * c);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Tanh>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::cosh;
+        const T c = cosh(v);
+        return T(1) / (c * c);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::cosh;
+        using std::tanh;
+        const T c = cosh(v);
+        return T(-2) * tanh(v) / (c * c);
+      }
+    };
+
+    template<>
+    struct derivative<Opcode::Tgamma>
+    {
+      template<typename T>
+      static T first(const T& v)
+      {
+        using std::tgamma;
+        return digamma(v) * tgamma(v);
+      }
+
+      template<typename T>
+      static T second(const T& v)
+      {
+        using std::tgamma;
+        const T psi = digamma(v);
+        return (psi * psi + trigamma(v)) * tgamma(v);
+      }
+    };
+
+  } // namespace detail
+} // namespace error_propagation
+
+#endif // DETAIL_DERIVATIVES_HPP
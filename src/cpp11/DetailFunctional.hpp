@@ -0,0 +1,47 @@
+#ifndef DETAIL_FUNCTIONAL_HPP
+#define DETAIL_FUNCTIONAL_HPP
+
+namespace error_propagation {
+  namespace detail {
+
+    // Function objects for the element-wise operations, these forward to the ValueWithError operators
+    struct multiplies
+    {
+      template<typename U, typename V>
+      auto operator()(const U& lhs, const V& rhs) const -> decltype(lhs * rhs)
+      {
+        return lhs * rhs;
+      }
+    };
+
+    struct divides
+    {
+      template<typename U, typename V>
+      auto operator()(const U& lhs, const V& rhs) const -> decltype(lhs / rhs)
+      {
+        return lhs / rhs;
+      }
+    };
+
+    struct plus
+    {
+      template<typename U, typename V>
+      auto operator()(const U& lhs, const V& rhs) const -> decltype(lhs + rhs)
+      {
+        return lhs + rhs;
+      }
+    };
+
+    struct minus
+    {
+      template<typename U, typename V>
+      auto operator()(const U& lhs, const V& rhs) const -> decltype(lhs - rhs)
+      {
+        return lhs - rhs;
+      }
+    };
+
+  } // namespace detail
+} // namespace error_propagation
+
+#endif // DETAIL_FUNCTIONAL_HPP
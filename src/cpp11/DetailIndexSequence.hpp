@@ -0,0 +1,33 @@
+#ifndef DETAIL_INDEX_SEQUENCE_HPP
+#define DETAIL_INDEX_SEQUENCE_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace error_propagation {
+  namespace detail {
+
+    /// C++11 replacement for std::index_sequence
+    template<std::size_t... I>
+    struct index_sequence
+    {};
+
+    template<std::size_t N, std::size_t... I>
+    struct make_index_sequence : make_index_sequence<N - 1, N - 1, I...>
+    {};
+
+    template<std::size_t... I>
+    struct make_index_sequence<0, I...> : index_sequence<I...>
+    {};
+
+    /// Calls f with the elements of point as separate arguments
+    template<typename F, typename T, std::size_t N, std::size_t... I>
+    T call_with_array(F& f, const std::array<T, N>& point, index_sequence<I...>)
+    {
+      return f(point[I]...);
+    }
+
+  } // namespace detail
+} // namespace error_propagation
+
+#endif // DETAIL_INDEX_SEQUENCE_HPP
@@ -0,0 +1,683 @@
+#ifndef DETAIL_OPCODES_HPP
+#define DETAIL_OPCODES_HPP
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+#include "ValueWithError.hpp"
+
+namespace error_propagation {
+  namespace detail {
+
+    /** @brief Operations which can be recorded and replayed later
+     *
+     * The opcodes cover all arithmetic operators and math overloads of ValueWithError. opcode_function,
+     * apply_unary() and apply_binary() evaluate an opcode for plain values as well as for ValueWithError objects
+     * and then resolve to exactly the same functions as writing the expression directly.
+     */
+    enum class Opcode : unsigned char
+    {
+      Input,
+      Multiply,
+      Divide,
+      Plus,
+      Minus,
+      Atan2,
+      Hypot,
+      Pow,
+      Abs,
+      Acos,
+      Acosh,
+      Asin,
+      Asinh,
+      Atan,
+      Atanh,
+      Cbrt,
+      Cos,
+      Cosh,
+      Erf,
+      Erfc,
+      Exp,
+      Exp2,
+      Expm1,
+      Fabs,
+      Lgamma,
+      Log,
+      Log10,
+      Log1p,
+      Log2,
+      Sin,
+      Sinh,
+      Sqrt,
+      Tan,
+      Tanh,
+      Tgamma
+    };
+
+    /// Enables overloads for a plain arithmetic type V only, with result type R
+    template<typename V, typename R>
+    struct enable_if_arithmetic : std::enable_if<std::is_arithmetic<V>::value, R>
+    {};
+
+    /// Operands of a recorded operation
+    enum class Operands : unsigned char
+    {
+      None,        ///< Input, no operands
+      Unary,       ///< One operand
+      Both,        ///< Two recorded operands
+      ConstantLhs, ///< Constant left hand side and recorded right hand side
+      ConstantRhs  ///< Recorded left hand side and constant right hand side
+    };
+
+    CONSTEXPR inline bool is_binary(Opcode op)
+    {
+      return op >= Opcode::Multiply && op <= Opcode::Pow;
+    }
+
+    /** @brief Function object for each opcode
+     *
+     * Unary opcodes provide `A apply(const A&)`, binary ones `R apply<R>(const A&, const B&)` with the result type R.
+     * hypot resolves to detail::hypot for plain values, as used by the ValueWithError overloads for the value,
+     * and to the ValueWithError overloads via ADL otherwise.
+     */
+    template<Opcode op>
+    struct opcode_function;
+
+    template<>
+    struct opcode_function<Opcode::Multiply>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        return lhs * rhs;
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Divide>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        return lhs / rhs;
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Plus>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        return lhs + rhs;
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Minus>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        return lhs - rhs;
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Atan2>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        using std::atan2;
+        return atan2(lhs, rhs);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Hypot>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        return hypot(lhs, rhs);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Pow>
+    {
+      template<typename R, typename A, typename B>
+      static R apply(const A& lhs, const B& rhs)
+      {
+        using std::pow;
+        return pow(lhs, rhs);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Abs>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::abs;
+        return abs(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Acos>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::acos;
+        return acos(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Acosh>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::acosh;
+        return acosh(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Asin>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::asin;
+        return asin(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Asinh>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::asinh;
+        return asinh(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Atan>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::atan;
+        return atan(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Atanh>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::atanh;
+        return atanh(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Cbrt>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::cbrt;
+        return cbrt(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Cos>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::cos;
+        return cos(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Cosh>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::cosh;
+        return cosh(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Erf>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::erf;
+        return erf(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Erfc>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::erfc;
+        return erfc(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Exp>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::exp;
+        return exp(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Exp2>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::exp2;
+        return exp2(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Expm1>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::expm1;
+        return expm1(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Fabs>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::fabs;
+        return fabs(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Lgamma>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::lgamma;
+        return lgamma(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Log>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::log;
+        return log(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Log10>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::log10;
+        return log10(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Log1p>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::log1p;
+        return log1p(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Log2>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::log2;
+        return log2(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Sin>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::sin;
+        return sin(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Sinh>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::sinh;
+        return sinh(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Sqrt>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::sqrt;
+        return sqrt(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Tan>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::tan;
+        return tan(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Tanh>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::tanh;
+        return tanh(a);
+      }
+    };
+
+    template<>
+    struct opcode_function<Opcode::Tgamma>
+    {
+      template<typename A>
+      static A apply(const A& a)
+      {
+        using std::tgamma;
+        return tgamma(a);
+      }
+    };
+
+    /** @brief Calls visitor.Run<opcode_function<op>>() for a unary opcode
+     *
+     * Allows to select the function once and then run a loop with it.
+     */
+    template<typename Visitor>
+    void visit_unary(Opcode op, Visitor& visitor)
+    {
+      switch(op)
+      {
+        case Opcode::Abs:
+          visitor.template Run<opcode_function<Opcode::Abs> >();
+          break;
+        case Opcode::Acos:
+          visitor.template Run<opcode_function<Opcode::Acos> >();
+          break;
+        case Opcode::Acosh:
+          visitor.template Run<opcode_function<Opcode::Acosh> >();
+          break;
+        case Opcode::Asin:
+          visitor.template Run<opcode_function<Opcode::Asin> >();
+          break;
+        case Opcode::Asinh:
+          visitor.template Run<opcode_function<Opcode::Asinh> >();
+          break;
+        case Opcode::Atan:
+          visitor.template Run<opcode_function<Opcode::Atan> >();
+          break;
+        case Opcode::Atanh:
+          visitor.template Run<opcode_function<Opcode::Atanh> >();
+          break;
+        case Opcode::Cbrt:
+          visitor.template Run<opcode_function<Opcode::Cbrt> >();
+          break;
+        case Opcode::Cos:
+          visitor.template Run<opcode_function<Opcode::Cos> >();
+          break;
+        case Opcode::Cosh:
+          visitor.template Run<opcode_function<Opcode::Cosh> >();
+          break;
+        case Opcode::Erf:
+          visitor.template Run<opcode_function<Opcode::Erf> >();
+          break;
+        case Opcode::Erfc:
+          visitor.template Run<opcode_function<Opcode::Erfc> >();
+          break;
+        case Opcode::Exp:
+          visitor.template Run<opcode_function<Opcode::Exp> >();
+          break;
+        case Opcode::Exp2:
+          visitor.template Run<opcode_function<Opcode::Exp2> >();
+          break;
+        case Opcode::Expm1:
+          visitor.template Run<opcode_function<Opcode::Expm1> >();
+          break;
+        case Opcode::Fabs:
+          visitor.template Run<opcode_function<Opcode::Fabs> >();
+          break;
+        case Opcode::Lgamma:
+          visitor.template Run<opcode_function<Opcode::Lgamma> >();
+          break;
+        case Opcode::Log:
+          visitor.template Run<opcode_function<Opcode::Log> >();
+          break;
+        case Opcode::Log10:
+          visitor.template Run<opcode_function<Opcode::Log10> >();
+          break;
+        case Opcode::Log1p:
+          visitor.template Run<opcode_function<Opcode::Log1p> >();
+          break;
+        case Opcode::Log2:
+          visitor.template Run<opcode_function<Opcode::Log2> >();
+          break;
+        case Opcode::Sin:
+          visitor.template Run<opcode_function<Opcode::Sin> >();
+          break;
+        case Opcode::Sinh:
+          visitor.template Run<opcode_function<Opcode::Sinh> >();
+          break;
+        case Opcode::Sqrt:
+          visitor.template Run<opcode_function<Opcode::Sqrt> >();
+          break;
+        case Opcode::Tan:
+          visitor.template Run<opcode_function<Opcode::Tan> >();
+          break;
+        case Opcode::Tanh:
+          visitor.template Run<opcode_function<Opcode::Tanh> >();
+          break;
+        case Opcode::Tgamma:
+          visitor.template Run<opcode_function<Opcode::Tgamma> >();
+          break;
+        default:
+          assert(!"not a unary opcode");
+          break;
+      }
+    }
+
+    /// Calls visitor.Run<opcode_function<op>>() for a binary opcode
+    template<typename Visitor>
+    void visit_binary(Opcode op, Visitor& visitor)
+    {
+      switch(op)
+      {
+        case Opcode::Multiply:
+          visitor.template Run<opcode_function<Opcode::Multiply> >();
+          break;
+        case Opcode::Divide:
+          visitor.template Run<opcode_function<Opcode::Divide> >();
+          break;
+        case Opcode::Plus:
+          visitor.template Run<opcode_function<Opcode::Plus> >();
+          break;
+        case Opcode::Minus:
+          visitor.template Run<opcode_function<Opcode::Minus> >();
+          break;
+        case Opcode::Atan2:
+          visitor.template Run<opcode_function<Opcode::Atan2> >();
+          break;
+        case Opcode::Hypot:
+          visitor.template Run<opcode_function<Opcode::Hypot> >();
+          break;
+        case Opcode::Pow:
+          visitor.template Run<opcode_function<Opcode::Pow> >();
+          break;
+        default:
+          assert(!"not a binary opcode");
+          break;
+      }
+    }
+
+    /// Evaluate a unary opcode, for plain values the std functions and for ValueWithError the overloads are called
+    template<typename A>
+    A apply_unary(Opcode op, const A& a)
+    {
+      switch(op)
+      {
+        case Opcode::Abs:
+          return opcode_function<Opcode::Abs>::apply(a);
+        case Opcode::Acos:
+          return opcode_function<Opcode::Acos>::apply(a);
+        case Opcode::Acosh:
+          return opcode_function<Opcode::Acosh>::apply(a);
+        case Opcode::Asin:
+          return opcode_function<Opcode::Asin>::apply(a);
+        case Opcode::Asinh:
+          return opcode_function<Opcode::Asinh>::apply(a);
+        case Opcode::Atan:
+          return opcode_function<Opcode::Atan>::apply(a);
+        case Opcode::Atanh:
+          return opcode_function<Opcode::Atanh>::apply(a);
+        case Opcode::Cbrt:
+          return opcode_function<Opcode::Cbrt>::apply(a);
+        case Opcode::Cos:
+          return opcode_function<Opcode::Cos>::apply(a);
+        case Opcode::Cosh:
+          return opcode_function<Opcode::Cosh>::apply(a);
+        case Opcode::Erf:
+          return opcode_function<Opcode::Erf>::apply(a);
+        case Opcode::Erfc:
+          return opcode_function<Opcode::Erfc>::apply(a);
+        case Opcode::Exp:
+          return opcode_function<Opcode::Exp>::apply(a);
+        case Opcode::Exp2:
+          return opcode_function<Opcode::Exp2>::apply(a);
+        case Opcode::Expm1:
+          return opcode_function<Opcode::Expm1>::apply(a);
+        case Opcode::Fabs:
+          return opcode_function<Opcode::Fabs>::apply(a);
+        case Opcode::Lgamma:
+          return opcode_function<Opcode::Lgamma>::apply(a);
+        case Opcode::Log:
+          return opcode_function<Opcode::Log>::apply(a);
+        case Opcode::Log10:
+          return opcode_function<Opcode::Log10>::apply(a);
+        case Opcode::Log1p:
+          return opcode_function<Opcode::Log1p>::apply(a);
+        case Opcode::Log2:
+          return opcode_function<Opcode::Log2>::apply(a);
+        case Opcode::Sin:
+          return opcode_function<Opcode::Sin>::apply(a);
+        case Opcode::Sinh:
+          return opcode_function<Opcode::Sinh>::apply(a);
+        case Opcode::Sqrt:
+          return opcode_function<Opcode::Sqrt>::apply(a);
+        case Opcode::Tan:
+          return opcode_function<Opcode::Tan>::apply(a);
+        case Opcode::Tanh:
+          return opcode_function<Opcode::Tanh>::apply(a);
+        case Opcode::Tgamma:
+          return opcode_function<Opcode::Tgamma>::apply(a);
+        default:
+          assert(!"not a unary opcode");
+          return a;
+      }
+    }
+
+    /** @brief Evaluate a binary opcode
+     *
+     * @tparam R  Result type
+     */
+    template<typename R, typename A, typename B>
+    R apply_binary(Opcode op, const A& lhs, const B& rhs)
+    {
+      switch(op)
+      {
+        case Opcode::Multiply:
+          return opcode_function<Opcode::Multiply>::template apply<R>(lhs, rhs);
+        case Opcode::Divide:
+          return opcode_function<Opcode::Divide>::template apply<R>(lhs, rhs);
+        case Opcode::Plus:
+          return opcode_function<Opcode::Plus>::template apply<R>(lhs, rhs);
+        case Opcode::Minus:
+          return opcode_function<Opcode::Minus>::template apply<R>(lhs, rhs);
+        case Opcode::Atan2:
+          return opcode_function<Opcode::Atan2>::template apply<R>(lhs, rhs);
+        case Opcode::Hypot:
+          return opcode_function<Opcode::Hypot>::template apply<R>(lhs, rhs);
+        case Opcode::Pow:
+          return opcode_function<Opcode::Pow>::template apply<R>(lhs, rhs);
+        default:
+          assert(!"not a binary opcode");
+          return R();
+      }
+    }
+
+  } // namespace detail
+} // namespace error_propagation
+
+#endif // DETAIL_OPCODES_HPP
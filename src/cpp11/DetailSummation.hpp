@@ -0,0 +1,373 @@
+#ifndef DETAIL_SUMMATION_HPP
+#define DETAIL_SUMMATION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "ValueWithErrorDerivativePolicy.hpp" // for bits_of
+
+namespace error_propagation {
+  namespace detail {
+
+    // Running sums for SumAccumulator, selected by the summation policy. All of them provide Add(x), Merge(other)
+    // and Result(), the empty sum is zero.
+
+    /// Recursive summation
+    template<typename T>
+    class plain_sum
+    {
+    public:
+      plain_sum()
+        :
+        m_sum(0)
+      {}
+
+      void Add(const T& x)
+      {
+        m_sum = m_sum + x;
+      }
+
+      void Merge(const plain_sum& other)
+      {
+        m_sum = m_sum + other.m_sum;
+      }
+
+      T Result() const
+      {
+        return m_sum;
+      }
+
+    private:
+      T m_sum;
+    };
+
+    /// Neumaier's variant of Kahan summation, the rounding error of every addition is collected in a second sum.
+    /// The error bound is independent of the number of terms as long as that is below 1/epsilon.
+    template<typename T>
+    class neumaier_sum
+    {
+    public:
+      neumaier_sum()
+        :
+        m_sum(0),
+        m_compensation(0)
+      {}
+
+      void Add(const T& x)
+      {
+        using std::abs;
+        const T t = m_sum + x;
+
+        if(abs(m_sum) < abs(x))
+        {
+          m_compensation = m_compensation + ((x - t) + m_sum);
+        }
+        else
+        {
+          m_compensation = m_compensation + ((m_sum - t) + x);
+        }
+
+        m_sum = t;
+      }
+
+      void Merge(const neumaier_sum& other)
+      {
+        Add(other.m_sum);
+        m_compensation = m_compensation + other.m_compensation;
+      }
+
+      T Result() const
+      {
+        return m_sum + m_compensation;
+      }
+
+    private:
+      T m_sum;
+      T m_compensation;
+    };
+
+    /** @brief Sum of floats or doubles in bins with fixed binary boundaries, rounded once
+     *
+     * Every finite double is m 2^(p - 1074) with an integer mantissa m < 2^53 and the bit position p >= 0. Bin i
+     * collects the bits [32 i, 32 i + 32) of the magnitudes of the terms, each term is split at the fixed bin
+     * boundaries and adds to three neighbouring bins. The bins are int64_t with 31 spare bits, a second word per bin
+     * takes the overflow every 2^30 terms. Carries are never moved between bins, so every bin holds the exact sum of
+     * the parts of the terms within its bits, independent of their order or grouping into partial sums.
+     *
+     * Only a window of numBins bins ending with the highest bin of the largest term so far is kept. When a larger
+     * term moves the window up, the lowest bins are dropped as a whole. The window is determined by the largest term
+     * only, so the dropped parts are the same for any order as well. At least 148 bits below the leading bit of the
+     * largest term are kept, the result is the correctly rounded sum unless it is smaller than about n 2^-94 max|x|.
+     *
+     * Infinities and NaNs are summed separately and take precedence over the finite terms.
+     */
+    template<typename T>
+    class binned_sum
+    {
+      static_assert(std::numeric_limits<T>::is_iec559 && std::numeric_limits<T>::digits <= 53,
+                    "ReproducibleSummation requires float or double");
+
+    public:
+      binned_sum()
+        :
+        m_lowest(0),
+        m_numTerms(0),
+        m_nonFinite(0),
+        m_hasNonFinite(false)
+      {
+        for(int k = 0; k < numBins; k++)
+        {
+          m_bins[k] = 0;
+          m_carries[k] = 0;
+        }
+      }
+
+      void Add(const T& x)
+      {
+        const std::uint64_t bits = bits_of(static_cast<double>(x));
+        const int exponent = static_cast<int>(bits >> 52) & 0x7ff;
+        std::uint64_t mantissa = bits & 0x000fffffffffffffULL;
+
+        if(exponent == 0x7ff)
+        {
+          m_nonFinite = m_nonFinite + static_cast<double>(x);
+          m_hasNonFinite = true;
+          return;
+        }
+
+        // subnormals have the bit position 0 and no implicit bit
+        const int position = exponent == 0 ? 0 : exponent - 1;
+        if(exponent != 0)
+        {
+          mantissa |= 0x0010000000000000ULL;
+        }
+
+        const int bin = position / binBits;
+        const int shift = position % binBits;
+        if(bin + 2 >= m_lowest + numBins)
+        {
+          Shift(bin + 3 - numBins);
+        }
+
+        // the mantissa shifted to its position within the three bins, 117 bits
+        const std::uint64_t low = mantissa << shift;
+        const std::uint64_t high = shift == 0 ? 0 : mantissa >> (64 - shift);
+
+        // all ones for negative terms, (a ^ sign) - sign is -a then
+        const std::int64_t sign = -static_cast<std::int64_t>(bits >> 63);
+        const std::int64_t parts[3] = {
+          (static_cast<std::int64_t>(low & binMask) ^ sign) - sign,
+          (static_cast<std::int64_t>(low >> binBits) ^ sign) - sign,
+          (static_cast<std::int64_t>(high) ^ sign) - sign
+        };
+
+        const int k = bin - m_lowest;
+        if(k >= 0)
+        {
+          m_bins[k] += parts[0];
+          m_bins[k + 1] += parts[1];
+          m_bins[k + 2] += parts[2];
+        }
+        else
+        {
+          // the parts below the window are dropped
+          for(int j = -k; j < 3; j++)
+          {
+            m_bins[k + j] += parts[j];
+          }
+        }
+
+        if(++m_numTerms == carryInterval)
+        {
+          MoveCarries();
+        }
+      }
+
+      void Merge(const binned_sum& other)
+      {
+        if(other.m_lowest > m_lowest)
+        {
+          Shift(other.m_lowest);
+        }
+
+        for(int k = std::max(m_lowest - other.m_lowest, 0); k < numBins; k++)
+        {
+          m_bins[other.m_lowest + k - m_lowest] += other.m_bins[k];
+          m_carries[other.m_lowest + k - m_lowest] += other.m_carries[k];
+        }
+
+        if(other.m_hasNonFinite)
+        {
+          m_nonFinite = m_nonFinite + other.m_nonFinite;
+          m_hasNonFinite = true;
+        }
+
+        m_numTerms += other.m_numTerms;
+        if(m_numTerms >= carryInterval)
+        {
+          MoveCarries();
+        }
+      }
+
+      T Result() const
+      {
+        if(m_hasNonFinite)
+        {
+          return static_cast<T>(m_nonFinite);
+        }
+
+        // digits of the exact sum of the bins, two's complement with the sign in the most significant one
+        std::int64_t digits[numDigits];
+        for(int k = 0; k < numDigits; k++)
+        {
+          digits[k] = 0;
+        }
+
+        for(int k = 0; k < numBins; k++)
+        {
+          digits[k] += m_bins[k];
+          digits[k + 1] += m_carries[k];
+        }
+
+        Normalize(digits);
+
+        const bool negative = digits[numDigits - 1] < 0;
+        if(negative)
+        {
+          for(std::int64_t& digit : digits)
+          {
+            digit = -digit;
+          }
+          Normalize(digits);
+        }
+
+        const double result = Round(digits, binBits * m_lowest - 1074);
+        return static_cast<T>(negative ? -result : result);
+      }
+
+    private:
+      static const int binBits = 32;
+      static const std::uint64_t binMask = 0xffffffffULL;
+      static const std::uint32_t carryInterval = 1u << 30;
+      static const int numBins = 6;
+      static const int numDigits = numBins + 2;
+
+      /// Moves the window up such that its lowest bin is lowest
+      void Shift(int lowest)
+      {
+        const int distance = lowest - m_lowest;
+        for(int k = 0; k < numBins; k++)
+        {
+          m_bins[k] = k + distance < numBins ? m_bins[k + distance] : 0;
+          m_carries[k] = k + distance < numBins ? m_carries[k + distance] : 0;
+        }
+
+        m_lowest = lowest;
+      }
+
+      /// The low 32 bits stay in the bins, the multiples of 2^32 go to the second word of the same bin
+      void MoveCarries()
+      {
+        for(int k = 0; k < numBins; k++)
+        {
+          const std::int64_t low = static_cast<std::int64_t>(static_cast<std::uint64_t>(m_bins[k]) & binMask);
+          m_carries[k] += (m_bins[k] - low) / (std::int64_t(1) << binBits);
+          m_bins[k] = low;
+        }
+
+        m_numTerms = 0;
+      }
+
+      /// Moves the carries up, afterwards all digits except the most significant one are in [0, 2^32)
+      static void Normalize(std::int64_t* digits)
+      {
+        for(int k = 0; k + 1 < numDigits; k++)
+        {
+          const std::int64_t low = static_cast<std::int64_t>(static_cast<std::uint64_t>(digits[k]) & binMask);
+          digits[k + 1] += (digits[k] - low) / (std::int64_t(1) << binBits);
+          digits[k] = low;
+        }
+      }
+
+      /// Rounds the normalized non-negative digits to nearest, digit 0 has the weight 2^exponent: the 64 bits below
+      /// the leading one bit, the last one set if any bit below them is set, have a single rounding on the
+      /// conversion to double
+      static double Round(const std::int64_t* digits, int exponent)
+      {
+        int top = numDigits - 1;
+        while(top >= 0 && digits[top] == 0)
+        {
+          top--;
+        }
+
+        if(top < 0)
+        {
+          return 0.0;
+        }
+
+        const std::uint64_t d2 = static_cast<std::uint64_t>(digits[top]);
+        const std::uint64_t d1 = top >= 1 ? static_cast<std::uint64_t>(digits[top - 1]) : 0;
+        const std::uint64_t d0 = top >= 2 ? static_cast<std::uint64_t>(digits[top - 2]) : 0;
+
+        int zeros = 0;
+        while(((d2 << zeros) & 0x80000000ULL) == 0)
+        {
+          zeros++;
+        }
+
+        std::uint64_t window = ((d2 << binBits) | d1) << zeros;
+        bool sticky = false;
+        if(zeros > 0)
+        {
+          window |= d0 >> (binBits - zeros);
+          sticky = (d0 & ((std::uint64_t(1) << (binBits - zeros)) - 1)) != 0;
+        }
+        else
+        {
+          sticky = d0 != 0;
+        }
+
+        for(int k = top - 3; k >= 0 && !sticky; k--)
+        {
+          sticky = digits[k] != 0;
+        }
+
+        if(sticky)
+        {
+          window |= 1;
+        }
+
+        // the lowest bit of the window is at the bit position 32 (top - 1) - zeros
+        return std::ldexp(static_cast<double>(window), exponent + binBits * (top - 1) - zeros);
+      }
+
+      std::int64_t m_bins[numBins];
+      std::int64_t m_carries[numBins];
+      int m_lowest;
+      std::uint32_t m_numTerms;
+      double m_nonFinite;
+      bool m_hasNonFinite;
+    };
+
+    template<typename T>
+    const int binned_sum<T>::binBits;
+
+    template<typename T>
+    const std::uint64_t binned_sum<T>::binMask;
+
+    template<typename T>
+    const std::uint32_t binned_sum<T>::carryInterval;
+
+    template<typename T>
+    const int binned_sum<T>::numBins;
+
+    template<typename T>
+    const int binned_sum<T>::numDigits;
+
+  } // namespace detail
+} // namespace error_propagation
+
+#endif // DETAIL_SUMMATION_HPP
@@ -0,0 +1,1047 @@
+#ifndef DOUBLE_DOUBLE_HPP
+#define DOUBLE_DOUBLE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "ValueWithError.hpp"
+
+namespace error_propagation {
+
+  namespace detail {
+
+    /// Error-free sum, s + e == a + b exactly
+    inline void two_sum(double a, double b, double& s, double& e)
+    {
+      s = a + b;
+      const double bb = s - a;
+      e = (a - (s - bb)) + (b - bb);
+    }
+
+    /// Error-free sum for |a| >= |b|
+    inline void quick_two_sum(double a, double b, double& s, double& e)
+    {
+      s = a + b;
+      e = b - (s - a);
+    }
+
+    /// Error-free product, p + e == a * b exactly
+    inline void two_prod(double a, double b, double& p, double& e)
+    {
+      p = a * b;
+#ifdef FP_FAST_FMA
+      e = std::fma(a, b, -p);
+#else
+      // Dekker's product, splits both factors into 26 bit halves
+      const double splitter = 134217729.0; // 2^27 + 1
+      const double ta = splitter * a;
+      const double ah = ta - (ta - a);
+      const double al = a - ah;
+      const double tb = splitter * b;
+      const double bh = tb - (tb - b);
+      const double bl = b - bh;
+      e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+    }
+
+  } // namespace detail
+
+  /** @brief Unevaluated sum of two doubles with about 32 significant decimal digits
+   *
+   * Fast alternative to boost::multiprecision::cpp_dec_float_50 for avoiding cancellation, e.g. in long sums.
+   * All arithmetic is built on the error-free transformations TwoSum and TwoProd, the latter uses a fused
+   * multiply-add if the target provides a fast one (FP_FAST_FMA, e.g. with -mfma) and Dekker's splitting
+   * otherwise.
+   *
+   * Provides everything required by the ValueWithError operators and math overloads, so it can be used as
+   * ValueWithError<DoubleDouble>. The elementary functions (sqrt, cbrt, exp, log, pow, trigonometric,
+   * hyperbolic and their inverse functions) have full double-double accuracy, erf, erfc, lgamma and tgamma
+   * only double accuracy.
+   *
+   * @code{cpp}
+     ValueWithError<DoubleDouble> sum;
+     for(const auto& x : measurements)
+       sum += x;
+     @endcode
+   */
+  class DoubleDouble
+  {
+    public:
+    ///@name Constructor
+    ///@{
+    CONSTEXPR DoubleDouble()
+      :
+      m_hi(),
+      m_lo()
+    {}
+
+    /// Implicit, so that mixed arithmetic with double promotes to DoubleDouble
+    CONSTEXPR DoubleDouble(double value)
+      :
+      m_hi(value),
+      m_lo()
+    {}
+
+    /// Exact for all 64 bit integers
+    template<typename I, typename std::enable_if<std::is_integral<I>::value, int>::type = 0>
+    DoubleDouble(I value)
+      :
+      m_hi(static_cast<double>(value)),
+      m_lo(static_cast<double>(value - static_cast<I>(m_hi)))
+    {}
+
+    /// From a normalized pair, |lo| must not exceed half an ulp of hi
+    CONSTEXPR DoubleDouble(double hi, double lo)
+      :
+      m_hi(hi),
+      m_lo(lo)
+    {}
+    ///@}
+
+    ///@name Getters
+    ///@{
+    CONSTEXPR double GetHigh() const
+    {
+      return m_hi;
+    }
+
+    CONSTEXPR double GetLow() const
+    {
+      return m_lo;
+    }
+    ///@}
+
+    /// Nearest double
+    CONSTEXPR explicit operator double() const
+    {
+      return m_hi;
+    }
+
+    ///@name Compound operators
+    ///@{
+    DoubleDouble& operator+=(const DoubleDouble& rhs)
+    {
+      double s, e, t, f;
+      detail::two_sum(m_hi, rhs.m_hi, s, e);
+      detail::two_sum(m_lo, rhs.m_lo, t, f);
+      e += t;
+      detail::quick_two_sum(s, e, s, e);
+      e += f;
+      detail::quick_two_sum(s, e, m_hi, m_lo);
+      return *this;
+    }
+
+    DoubleDouble& operator+=(double rhs)
+    {
+      double s, e;
+      detail::two_sum(m_hi, rhs, s, e);
+      e += m_lo;
+      detail::quick_two_sum(s, e, m_hi, m_lo);
+      return *this;
+    }
+
+    DoubleDouble& operator-=(const DoubleDouble& rhs)
+    {
+      return *this += DoubleDouble(-rhs.m_hi, -rhs.m_lo);
+    }
+
+    DoubleDouble& operator-=(double rhs)
+    {
+      return *this += -rhs;
+    }
+
+    DoubleDouble& operator*=(const DoubleDouble& rhs)
+    {
+      double p, e;
+      detail::two_prod(m_hi, rhs.m_hi, p, e);
+      e += m_hi * rhs.m_lo + m_lo * rhs.m_hi;
+      detail::quick_two_sum(p, e, m_hi, m_lo);
+      return *this;
+    }
+
+    DoubleDouble& operator*=(double rhs)
+    {
+      double p, e;
+      detail::two_prod(m_hi, rhs, p, e);
+      e += m_lo * rhs;
+      detail::quick_two_sum(p, e, m_hi, m_lo);
+      return *this;
+    }
+
+    DoubleDouble& operator/=(const DoubleDouble& rhs)
+    {
+      // long division with three partial quotients
+      const double q1 = m_hi / rhs.m_hi;
+      DoubleDouble r = *this - rhs * q1;
+
+      const double q2 = r.m_hi / rhs.m_hi;
+      r -= rhs * q2;
+
+      const double q3 = r.m_hi / rhs.m_hi;
+
+      detail::quick_two_sum(q1, q2, m_hi, m_lo);
+      return *this += q3;
+    }
+
+    DoubleDouble& operator/=(double rhs)
+    {
+      const double q1 = m_hi / rhs;
+
+      double p, e;
+      detail::two_prod(q1, rhs, p, e);
+
+      double s, t;
+      detail::two_sum(m_hi, -p, s, t);
+      t -= e;
+      t += m_lo;
+
+      const double q2 = (s + t) / rhs;
+      detail::quick_two_sum(q1, q2, m_hi, m_lo);
+      return *this;
+    }
+    ///@}
+
+    ///@name Arithmetic operators
+    ///@{
+    friend DoubleDouble operator+(DoubleDouble lhs, const DoubleDouble& rhs)
+    {
+      return lhs += rhs;
+    }
+
+    friend DoubleDouble operator+(DoubleDouble lhs, double rhs)
+    {
+      return lhs += rhs;
+    }
+
+    friend DoubleDouble operator+(double lhs, DoubleDouble rhs)
+    {
+      return rhs += lhs;
+    }
+
+    friend DoubleDouble operator-(DoubleDouble lhs, const DoubleDouble& rhs)
+    {
+      return lhs -= rhs;
+    }
+
+    friend DoubleDouble operator-(DoubleDouble lhs, double rhs)
+    {
+      return lhs -= rhs;
+    }
+
+    friend DoubleDouble operator-(double lhs, const DoubleDouble& rhs)
+    {
+      return DoubleDouble(-rhs.m_hi, -rhs.m_lo) += lhs;
+    }
+
+    friend DoubleDouble operator*(DoubleDouble lhs, const DoubleDouble& rhs)
+    {
+      return lhs *= rhs;
+    }
+
+    friend DoubleDouble operator*(DoubleDouble lhs, double rhs)
+    {
+      return lhs *= rhs;
+    }
+
+    friend DoubleDouble operator*(double lhs, DoubleDouble rhs)
+    {
+      return rhs *= lhs;
+    }
+
+    friend DoubleDouble operator/(DoubleDouble lhs, const DoubleDouble& rhs)
+    {
+      return lhs /= rhs;
+    }
+
+    friend DoubleDouble operator/(DoubleDouble lhs, double rhs)
+    {
+      return lhs /= rhs;
+    }
+
+    friend DoubleDouble operator/(double lhs, const DoubleDouble& rhs)
+    {
+      return DoubleDouble(lhs) /= rhs;
+    }
+
+    friend CONSTEXPR DoubleDouble operator-(const DoubleDouble& a)
+    {
+      return DoubleDouble(-a.m_hi, -a.m_lo);
+    }
+
+    friend CONSTEXPR DoubleDouble operator+(const DoubleDouble& a)
+    {
+      return a;
+    }
+    ///@}
+
+    ///@name Comparison operators
+    ///@{
+    friend CONSTEXPR bool operator==(const DoubleDouble& lhs, const DoubleDouble& rhs)
+    {
+      return lhs.m_hi == rhs.m_hi && lhs.m_lo == rhs.m_lo;
+    }
+
+    friend CONSTEXPR bool operator!=(const DoubleDouble& lhs, const DoubleDouble& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    friend CONSTEXPR bool operator<(const DoubleDouble& lhs, const DoubleDouble& rhs)
+    {
+      return lhs.m_hi < rhs.m_hi || (lhs.m_hi == rhs.m_hi && lhs.m_lo < rhs.m_lo);
+    }
+
+    friend CONSTEXPR bool operator>(const DoubleDouble& lhs, const DoubleDouble& rhs)
+    {
+      return rhs < lhs;
+    }
+
+    friend CONSTEXPR bool operator<=(const DoubleDouble& lhs, const DoubleDouble& rhs)
+    {
+      return lhs.m_hi < rhs.m_hi || (lhs.m_hi == rhs.m_hi && lhs.m_lo <= rhs.m_lo);
+    }
+
+    friend CONSTEXPR bool operator>=(const DoubleDouble& lhs, const DoubleDouble& rhs)
+    {
+      return rhs <= lhs;
+    }
+    ///@}
+
+  private:
+    double m_hi;
+    double m_lo;
+  };
+
+  namespace detail {
+
+    /// Constants with double-double accuracy
+    struct double_double_constants
+    {
+      static CONSTEXPR DoubleDouble two_pi()
+      {
+        return DoubleDouble(6.283185307179586232e+00, 2.449293598294706414e-16);
+      }
+
+      static CONSTEXPR DoubleDouble pi()
+      {
+        return DoubleDouble(3.141592653589793116e+00, 1.224646799147353207e-16);
+      }
+
+      static CONSTEXPR DoubleDouble half_pi()
+      {
+        return DoubleDouble(1.570796326794896558e+00, 6.123233995736766036e-17);
+      }
+
+      static CONSTEXPR DoubleDouble quarter_pi()
+      {
+        return DoubleDouble(7.853981633974482790e-01, 3.061616997868383018e-17);
+      }
+
+      static CONSTEXPR DoubleDouble three_quarter_pi()
+      {
+        return DoubleDouble(2.356194490192344837e+00, 9.1848509936051484375e-17);
+      }
+
+      static CONSTEXPR DoubleDouble ln_two()
+      {
+        return DoubleDouble(6.931471805599452862e-01, 2.319046813846299558e-17);
+      }
+
+      static CONSTEXPR DoubleDouble ln_ten()
+      {
+        return DoubleDouble(2.302585092994045901e+00, -2.170756223382249351e-16);
+      }
+
+      static CONSTEXPR double epsilon()
+      {
+        return 4.93038065763132e-32; // 2^-104
+      }
+    };
+
+    /// Nearest integer
+    inline DoubleDouble nint(const DoubleDouble& a)
+    {
+      const double hi = std::floor(a.GetHigh() + 0.5);
+
+      if(hi == a.GetHigh())
+      {
+        // high part is an integer already, round the low part
+        const double lo = std::floor(a.GetLow() + 0.5);
+        double s, e;
+        quick_two_sum(hi, lo, s, e);
+        return DoubleDouble(s, e);
+      }
+
+      // the low part only matters for exact halves
+      if(std::abs(hi - a.GetHigh()) == 0.5 && a.GetLow() < 0.0)
+      {
+        return DoubleDouble(hi - 1.0);
+      }
+
+      return DoubleDouble(hi);
+    }
+
+    /// Taylor series of sine and cosine for |t| <= pi/4
+    inline void sin_cos_taylor(const DoubleDouble& t, DoubleDouble& sine, DoubleDouble& cosine)
+    {
+      const DoubleDouble t2 = t * t;
+      const double threshold = 0.5 * double_double_constants::epsilon();
+
+      sine = t;
+      DoubleDouble term = t;
+      for(double n = 2.0; std::abs(term.GetHigh()) > threshold; n += 2.0)
+      {
+        term *= -t2;
+        term /= n * (n + 1.0);
+        sine += term;
+      }
+
+      cosine = 1.0;
+      term = 1.0;
+      for(double n = 1.0; std::abs(term.GetHigh()) > threshold; n += 2.0)
+      {
+        term *= -t2;
+        term /= n * (n + 1.0);
+        cosine += term;
+      }
+    }
+
+    /// Sine and cosine with argument reduction to [-pi/4, pi/4]
+    inline void sin_cos(const DoubleDouble& a, DoubleDouble& sine, DoubleDouble& cosine)
+    {
+      typedef double_double_constants C;
+
+      const DoubleDouble r = a - C::two_pi() * nint(a / C::two_pi());
+      const double j = nint(r / C::half_pi()).GetHigh();
+      const DoubleDouble t = r - C::half_pi() * j;
+
+      DoubleDouble s, c;
+      sin_cos_taylor(t, s, c);
+
+      if(j == 0.0)
+      {
+        sine = s;
+        cosine = c;
+      }
+      else if(j == 1.0)
+      {
+        sine = c;
+        cosine = -s;
+      }
+      else if(j == -1.0)
+      {
+        sine = -c;
+        cosine = s;
+      }
+      else
+      {
+        sine = -s;
+        cosine = -c;
+      }
+    }
+
+  } // namespace detail
+
+  /**@name Math functions
+   *
+   * Found by argument dependent lookup, so generic code calling e.g. `using std::exp; exp(x)` works.
+   *@{
+   */
+  inline DoubleDouble abs(const DoubleDouble& a)
+  {
+    return a.GetHigh() < 0.0 ? -a : a;
+  }
+
+  inline DoubleDouble fabs(const DoubleDouble& a)
+  {
+    return abs(a);
+  }
+
+  inline DoubleDouble floor(const DoubleDouble& a)
+  {
+    const double hi = std::floor(a.GetHigh());
+
+    if(hi == a.GetHigh())
+    {
+      double s, e;
+      detail::quick_two_sum(hi, std::floor(a.GetLow()), s, e);
+      return DoubleDouble(s, e);
+    }
+
+    return DoubleDouble(hi);
+  }
+
+  inline DoubleDouble ceil(const DoubleDouble& a)
+  {
+    return -floor(-a);
+  }
+
+  inline DoubleDouble ldexp(const DoubleDouble& a, int exponent)
+  {
+    return DoubleDouble(std::ldexp(a.GetHigh(), exponent), std::ldexp(a.GetLow(), exponent));
+  }
+
+  inline DoubleDouble frexp(const DoubleDouble& a, int* exponent)
+  {
+    const double hi = std::frexp(a.GetHigh(), exponent);
+    return DoubleDouble(hi, std::ldexp(a.GetLow(), -*exponent));
+  }
+
+  inline DoubleDouble sqrt(const DoubleDouble& a)
+  {
+    if(a.GetHigh() <= 0.0)
+    {
+      return a.GetHigh() == 0.0 ? DoubleDouble() : DoubleDouble(std::sqrt(a.GetHigh()));
+    }
+
+    // one Newton step for 1/sqrt(a) on top of the double result (Karp's trick)
+    const double x = 1.0 / std::sqrt(a.GetHigh());
+    const double ax = a.GetHigh() * x;
+
+    double p, e;
+    detail::two_prod(ax, ax, p, e);
+    const DoubleDouble diff = a - DoubleDouble(p, e);
+
+    return DoubleDouble(ax) + diff.GetHigh() * x * 0.5;
+  }
+
+  inline DoubleDouble cbrt(const DoubleDouble& a)
+  {
+    if(a.GetHigh() == 0.0 || !std::isfinite(a.GetHigh()))
+    {
+      return a;
+    }
+
+    // one Newton step on top of the double result
+    const DoubleDouble x = std::cbrt(a.GetHigh());
+    return x - (x * x * x - a) / (3.0 * x * x);
+  }
+
+  inline DoubleDouble exp(const DoubleDouble& a)
+  {
+    typedef detail::double_double_constants C;
+
+    // above log(DBL_MAX) the result overflows, below log(2^-1075) it rounds to zero, subnormal results in between
+    // come from ldexp below
+    if(a.GetHigh() > 709.782712893384)
+    {
+      return std::numeric_limits<double>::infinity();
+    }
+
+    if(a.GetHigh() < -745.1332191019412)
+    {
+      return DoubleDouble();
+    }
+
+    if(a.GetHigh() == 0.0)
+    {
+      return 1.0;
+    }
+
+    // exp(a) = 2^m exp(r)^512 with |r| <= ln(2) / 1024
+    const double m = std::floor(a.GetHigh() / C::ln_two().GetHigh() + 0.5);
+    const DoubleDouble r = ldexp(a - C::ln_two() * m, -9);
+
+    // exp(r) - 1 by its Taylor series
+    DoubleDouble s = r;
+    DoubleDouble term = r;
+    for(double n = 2.0; std::abs(term.GetHigh()) > 1e-3 * C::epsilon(); n += 1.0)
+    {
+      term *= r;
+      term /= n;
+      s += term;
+    }
+
+    // (1 + s)^2 - 1 = 2s + s^2 keeps the small quantity
+    for(int i = 0; i < 9; i++)
+    {
+      s = ldexp(s, 1) + s * s;
+    }
+
+    return ldexp(s + 1.0, static_cast<int>(m));
+  }
+
+  inline DoubleDouble expm1(const DoubleDouble& a)
+  {
+    if(std::abs(a.GetHigh()) > 0.5)
+    {
+      return exp(a) - 1.0;
+    }
+
+    DoubleDouble s = a;
+    DoubleDouble term = a;
+    for(double n = 2.0; std::abs(term.GetHigh()) > 1e-3 * detail::double_double_constants::epsilon() * std::abs(s.GetHigh()); n += 1.0)
+    {
+      term *= a;
+      term /= n;
+      s += term;
+    }
+
+    return s;
+  }
+
+  inline DoubleDouble exp2(const DoubleDouble& a)
+  {
+    return exp(a * detail::double_double_constants::ln_two());
+  }
+
+  inline DoubleDouble log(const DoubleDouble& a)
+  {
+    if(a.GetHigh() <= 0.0 || !std::isfinite(a.GetHigh()))
+    {
+      return std::log(a.GetHigh());
+    }
+
+    if(a.GetHigh() == 1.0 && a.GetLow() == 0.0)
+    {
+      return DoubleDouble();
+    }
+
+    // one Newton step for exp(x) = a on top of the double result
+    const DoubleDouble x = std::log(a.GetHigh());
+    return x + a * exp(-x) - 1.0;
+  }
+
+  inline DoubleDouble log1p(const DoubleDouble& a)
+  {
+    if(std::abs(a.GetHigh()) > 0.25)
+    {
+      return log(a + 1.0);
+    }
+
+    // log(1 + a) = 2 atanh(a / (2 + a)), as log(1 + a) loses the relative accuracy for small a
+    const DoubleDouble s = a / (a + 2.0);
+    const DoubleDouble s2 = s * s;
+
+    DoubleDouble sum = s;
+    DoubleDouble power = s;
+    for(double n = 3.0; ; n += 2.0)
+    {
+      power *= s2;
+      const DoubleDouble term = power / n;
+      sum += term;
+
+      if(std::abs(term.GetHigh()) <= 1e-3 * detail::double_double_constants::epsilon() * std::abs(sum.GetHigh()))
+      {
+        break;
+      }
+    }
+
+    return ldexp(sum, 1);
+  }
+
+  inline DoubleDouble log2(const DoubleDouble& a)
+  {
+    return log(a) / detail::double_double_constants::ln_two();
+  }
+
+  inline DoubleDouble log10(const DoubleDouble& a)
+  {
+    return log(a) / detail::double_double_constants::ln_ten();
+  }
+
+  inline DoubleDouble pow(const DoubleDouble& base, const DoubleDouble& exponent)
+  {
+    if(floor(exponent) == exponent && std::abs(exponent.GetHigh()) < 1024.0)
+    {
+      // exponentiation by squaring, exact sign for negative bases
+      long long n = static_cast<long long>(exponent.GetHigh()) + static_cast<long long>(exponent.GetLow());
+      const bool negative = n < 0;
+      n = negative ? -n : n;
+
+      DoubleDouble result = 1.0;
+      DoubleDouble factor = base;
+      for(; n > 0; n /= 2)
+      {
+        if(n % 2 == 1)
+        {
+          result *= factor;
+        }
+
+        factor *= factor;
+      }
+
+      return negative ? 1.0 / result : result;
+    }
+
+    return exp(exponent * log(base));
+  }
+
+  inline DoubleDouble sin(const DoubleDouble& a)
+  {
+    DoubleDouble s, c;
+    detail::sin_cos(a, s, c);
+    return s;
+  }
+
+  inline DoubleDouble cos(const DoubleDouble& a)
+  {
+    DoubleDouble s, c;
+    detail::sin_cos(a, s, c);
+    return c;
+  }
+
+  inline DoubleDouble tan(const DoubleDouble& a)
+  {
+    DoubleDouble s, c;
+    detail::sin_cos(a, s, c);
+    return s / c;
+  }
+
+  inline DoubleDouble atan2(const DoubleDouble& y, const DoubleDouble& x)
+  {
+    typedef detail::double_double_constants C;
+
+    if(x.GetHigh() == 0.0)
+    {
+      return y.GetHigh() == 0.0 ? DoubleDouble() : (y.GetHigh() > 0.0 ? C::half_pi() : -C::half_pi());
+    }
+
+    if(y.GetHigh() == 0.0)
+    {
+      return x.GetHigh() > 0.0 ? DoubleDouble() : C::pi();
+    }
+
+    if(x == y)
+    {
+      return y.GetHigh() > 0.0 ? C::quarter_pi() : -C::three_quarter_pi();
+    }
+
+    if(x == -y)
+    {
+      return y.GetHigh() > 0.0 ? C::three_quarter_pi() : -C::quarter_pi();
+    }
+
+    const DoubleDouble r = sqrt(x * x + y * y);
+    const DoubleDouble xx = x / r;
+    const DoubleDouble yy = y / r;
+
+    // one Newton step on top of the double result, using the better conditioned of sine and cosine
+    DoubleDouble z = std::atan2(y.GetHigh(), x.GetHigh());
+    DoubleDouble s, c;
+    detail::sin_cos(z, s, c);
+
+    if(std::abs(xx.GetHigh()) > std::abs(yy.GetHigh()))
+    {
+      z += (yy - s) / c;
+    }
+    else
+    {
+      z -= (xx - c) / s;
+    }
+
+    return z;
+  }
+
+  inline DoubleDouble atan(const DoubleDouble& a)
+  {
+    return atan2(a, DoubleDouble(1.0));
+  }
+
+  inline DoubleDouble asin(const DoubleDouble& a)
+  {
+    return atan2(a, sqrt(1.0 - a * a));
+  }
+
+  inline DoubleDouble acos(const DoubleDouble& a)
+  {
+    return atan2(sqrt(1.0 - a * a), a);
+  }
+
+  inline DoubleDouble sinh(const DoubleDouble& a)
+  {
+    if(std::abs(a.GetHigh()) > 0.5)
+    {
+      const DoubleDouble e = exp(a);
+      return ldexp(e - 1.0 / e, -1);
+    }
+
+    // avoids the cancellation of exp(a) - exp(-a)
+    const DoubleDouble em1 = expm1(a);
+    return ldexp(em1 + em1 / (em1 + 1.0), -1);
+  }
+
+  inline DoubleDouble cosh(const DoubleDouble& a)
+  {
+    const DoubleDouble e = exp(a);
+    return ldexp(e + 1.0 / e, -1);
+  }
+
+  inline DoubleDouble tanh(const DoubleDouble& a)
+  {
+    if(std::abs(a.GetHigh()) > 40.0)
+    {
+      return a.GetHigh() > 0.0 ? 1.0 : -1.0;
+    }
+
+    const DoubleDouble em1 = expm1(ldexp(a, 1));
+    return em1 / (em1 + 2.0);
+  }
+
+  inline DoubleDouble asinh(const DoubleDouble& a)
+  {
+    const DoubleDouble x = abs(a);
+    const DoubleDouble x2 = x * x;
+    const DoubleDouble result = log1p(x + x2 / (1.0 + sqrt(1.0 + x2)));
+    return a.GetHigh() < 0.0 ? -result : result;
+  }
+
+  inline DoubleDouble acosh(const DoubleDouble& a)
+  {
+    return log(a + sqrt(a * a - 1.0));
+  }
+
+  inline DoubleDouble atanh(const DoubleDouble& a)
+  {
+    return ldexp(log1p(ldexp(a, 1) / (1.0 - a)), -1);
+  }
+
+  inline DoubleDouble hypot(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    DoubleDouble x = abs(a);
+    DoubleDouble y = abs(b);
+
+    if(x < y)
+    {
+      std::swap(x, y);
+    }
+
+    if(y.GetHigh() == 0.0 || !std::isfinite(x.GetHigh()))
+    {
+      return x;
+    }
+
+    const DoubleDouble ratio = y / x;
+    return x * sqrt(1.0 + ratio * ratio);
+  }
+
+  /// Double accuracy only
+  inline DoubleDouble erf(const DoubleDouble& a)
+  {
+    return std::erf(a.GetHigh());
+  }
+
+  /// Double accuracy only
+  inline DoubleDouble erfc(const DoubleDouble& a)
+  {
+    return std::erfc(a.GetHigh());
+  }
+
+  /// Double accuracy only
+  inline DoubleDouble lgamma(const DoubleDouble& a)
+  {
+    return std::lgamma(a.GetHigh());
+  }
+
+  /// Double accuracy only
+  inline DoubleDouble tgamma(const DoubleDouble& a)
+  {
+    return std::tgamma(a.GetHigh());
+  }
+  ///@}
+
+  /// Scientific notation with all digits if the precision of the stream exceeds that of double
+  template<typename charT, typename traits>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const DoubleDouble& a)
+  {
+    const std::streamsize precision = out.precision();
+
+    if(precision <= std::numeric_limits<double>::digits10 || a.GetHigh() == 0.0 || !std::isfinite(a.GetHigh()))
+    {
+      return out << a.GetHigh();
+    }
+
+    // digit extraction, x is kept in [1, 10)
+    DoubleDouble x = abs(a);
+    int exponent = static_cast<int>(std::floor(std::log10(x.GetHigh())));
+    x /= pow(DoubleDouble(10.0), DoubleDouble(exponent));
+
+    if(x >= DoubleDouble(10.0))
+    {
+      x /= 10.0;
+      exponent++;
+    }
+    else if(x < DoubleDouble(1.0))
+    {
+      x *= 10.0;
+      exponent--;
+    }
+
+    std::basic_ostringstream<charT,traits> sstr;
+    sstr << (a.GetHigh() < 0.0 ? "-" : "");
+
+    for(std::streamsize i = 0; i <= precision; i++)
+    {
+      const int digit = std::min(std::max(static_cast<int>(std::floor(x.GetHigh())), 0), 9);
+      sstr << digit << (i == 0 ? "." : "");
+      x = (x - static_cast<double>(digit)) * 10.0;
+    }
+
+    sstr << 'e' << (exponent < 0 ? '-' : '+') << std::abs(exponent);
+
+    return out << sstr.str();
+  }
+
+  /// Reads decimal numbers with optional sign and exponent
+  template<typename charT, typename traits>
+  std::basic_istream<charT,traits>&
+  operator>>(std::basic_istream<charT,traits>& in, DoubleDouble& a)
+  {
+    std::string str;
+    if(!(in >> str))
+    {
+      return in;
+    }
+
+    DoubleDouble result;
+    int exponent = 0;
+    bool negative = false, point = false, digits = false;
+    std::size_t i = 0;
+
+    if(i < str.size() && (str[i] == '-' || str[i] == '+'))
+    {
+      negative = str[i] == '-';
+      i++;
+    }
+
+    for(; i < str.size(); i++)
+    {
+      const char c = str[i];
+
+      if(c >= '0' && c <= '9')
+      {
+        result = result * 10.0 + static_cast<double>(c - '0');
+        exponent -= point ? 1 : 0;
+        digits = true;
+      }
+      else if(c == '.' && !point)
+      {
+        point = true;
+      }
+      else if((c == 'e' || c == 'E') && digits)
+      {
+        std::istringstream exp(str.substr(i + 1));
+        int e = 0;
+        if(!(exp >> e))
+        {
+          in.setstate(std::ios_base::failbit);
+          return in;
+        }
+
+        exponent += e;
+        break;
+      }
+      else
+      {
+        in.setstate(std::ios_base::failbit);
+        return in;
+      }
+    }
+
+    if(!digits)
+    {
+      in.setstate(std::ios_base::failbit);
+      return in;
+    }
+
+    if(exponent != 0)
+    {
+      const DoubleDouble scale = pow(DoubleDouble(10.0), DoubleDouble(std::abs(exponent)));
+      result = exponent > 0 ? result * scale : result / scale;
+    }
+
+    a = negative ? -result : result;
+    return in;
+  }
+
+} // namespace error_propagation
+
+namespace std {
+
+  template<>
+  class numeric_limits<error_propagation::DoubleDouble>
+  {
+    typedef error_propagation::DoubleDouble DD;
+
+    public:
+    static CONSTEXPR bool is_specialized = true;
+    static CONSTEXPR bool is_signed = true;
+    static CONSTEXPR bool is_integer = false;
+    static CONSTEXPR bool is_exact = false;
+    static CONSTEXPR bool has_infinity = true;
+    static CONSTEXPR bool has_quiet_NaN = true;
+    static CONSTEXPR bool has_signaling_NaN = true;
+    static CONSTEXPR float_denorm_style has_denorm = denorm_absent;
+    static CONSTEXPR bool has_denorm_loss = false;
+    static CONSTEXPR bool is_iec559 = false;
+    static CONSTEXPR bool is_bounded = true;
+    static CONSTEXPR bool is_modulo = false;
+    static CONSTEXPR bool traps = false;
+    static CONSTEXPR bool tinyness_before = false;
+    static CONSTEXPR float_round_style round_style = round_to_nearest;
+    static CONSTEXPR int digits = 106;
+    static CONSTEXPR int digits10 = 31;
+    static CONSTEXPR int max_digits10 = 33;
+    static CONSTEXPR int radix = 2;
+    static CONSTEXPR int min_exponent = numeric_limits<double>::min_exponent + 53;
+    static CONSTEXPR int min_exponent10 = numeric_limits<double>::min_exponent10 + 16;
+    static CONSTEXPR int max_exponent = numeric_limits<double>::max_exponent;
+    static CONSTEXPR int max_exponent10 = numeric_limits<double>::max_exponent10;
+
+    /// Smallest value which still has full precision
+    static CONSTEXPR DD min()
+    {
+      return DD(2.0041683600089728e-292);
+    }
+
+    static CONSTEXPR DD max()
+    {
+      return DD(1.79769313486231570815e+308, 9.97920154767359795037e+291);
+    }
+
+    static CONSTEXPR DD lowest()
+    {
+      return DD(-1.79769313486231570815e+308, -9.97920154767359795037e+291);
+    }
+
+    static CONSTEXPR DD epsilon()
+    {
+      return DD(error_propagation::detail::double_double_constants::epsilon());
+    }
+
+    static CONSTEXPR DD round_error()
+    {
+      return DD(0.5);
+    }
+
+    static CONSTEXPR DD infinity()
+    {
+      return DD(numeric_limits<double>::infinity());
+    }
+
+    static CONSTEXPR DD quiet_NaN()
+    {
+      return DD(numeric_limits<double>::quiet_NaN());
+    }
+
+    static CONSTEXPR DD signaling_NaN()
+    {
+      return DD(numeric_limits<double>::signaling_NaN());
+    }
+
+    static CONSTEXPR DD denorm_min()
+    {
+      return min();
+    }
+  };
+
+} // namespace std
+
+#endif // DOUBLE_DOUBLE_HPP
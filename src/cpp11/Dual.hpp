@@ -0,0 +1,796 @@
+#ifndef DUAL_HPP
+#define DUAL_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+
+#include "ValueWithError.hpp"
+#include "DetailDerivatives.hpp"
+#include "DetailIndexSequence.hpp"
+
+namespace error_propagation {
+
+  /** @brief Value together with its gradient for forward mode automatic differentiation
+   *
+   * Holds the value and the partial derivatives with respect to N input variables. All arithmetic operators and
+   * the math functions of ValueWithError are available and apply the chain rule, comparisons only use the value.
+   * The number of variables is a compile time constant, so all loops over the gradient have a fixed trip count
+   * and are unrolled and vectorized by the compiler.
+   *
+   * Usually not used directly but through propagate().
+   *
+   * @tparam T  Arithmetic type
+   * @tparam N  Number of input variables
+   */
+  template<typename T, std::size_t N>
+  class Dual
+  {
+    public:
+    typedef T value_type;
+    typedef std::array<T, N> gradient_type;
+
+    ///@name Constructor
+    ///@{
+    /// Constant, all derivatives are zero
+    explicit Dual(const T& value)
+      :
+      m_value(value),
+      m_gradient()
+    {}
+
+    Dual()
+      :
+      m_value(),
+      m_gradient()
+    {}
+
+    Dual(const T& value, const gradient_type& gradient)
+      :
+      m_value(value),
+      m_gradient(gradient)
+    {}
+    ///@}
+
+    /// Input variable with the given index, its derivative is one and all others are zero
+    static Dual Variable(const T& value, std::size_t index)
+    {
+      assert(index < N);
+
+      Dual result(value);
+      result.m_gradient[index] = T(1);
+      return result;
+    }
+
+    const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    const gradient_type& GetGradient() const
+    {
+      return m_gradient;
+    }
+
+    /// Partial derivative with respect to the variable with the given index
+    const T& GetDerivative(std::size_t index) const
+    {
+      assert(index < N);
+      return m_gradient[index];
+    }
+
+    ///@name Compound operators
+    ///@{
+    template<typename U>
+    Dual& operator*=(const U& rhs)
+    {
+      return *this = *this * rhs;
+    }
+
+    template<typename U>
+    Dual& operator/=(const U& rhs)
+    {
+      return *this = *this / rhs;
+    }
+
+    template<typename U>
+    Dual& operator+=(const U& rhs)
+    {
+      return *this = *this + rhs;
+    }
+
+    template<typename U>
+    Dual& operator-=(const U& rhs)
+    {
+      return *this = *this - rhs;
+    }
+    ///@}
+
+    private:
+    T m_value;
+    gradient_type m_gradient;
+  };
+
+  namespace detail {
+
+    /// Enables the overloads for a Dual and a plain value of arithmetic type or its own value type only
+    template<typename U, typename T, typename R>
+    struct enable_if_dual_scalar : std::enable_if<std::is_arithmetic<U>::value || std::is_same<U, T>::value, R>
+    {};
+
+    /// Chain rule for one argument with derivative d
+    template<typename T, std::size_t N>
+    Dual<T, N> dual_chain(const T& value, const T& d, const Dual<T, N>& a)
+    {
+      const typename Dual<T, N>::gradient_type& ga = a.GetGradient();
+      typename Dual<T, N>::gradient_type gradient;
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        gradient[i] = d * ga[i];
+      }
+
+      return Dual<T, N>(value, gradient);
+    }
+
+    /// Chain rule for two arguments with the partial derivatives dlhs and drhs
+    template<typename T, std::size_t N>
+    Dual<T, N> dual_chain(const T& value, const T& dlhs, const Dual<T, N>& lhs, const T& drhs, const Dual<T, N>& rhs)
+    {
+      const typename Dual<T, N>::gradient_type& gl = lhs.GetGradient();
+      const typename Dual<T, N>::gradient_type& gr = rhs.GetGradient();
+      typename Dual<T, N>::gradient_type gradient;
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        gradient[i] = dlhs * gl[i] + drhs * gr[i];
+      }
+
+      return Dual<T, N>(value, gradient);
+    }
+
+    template<Opcode op, typename T, std::size_t N>
+    Dual<T, N> dual_unary(const Dual<T, N>& a)
+    {
+      return dual_chain(opcode_function<op>::apply(a.GetValue()), derivative<op>::first(a.GetValue()), a);
+    }
+
+    template<Opcode op, typename T, std::size_t N>
+    Dual<T, N> dual_binary(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+    {
+      T dlhs, drhs;
+      derivative<op>::first(lhs.GetValue(), rhs.GetValue(), dlhs, drhs);
+
+      return dual_chain(opcode_function<op>::template apply<T>(lhs.GetValue(), rhs.GetValue()), dlhs, lhs, drhs, rhs);
+    }
+
+    template<Opcode op, typename T, std::size_t N>
+    Dual<T, N> dual_binary(const Dual<T, N>& lhs, const T& rhs)
+    {
+      T dlhs, drhs;
+      derivative<op>::first(lhs.GetValue(), rhs, dlhs, drhs);
+
+      return dual_chain(opcode_function<op>::template apply<T>(lhs.GetValue(), rhs), dlhs, lhs);
+    }
+
+    template<Opcode op, typename T, std::size_t N>
+    Dual<T, N> dual_binary(const T& lhs, const Dual<T, N>& rhs)
+    {
+      T dlhs, drhs;
+      derivative<op>::first(lhs, rhs.GetValue(), dlhs, drhs);
+
+      return dual_chain(opcode_function<op>::template apply<T>(lhs, rhs.GetValue()), drhs, rhs);
+    }
+
+  } // namespace detail
+
+  ///@name Arithmetic operators
+  ///@{
+  template<typename T, std::size_t N>
+  Dual<T, N> operator+(const Dual<T, N>& a)
+  {
+    return a;
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> operator-(const Dual<T, N>& a)
+  {
+    return detail::dual_chain(-a.GetValue(), T(-1), a);
+  }
+
+  /// Product
+  template<typename T, std::size_t N>
+  Dual<T, N> operator*(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Multiply>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  operator*(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Multiply>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  operator*(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Multiply>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Quotient
+  template<typename T, std::size_t N>
+  Dual<T, N> operator/(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Divide>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  operator/(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Divide>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  operator/(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Divide>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Sum
+  template<typename T, std::size_t N>
+  Dual<T, N> operator+(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Plus>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  operator+(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Plus>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  operator+(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Plus>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Difference
+  template<typename T, std::size_t N>
+  Dual<T, N> operator-(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Minus>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  operator-(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Minus>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  operator-(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Minus>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+  ///@name Comparison operators, only the values are compared
+  ///@{
+  template<typename T, std::size_t N>
+  bool operator==(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs.GetValue() == rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, bool>::type
+  operator==(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() == rhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, bool>::type
+  operator==(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs == rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N>
+  bool operator!=(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs.GetValue() != rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, bool>::type
+  operator!=(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() != rhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, bool>::type
+  operator!=(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs != rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N>
+  bool operator<(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs.GetValue() < rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, bool>::type
+  operator<(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() < rhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, bool>::type
+  operator<(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs < rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N>
+  bool operator<=(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs.GetValue() <= rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, bool>::type
+  operator<=(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() <= rhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, bool>::type
+  operator<=(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs <= rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N>
+  bool operator>(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs.GetValue() > rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, bool>::type
+  operator>(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() > rhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, bool>::type
+  operator>(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs > rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N>
+  bool operator>=(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs.GetValue() >= rhs.GetValue();
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, bool>::type
+  operator>=(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() >= rhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, bool>::type
+  operator>=(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return lhs >= rhs.GetValue();
+  }
+  ///@}
+
+  ///@name Math functions
+  ///@{
+  /// atan2
+  template<typename T, std::size_t N>
+  Dual<T, N> atan2(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Atan2>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  atan2(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Atan2>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  atan2(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Atan2>(static_cast<T>(lhs), rhs);
+  }
+
+  /// hypot
+  template<typename T, std::size_t N>
+  Dual<T, N> hypot(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Hypot>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  hypot(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Hypot>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  hypot(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Hypot>(static_cast<T>(lhs), rhs);
+  }
+
+  /// pow
+  template<typename T, std::size_t N>
+  Dual<T, N> pow(const Dual<T, N>& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Pow>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t N, typename V>
+  typename detail::enable_if_dual_scalar<V, T, Dual<T, N> >::type
+  pow(const Dual<T, N>& lhs, const V& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Pow>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t N, typename U>
+  typename detail::enable_if_dual_scalar<U, T, Dual<T, N> >::type
+  pow(const U& lhs, const Dual<T, N>& rhs)
+  {
+    return detail::dual_binary<detail::Opcode::Pow>(static_cast<T>(lhs), rhs);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> abs(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Abs>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> acos(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Acos>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> acosh(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Acosh>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> asin(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Asin>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> asinh(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Asinh>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> atan(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Atan>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> atanh(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Atanh>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> cbrt(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Cbrt>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> cos(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Cos>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> cosh(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Cosh>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> erf(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Erf>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> erfc(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Erfc>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> exp(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Exp>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> exp2(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Exp2>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> expm1(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Expm1>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> fabs(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Fabs>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> lgamma(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Lgamma>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> log(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Log>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> log10(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Log10>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> log1p(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Log1p>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> log2(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Log2>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> sin(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Sin>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> sinh(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Sinh>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> sqrt(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Sqrt>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> tan(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Tan>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> tanh(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Tanh>(a);
+  }
+
+  template<typename T, std::size_t N>
+  Dual<T, N> tgamma(const Dual<T, N>& a)
+  {
+    return detail::dual_unary<detail::Opcode::Tgamma>(a);
+  }
+  ///@}
+
+  namespace detail {
+
+    /// ValueWithError type of the first ValueWithError argument
+    template<typename... Args>
+    struct first_value_with_error
+    {};
+
+    template<typename T, typename P, typename... Args>
+    struct first_value_with_error<ValueWithError<T, P>, Args...>
+    {
+      typedef ValueWithError<T, P> type;
+    };
+
+    template<typename U, typename... Args>
+    struct first_value_with_error<U, Args...> : first_value_with_error<Args...>
+    {};
+
+    /// ValueWithError arguments become input variables, everything else is passed through unchanged
+    template<typename T, std::size_t N, typename P>
+    Dual<T, N> dual_argument(const ValueWithError<T, P>& v, std::size_t index)
+    {
+      return Dual<T, N>::Variable(v.GetValue(), index);
+    }
+
+    template<typename T, std::size_t N, typename U>
+    const U& dual_argument(const U& u, std::size_t /* index */)
+    {
+      return u;
+    }
+
+    template<typename T, typename P>
+    T argument_error(const ValueWithError<T, P>& v)
+    {
+      return v.GetError();
+    }
+
+    template<typename T, typename U>
+    T argument_error(const U& /* u */)
+    {
+      return T();
+    }
+
+    /// Combine the gradient with the errors of the input variables
+    template<typename T, typename P, std::size_t N>
+    ValueWithError<T, P> gradient_to_value_with_error(const Dual<T, N>& result, const std::array<T, N>& errors)
+    {
+      using std::abs;
+      using std::sqrt;
+
+      std::array<T, N> terms;
+      T largest = T();
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        terms[i] = abs(result.GetDerivative(i) * errors[i]);
+        largest = terms[i] > largest ? terms[i] : largest;
+      }
+
+      T error = T();
+
+      if(largest > T() && (boost::math::isfinite)(largest))
+      {
+        // same as chaining detail::hypot but with a single square root, scaling by the largest term avoids overflow
+        T sum = T();
+        for(std::size_t i = 0; i < N; i++)
+        {
+          const T scaled = terms[i] / largest;
+          sum += scaled * scaled;
+        }
+
+        error = largest * sqrt(sum);
+      }
+      else
+      {
+        for(std::size_t i = 0; i < N; i++)
+        {
+          error = hypot(error, terms[i]);
+        }
+      }
+
+      return ValueWithError<T, P>(result.GetValue(), error);
+    }
+
+    template<typename R, typename F, std::size_t... I, typename... Args>
+    R propagate_impl(F& f, index_sequence<I...>, const Args&... args)
+    {
+      typedef typename R::value_type T;
+      typedef typename R::policy_type P;
+      const std::size_t N = sizeof...(Args);
+
+      const Dual<T, N> result = f(dual_argument<T, N>(args, I)...);
+      const std::array<T, N> errors = {{ argument_error<T>(args)... }};
+
+      return gradient_to_value_with_error<T, P>(result, errors);
+    }
+
+  } // namespace detail
+
+  /** @brief Propagate the errors of the arguments through an arbitrary function
+   *
+   * The callable f is evaluated once with Dual arguments, the error of the result is derived from the exact
+   * gradient assuming uncorrelated arguments. Arguments of type ValueWithError become input variables, all other
+   * arguments are passed through unchanged. The callable must therefore be generic, e.g. a function template or
+   * a class with a templated call operator, and has to call the math functions unqualified.
+   *
+   * Contrary to chaining the ValueWithError overloads, arguments used multiple times in f are treated
+   * correctly, e.g. x * x gives an error of 2|x|e and x - x an error of zero.
+   *
+   * @code{cpp}
+     struct Breit
+     {
+       template<typename T, typename U>
+       T operator()(const T& m, const U& gamma) const
+       {
+         return gamma / ((m - 91.19) * (m - 91.19) + gamma * gamma / 4.0);
+       }
+     };
+
+     auto y = propagate(Breit(), make_value(90.0, 0.2), make_value(2.5, 0.1));
+     @endcode
+   *
+   * @return ValueWithError of the same type as the first ValueWithError argument
+   */
+  template<typename F, typename... Args>
+  typename detail::first_value_with_error<Args...>::type
+  propagate(F f, const Args&... args)
+  {
+    typedef typename detail::first_value_with_error<Args...>::type R;
+
+    return detail::propagate_impl<R>(f, detail::make_index_sequence<sizeof...(Args)>(), args...);
+  }
+
+  /** @brief Propagate the errors of N arguments through an arbitrary function
+   *
+   * Same as the variadic version but f is called with a `const std::array<Dual<T, N>, N>&`, intended for
+   * functions of many or a varying number of variables.
+   */
+  template<typename F, typename T, typename P, std::size_t N>
+  ValueWithError<T, P> propagate(F f, const std::array<ValueWithError<T, P>, N>& args)
+  {
+    std::array<Dual<T, N>, N> duals;
+    std::array<T, N> errors;
+
+    for(std::size_t i = 0; i < N; i++)
+    {
+      duals[i] = Dual<T, N>::Variable(args[i].GetValue(), i);
+      errors[i] = args[i].GetError();
+    }
+
+    const Dual<T, N> result = f(static_cast<const std::array<Dual<T, N>, N>&>(duals));
+
+    return detail::gradient_to_value_with_error<T, P>(result, errors);
+  }
+
+} // namespace error_propagation
+
+#endif // DUAL_HPP
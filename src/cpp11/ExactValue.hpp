@@ -0,0 +1,832 @@
+#ifndef EXACT_VALUE_HPP
+#define EXACT_VALUE_HPP
+
+#include "ValueWithError.hpp"
+
+namespace error_propagation {
+
+  /** @brief Value which is known to be exact at compile time
+   *
+   * Use it for unit factors, integer counts and other constants instead of a ValueWithError with zero error.
+   * Arithmetic operators and two argument math functions with one ValueWithError and one ExactValue argument
+   * use the cheaper formulas for a general compatible type and therefore don't need a detail::hypot call.
+   * Operations involving only ExactValue objects and plain values return an ExactValue again, so exact values
+   * stay exact through whole chains and only become a ValueWithError when combined with one.
+   *
+   * @code{cpp}
+     const auto factor = make_exact(1e-3);
+     auto a = make_value(5.0, 0.3);
+     auto b = a * factor;                   // ValueWithError<double>, computed as a * 1e-3
+     auto c = sqrt(factor * 2.0);           // ExactValue<double>
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   */
+  template<typename T>
+  class ExactValue
+  {
+    public:
+    typedef T value_type;
+
+    ///@name Constructor
+    ///@{
+    CONSTEXPR explicit ExactValue(const T& value)
+      :
+      m_value{value}
+    {}
+
+    CONSTEXPR ExactValue()
+      :
+      m_value{}
+    {}
+    ///@}
+
+    ///@name Getters
+    ///@{
+    CONSTEXPR inline const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    /// The error of an exact value is always a default constructed T
+    CONSTEXPR inline T GetError() const
+    {
+      return T();
+    }
+    ///@}
+
+    /// Exact values can be used wherever a T is expected
+    CONSTEXPR operator const T&() const
+    {
+      return m_value;
+    }
+
+  private:
+    T m_value;
+  };
+
+  /// Helper function using template argument deduction
+  template<typename T>
+  CONSTEXPR ExactValue<typename std::decay<T>::type>
+  make_exact(T&& value)
+  {
+    return ExactValue<typename std::decay<T>::type>(std::forward<T>(value));
+  }
+
+  /**@name Arithmetic operator definitions
+   *
+   * An ExactValue combined with a ValueWithError is computed as the ValueWithError combined with the plain value.
+   * All other combinations return an ExactValue.
+   *@{
+   */
+  /// Product.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator*(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs * rhs.GetValue();
+  }
+
+  /// Product.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator*(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() * rhs;
+  }
+
+  /// Product.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator*(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() * rhs.GetValue());
+  }
+
+  /// Product.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator*(const ExactValue<U>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() * rhs);
+  }
+
+  /// Product.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator*(const U& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs * rhs.GetValue());
+  }
+
+  /// Division.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator/(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs / rhs.GetValue();
+  }
+
+  /// Division.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator/(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() / rhs;
+  }
+
+  /// Division.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator/(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() / rhs.GetValue());
+  }
+
+  /// Division.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator/(const ExactValue<U>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() / rhs);
+  }
+
+  /// Division.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator/(const U& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs / rhs.GetValue());
+  }
+
+  /// Addition.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator+(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs + rhs.GetValue();
+  }
+
+  /// Addition.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator+(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() + rhs;
+  }
+
+  /// Addition.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator+(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() + rhs.GetValue());
+  }
+
+  /// Addition.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator+(const ExactValue<U>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() + rhs);
+  }
+
+  /// Addition.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator+(const U& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs + rhs.GetValue());
+  }
+
+  /// Subtraction.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator-(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs - rhs.GetValue();
+  }
+
+  /// Subtraction.
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator-(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() - rhs;
+  }
+
+  /// Subtraction.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator-(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() - rhs.GetValue());
+  }
+
+  /// Subtraction.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator-(const ExactValue<U>& lhs, const V& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs.GetValue() - rhs);
+  }
+
+  /// Subtraction.
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  operator-(const U& lhs, const ExactValue<V>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(lhs - rhs.GetValue());
+  }
+
+  ///@}
+
+  /** @name Comparison operator definitions
+   *
+   * Comparisons with a ValueWithError are forwarded to the comparison with the plain value and therefore use the policy
+   * of the ValueWithError.
+   *@{
+   */
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator==(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs == rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator==(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() == rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator==(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs.GetValue() == rhs.GetValue();
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator==(const ExactValue<U>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() == rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator==(const U& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs == rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator!=(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs != rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator!=(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() != rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator!=(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs.GetValue() != rhs.GetValue();
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator!=(const ExactValue<U>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() != rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator!=(const U& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs != rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs < rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() < rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator<(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs.GetValue() < rhs.GetValue();
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator<(const ExactValue<U>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() < rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator<(const U& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs < rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs > rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() > rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator>(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs.GetValue() > rhs.GetValue();
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator>(const ExactValue<U>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() > rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator>(const U& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs > rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<=(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs <= rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator<=(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() <= rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator<=(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs.GetValue() <= rhs.GetValue();
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator<=(const ExactValue<U>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() <= rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator<=(const U& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs <= rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>=(const ValueWithError<U, P>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs >= rhs.GetValue();
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR bool
+  operator>=(const ExactValue<U>& lhs, const ValueWithError<V, P>& rhs)
+  {
+    return lhs.GetValue() >= rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator>=(const ExactValue<U>& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs.GetValue() >= rhs.GetValue();
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator>=(const ExactValue<U>& lhs, const V& rhs)
+  {
+    return lhs.GetValue() >= rhs;
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR bool
+  operator>=(const U& lhs, const ExactValue<V>& rhs)
+  {
+    return lhs >= rhs.GetValue();
+  }
+
+  ///@}
+
+  ///@name Conversion operators
+  ///@{
+
+  /// Output format: "value"
+  template<typename charT, typename traits, typename T>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const ExactValue<T>& v)
+  {
+    return out << v.GetValue();
+  }
+  ///@}
+
+  /**@name Mathematical function overloads
+   *
+   * Functions of exact values are exact, two argument functions with one ValueWithError argument use the
+   * overload for a general compatible type.
+   *@{
+   */
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  abs(const ExactValue<T>& v)
+  {
+    using std::abs;
+    return ExactValue<T>(abs(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  acos(const ExactValue<T>& v)
+  {
+    using std::acos;
+    return ExactValue<T>(acos(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  asin(const ExactValue<T>& v)
+  {
+    using std::asin;
+    return ExactValue<T>(asin(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  atan(const ExactValue<T>& v)
+  {
+    using std::atan;
+    return ExactValue<T>(atan(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  asinh(const ExactValue<T>& v)
+  {
+    using std::asinh;
+    return ExactValue<T>(asinh(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  acosh(const ExactValue<T>& v)
+  {
+    using std::acosh;
+    return ExactValue<T>(acosh(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  atanh(const ExactValue<T>& v)
+  {
+    using std::atanh;
+    return ExactValue<T>(atanh(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  cbrt(const ExactValue<T>& v)
+  {
+    using std::cbrt;
+    return ExactValue<T>(cbrt(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  cos(const ExactValue<T>& v)
+  {
+    using std::cos;
+    return ExactValue<T>(cos(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  cosh(const ExactValue<T>& v)
+  {
+    using std::cosh;
+    return ExactValue<T>(cosh(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  erf(const ExactValue<T>& v)
+  {
+    using std::erf;
+    return ExactValue<T>(erf(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  erfc(const ExactValue<T>& v)
+  {
+    using std::erfc;
+    return ExactValue<T>(erfc(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  exp2(const ExactValue<T>& v)
+  {
+    using std::exp2;
+    return ExactValue<T>(exp2(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  exp(const ExactValue<T>& v)
+  {
+    using std::exp;
+    return ExactValue<T>(exp(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  expm1(const ExactValue<T>& v)
+  {
+    using std::expm1;
+    return ExactValue<T>(expm1(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  fabs(const ExactValue<T>& v)
+  {
+    using std::fabs;
+    return ExactValue<T>(fabs(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  lgamma(const ExactValue<T>& v)
+  {
+    using std::lgamma;
+    return ExactValue<T>(lgamma(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  log(const ExactValue<T>& v)
+  {
+    using std::log;
+    return ExactValue<T>(log(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  log10(const ExactValue<T>& v)
+  {
+    using std::log10;
+    return ExactValue<T>(log10(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  log1p(const ExactValue<T>& v)
+  {
+    using std::log1p;
+    return ExactValue<T>(log1p(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  log2(const ExactValue<T>& v)
+  {
+    using std::log2;
+    return ExactValue<T>(log2(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  sin(const ExactValue<T>& v)
+  {
+    using std::sin;
+    return ExactValue<T>(sin(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  sinh(const ExactValue<T>& v)
+  {
+    using std::sinh;
+    return ExactValue<T>(sinh(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  sqrt(const ExactValue<T>& v)
+  {
+    using std::sqrt;
+    return ExactValue<T>(sqrt(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  tan(const ExactValue<T>& v)
+  {
+    using std::tan;
+    return ExactValue<T>(tan(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  tanh(const ExactValue<T>& v)
+  {
+    using std::tanh;
+    return ExactValue<T>(tanh(v.GetValue()));
+  }
+
+  template<typename T>
+  CONSTEXPR ExactValue<T>
+  tgamma(const ExactValue<T>& v)
+  {
+    using std::tgamma;
+    return ExactValue<T>(tgamma(v.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  atan2(const ValueWithError<U, P>& x, const ExactValue<V>& y)
+  {
+    return atan2(x, y.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  atan2(const ExactValue<U>& x, const ValueWithError<V, P>& y)
+  {
+    return atan2(x.GetValue(), y);
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  atan2(const ExactValue<U>& x, const ExactValue<V>& y)
+  {
+    using std::atan2;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(atan2(x.GetValue(), y.GetValue()));
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  atan2(const ExactValue<U>& x, const V& y)
+  {
+    using std::atan2;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(atan2(x.GetValue(), y));
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  atan2(const U& x, const ExactValue<V>& y)
+  {
+    using std::atan2;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(atan2(x, y.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  hypot(const ValueWithError<U, P>& x, const ExactValue<V>& y)
+  {
+    return hypot(x, y.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  hypot(const ExactValue<U>& x, const ValueWithError<V, P>& y)
+  {
+    return hypot(x.GetValue(), y);
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  hypot(const ExactValue<U>& x, const ExactValue<V>& y)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(detail::hypot(x.GetValue(), y.GetValue()));
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  hypot(const ExactValue<U>& x, const V& y)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(detail::hypot(x.GetValue(), y));
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  hypot(const U& x, const ExactValue<V>& y)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(detail::hypot(x, y.GetValue()));
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  pow(const ValueWithError<U, P>& x, const ExactValue<V>& y)
+  {
+    return pow(x, y.GetValue());
+  }
+
+  template<typename U, typename V, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V>::type, P>
+  pow(const ExactValue<U>& x, const ValueWithError<V, P>& y)
+  {
+    return pow(x.GetValue(), y);
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  pow(const ExactValue<U>& x, const ExactValue<V>& y)
+  {
+    using std::pow;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(pow(x.GetValue(), y.GetValue()));
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  pow(const ExactValue<U>& x, const V& y)
+  {
+    using std::pow;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(pow(x.GetValue(), y));
+  }
+
+  template<typename U, typename V>
+  CONSTEXPR ExactValue<typename detail::promote_args<U, V>::type>
+  pow(const U& x, const ExactValue<V>& y)
+  {
+    using std::pow;
+    typedef typename detail::promote_args<U, V>::type R;
+    return ExactValue<R>(pow(x, y.GetValue()));
+  }
+
+  ///@}
+
+} // namespace error_propagation
+
+#endif // EXACT_VALUE_HPP
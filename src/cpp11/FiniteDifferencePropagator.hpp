@@ -0,0 +1,361 @@
+#ifndef FINITE_DIFFERENCE_PROPAGATOR_HPP
+#define FINITE_DIFFERENCE_PROPAGATOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "ValueWithError.hpp"
+#include "DetailIndexSequence.hpp"
+#include "ThreadPool.hpp"
+
+namespace error_propagation {
+
+  /** @brief Error propagation for black-box functions using numerical derivatives
+   *
+   * For functions which only accept plain values, e.g. from third-party libraries, and can therefore neither use
+   * the ValueWithError overloads nor propagate(). The partial derivatives are estimated with central differences
+   * and Richardson extrapolation. The step size is halved until the estimated error of the derivative is below
+   * the tolerance or the maximum number of refinements is reached, in the latter case the best estimate is used.
+   * The errors of the arguments are assumed to be uncorrelated.
+   *
+   * With a ThreadPool the partial derivatives of a single call and the tuples of a batch are evaluated in
+   * parallel, the callable must then be safe to call concurrently. Step caching reuses the accepted step size
+   * of each argument position as starting point, this saves the refinements for similar inputs. In batch mode
+   * the cache is filled by the first tuple and then only read.
+   *
+   * A single object must not be used concurrently from multiple threads.
+   *
+   * @code{cpp}
+     ThreadPool pool;
+     FiniteDifferencePropagator<double> propagator(&pool);
+     auto y = propagator.Propagate([](double a, double b) { return library_function(a, b); },
+                                   make_value(1.0, 0.1), make_value(2.0, 0.1));
+     @endcode
+   *
+   * @tparam T  Arithmetic type of the arguments and the result of the callable
+   */
+  template<typename T = double>
+  class FiniteDifferencePropagator
+  {
+    public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    /// @param pool optional thread pool for parallel evaluation, must outlive this object
+    explicit FiniteDifferencePropagator(ThreadPool* pool = nullptr)
+      :
+      m_pool(pool),
+      m_initialStep(DefaultInitialStep()),
+      m_tolerance(DefaultTolerance()),
+      m_maxRefinements(8),
+      m_stepCaching(false),
+      m_numEvaluations(0)
+    {}
+
+    FiniteDifferencePropagator(const FiniteDifferencePropagator&) = delete;
+    FiniteDifferencePropagator& operator=(const FiniteDifferencePropagator&) = delete;
+
+    /// Optimal relative step for central differences with one Richardson extrapolation, eps^(1/5)
+    static T DefaultInitialStep()
+    {
+      using std::pow;
+      return pow(std::numeric_limits<T>::epsilon(), T(0.2));
+    }
+
+    /// Accuracy of a plain central difference with the optimal step, eps^(1/3)
+    static T DefaultTolerance()
+    {
+      using std::cbrt;
+      return cbrt(std::numeric_limits<T>::epsilon());
+    }
+
+    ///@name Settings
+    ///@{
+    /// Starting step relative to max(|x|, 1)
+    void SetInitialStep(const T& relativeStep)
+    {
+      assert(relativeStep > T());
+      m_initialStep = relativeStep;
+      ClearStepCache();
+    }
+
+    const T& GetInitialStep() const
+    {
+      return m_initialStep;
+    }
+
+    /// Relative tolerance for the estimated error of each partial derivative, the extrapolated result is usually much better
+    void SetTolerance(const T& tolerance)
+    {
+      m_tolerance = tolerance;
+    }
+
+    const T& GetTolerance() const
+    {
+      return m_tolerance;
+    }
+
+    /// Maximum number of step halvings per partial derivative
+    void SetMaxRefinements(size_type maxRefinements)
+    {
+      m_maxRefinements = maxRefinements;
+    }
+
+    size_type GetMaxRefinements() const
+    {
+      return m_maxRefinements;
+    }
+
+    void SetStepCaching(bool enable)
+    {
+      m_stepCaching = enable;
+    }
+
+    bool GetStepCaching() const
+    {
+      return m_stepCaching;
+    }
+
+    void ClearStepCache()
+    {
+      m_stepCache.clear();
+    }
+    ///@}
+
+    ///@name Evaluation statistics
+    ///@{
+    /// Number of calls of the callable since construction or the last reset
+    size_type GetNumEvaluations() const
+    {
+      return m_numEvaluations;
+    }
+
+    void ResetNumEvaluations()
+    {
+      m_numEvaluations = 0;
+    }
+    ///@}
+
+    /// Propagate the errors of the arguments through f, which is called with the values as N arguments of type T
+    template<typename F, typename P, typename... Args>
+    ValueWithError<T, P> Propagate(F f, const ValueWithError<T, P>& first, const Args&... rest)
+    {
+      const std::array<ValueWithError<T, P>, sizeof...(Args) + 1> args = {{ first, rest... }};
+      return Propagate(f, args);
+    }
+
+    /// Propagate the errors of the arguments through f, which is called with the values as N arguments of type T
+    template<typename F, typename P, std::size_t N>
+    ValueWithError<T, P> Propagate(F f, const std::array<ValueWithError<T, P>, N>& args)
+    {
+      std::array<T, N> steps = GetStartSteps<N>();
+      size_type numEvaluations = 0;
+
+      const ValueWithError<T, P> result = Evaluate(f, args, steps, numEvaluations, m_pool);
+
+      m_numEvaluations += numEvaluations;
+
+      if(m_stepCaching)
+      {
+        m_stepCache.assign(steps.begin(), steps.end());
+      }
+
+      return result;
+    }
+
+    /** @brief Propagate the errors of each tuple of arguments through f
+     *
+     * The tuples are distributed over the threads of the pool, the partial derivatives of one tuple are
+     * evaluated sequentially.
+     */
+    template<typename F, typename P, std::size_t N>
+    std::vector<ValueWithError<T, P> > PropagateBatch(F f, const std::vector<std::array<ValueWithError<T, P>, N> >& batch)
+    {
+      std::vector<ValueWithError<T, P> > results(batch.size());
+
+      if(batch.empty())
+      {
+        return results;
+      }
+
+      size_type begin = 0;
+
+      if(m_stepCaching && m_stepCache.size() != N)
+      {
+        results[0] = Propagate(f, batch[0]);
+        begin = 1;
+      }
+
+      const std::array<T, N> startSteps = GetStartSteps<N>();
+      std::atomic<size_type> numEvaluations(0);
+
+      auto work = [&](size_type first, size_type last)
+      {
+        size_type count = 0;
+
+        for(size_type i = begin + first; i < begin + last; i++)
+        {
+          std::array<T, N> steps = startSteps;
+          results[i] = Evaluate(f, batch[i], steps, count, nullptr);
+        }
+
+        numEvaluations += count;
+      };
+
+      if(m_pool)
+      {
+        m_pool->ParallelFor(batch.size() - begin, 1, work);
+      }
+      else
+      {
+        work(0, batch.size() - begin);
+      }
+
+      m_numEvaluations += numEvaluations;
+
+      return results;
+    }
+
+    private:
+    template<std::size_t N>
+    std::array<T, N> GetStartSteps() const
+    {
+      std::array<T, N> steps;
+      steps.fill(m_initialStep);
+
+      if(m_stepCaching && m_stepCache.size() == N)
+      {
+        std::copy(m_stepCache.begin(), m_stepCache.end(), steps.begin());
+      }
+
+      return steps;
+    }
+
+    template<typename F, typename P, std::size_t N>
+    ValueWithError<T, P> Evaluate(F& f, const std::array<ValueWithError<T, P>, N>& args, std::array<T, N>& steps,
+                                  size_type& numEvaluations, ThreadPool* pool) const
+    {
+      std::array<T, N> point;
+      for(std::size_t i = 0; i < N; i++)
+      {
+        point[i] = args[i].GetValue();
+      }
+
+      const T value = detail::call_with_array(f, point, detail::make_index_sequence<N>());
+      numEvaluations++;
+
+      std::array<T, N> derivatives;
+      std::array<size_type, N> counts;
+      counts.fill(0);
+
+      if(pool && N > 1)
+      {
+        // the caller runs queued tasks while it waits, so this is safe from within a task of the same pool
+        pool->ParallelFor(N, 1, [&](size_type begin, size_type end)
+        {
+          for(size_type i = begin; i < end; i++)
+          {
+            derivatives[i] = Derivative(f, point, i, steps[i], counts[i]);
+          }
+        });
+      }
+      else
+      {
+        for(std::size_t i = 0; i < N; i++)
+        {
+          derivatives[i] = Derivative(f, point, i, steps[i], counts[i]);
+        }
+      }
+
+      T error = T();
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        error = detail::combine_errors<P>(error, derivatives[i] * args[i].GetError());
+        numEvaluations += counts[i];
+      }
+
+      return ValueWithError<T, P>(value, error);
+    }
+
+    /// Adaptive estimate of the partial derivative with respect to argument i, updates the relative step
+    template<typename F, std::size_t N>
+    T Derivative(F& f, std::array<T, N> point, std::size_t i, T& relativeStep, size_type& numEvaluations) const
+    {
+      using std::abs;
+
+      const T scale = std::max(abs(point[i]), T(1));
+
+      T step = relativeStep * scale;
+      T coarse = CentralDifference(f, point, i, step, numEvaluations);
+
+      T best = coarse;
+      T bestError = std::numeric_limits<T>::infinity();
+      T bestStep = relativeStep;
+
+      for(size_type level = 0; level <= m_maxRefinements; level++)
+      {
+        const T fine = CentralDifference(f, point, i, step / T(2), numEvaluations);
+
+        // Richardson extrapolation removes the leading h^2 term, the difference estimates the remaining error
+        const T extrapolated = (T(4) * fine - coarse) / T(3);
+        const T error = abs(fine - coarse) / T(3);
+
+        if(error < bestError)
+        {
+          best = extrapolated;
+          bestError = error;
+          bestStep = step / scale;
+        }
+
+        if(error <= m_tolerance * abs(extrapolated))
+        {
+          break;
+        }
+
+        step /= T(2);
+        coarse = fine;
+      }
+
+      relativeStep = bestStep;
+      return best;
+    }
+
+    template<typename F, std::size_t N>
+    T CentralDifference(F& f, std::array<T, N>& point, std::size_t i, const T& step, size_type& numEvaluations) const
+    {
+      const T x = point[i];
+
+      point[i] = x + step;
+      const T high = point[i];
+      const T fHigh = detail::call_with_array(f, point, detail::make_index_sequence<N>());
+
+      point[i] = x - step;
+      const T low = point[i];
+      const T fLow = detail::call_with_array(f, point, detail::make_index_sequence<N>());
+
+      point[i] = x;
+      numEvaluations += 2;
+
+      // the actually representable step, not the requested one
+      return (fHigh - fLow) / (high - low);
+    }
+
+    ThreadPool* m_pool;
+    T m_initialStep;
+    T m_tolerance;
+    size_type m_maxRefinements;
+    bool m_stepCaching;
+    std::vector<T> m_stepCache;
+    std::atomic<size_type> m_numEvaluations;
+  };
+
+} // namespace error_propagation
+
+#endif // FINITE_DIFFERENCE_PROPAGATOR_HPP
@@ -0,0 +1,564 @@
+#ifndef MIXED_PRECISION_VALUE_WITH_ERROR_HPP
+#define MIXED_PRECISION_VALUE_WITH_ERROR_HPP
+
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+
+#include "ValueWithError.hpp"
+#include "DetailDerivatives.hpp"
+
+namespace error_propagation {
+
+  /** @brief Value with error where the error is stored with a smaller type than the value
+   *
+   * Errors are only meaningful to a few significant digits, so storing them with the full precision of the
+   * value wastes memory bandwidth and, for multiprecision types, computing time. Here the value is computed
+   * with T and the error with E, the derivatives for the error propagation are evaluated at the value converted
+   * to E. Examples are double values with float errors, or cpp_dec_float_100 or DoubleDouble values with double
+   * errors. Whether the object actually gets smaller depends on the alignment of T, e.g.
+   * MixedPrecisionValueWithError<double, float> is padded to 16 bytes, use separate arrays for the values and
+   * errors in that case.
+   *
+   * Operations between two objects promote the value types and the error types separately, as in
+   * ValueWithError. Plain values of arithmetic type or of type T are converted to T.
+   *
+   * @code{cpp}
+     typedef boost::multiprecision::cpp_dec_float_100 MP;
+     MixedPrecisionValueWithError<MP, double> x(MP(2), 0.1);
+     auto y = exp(x) * sqrt(x);            // error arithmetic in double only
+     std::cout << y.ToValueWithError();
+     @endcode
+   *
+   * @tparam T  Arithmetic type of the value, see ValueWithError
+   * @tparam E  Arithmetic type of the error, T must be convertible to E
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename E, typename P = DEFAULT_POLICY_CLASS>
+  class MixedPrecisionValueWithError
+  {
+    public:
+    typedef T value_type;
+    typedef E error_type;
+    typedef P policy_type;
+
+    ///@name Constructor
+    ///@{
+    MixedPrecisionValueWithError(const T& value, const E& error)
+      :
+      m_value(value),
+      m_error(abs(error))
+    {}
+
+    MixedPrecisionValueWithError()
+      :
+      m_value(),
+      m_error()
+    {}
+
+    explicit MixedPrecisionValueWithError(const ValueWithError<T, P>& v)
+      :
+      m_value(v.GetValue()),
+      m_error(static_cast<E>(v.GetError()))
+    {}
+
+    template<typename U, typename F>
+    MixedPrecisionValueWithError(const MixedPrecisionValueWithError<U, F, P>& rhs)
+      :
+      m_value(static_cast<T>(rhs.GetValue())),
+      m_error(static_cast<E>(rhs.GetError()))
+    {}
+    ///@}
+
+    ///@name Getters
+    ///@{
+    const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    const E& GetError() const
+    {
+      return m_error;
+    }
+    ///@}
+
+    /// Error converted to the value type
+    ValueWithError<T, P> ToValueWithError() const
+    {
+      return ValueWithError<T, P>(m_value, static_cast<T>(m_error));
+    }
+
+    ///@name Compound operators
+    ///@{
+    template<typename U>
+    MixedPrecisionValueWithError& operator*=(const U& rhs)
+    {
+      return *this = *this * rhs;
+    }
+
+    template<typename U>
+    MixedPrecisionValueWithError& operator/=(const U& rhs)
+    {
+      return *this = *this / rhs;
+    }
+
+    template<typename U>
+    MixedPrecisionValueWithError& operator+=(const U& rhs)
+    {
+      return *this = *this + rhs;
+    }
+
+    template<typename U>
+    MixedPrecisionValueWithError& operator-=(const U& rhs)
+    {
+      return *this = *this - rhs;
+    }
+    ///@}
+
+  private:
+    T m_value;
+    E m_error;
+  };
+
+  namespace detail {
+
+    /// Enables the overloads for a MixedPrecisionValueWithError and a plain value of arithmetic type or its own value type only
+    template<typename U, typename T, typename R>
+    struct enable_if_mixed_precision_scalar : std::enable_if<std::is_arithmetic<U>::value || std::is_same<U, T>::value, R>
+    {};
+
+    template<Opcode op, typename T, typename E, typename P>
+    MixedPrecisionValueWithError<T, E, P>
+    mixed_precision_unary(const MixedPrecisionValueWithError<T, E, P>& a)
+    {
+      return MixedPrecisionValueWithError<T, E, P>(opcode_function<op>::apply(a.GetValue()),
+                                                   derivative<op>::first(static_cast<E>(a.GetValue())) * a.GetError());
+    }
+
+    template<Opcode op, typename T1, typename E1, typename T2, typename E2, typename P>
+    MixedPrecisionValueWithError<typename promote_args<T1, T2>::type, typename promote_args<E1, E2>::type, P>
+    mixed_precision_binary(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+    {
+      typedef typename promote_args<T1, T2>::type T;
+      typedef typename promote_args<E1, E2>::type E;
+
+      E dl, dr;
+      derivative<op>::first(static_cast<E>(lhs.GetValue()), static_cast<E>(rhs.GetValue()), dl, dr);
+
+      return MixedPrecisionValueWithError<T, E, P>(opcode_function<op>::template apply<T>(static_cast<T>(lhs.GetValue()),
+                                                                                          static_cast<T>(rhs.GetValue())),
+                                                   combine_errors<P>(dl * static_cast<E>(lhs.GetError()), dr * static_cast<E>(rhs.GetError())));
+    }
+
+    template<Opcode op, typename T, typename E, typename P>
+    MixedPrecisionValueWithError<T, E, P>
+    mixed_precision_binary(const MixedPrecisionValueWithError<T, E, P>& lhs, const T& r)
+    {
+      E dl, dr;
+      derivative<op>::first(static_cast<E>(lhs.GetValue()), static_cast<E>(r), dl, dr);
+
+      return MixedPrecisionValueWithError<T, E, P>(opcode_function<op>::template apply<T>(lhs.GetValue(), r),
+                                                   dl * lhs.GetError());
+    }
+
+    template<Opcode op, typename T, typename E, typename P>
+    MixedPrecisionValueWithError<T, E, P>
+    mixed_precision_binary(const T& l, const MixedPrecisionValueWithError<T, E, P>& rhs)
+    {
+      E dl, dr;
+      derivative<op>::first(static_cast<E>(l), static_cast<E>(rhs.GetValue()), dl, dr);
+
+      return MixedPrecisionValueWithError<T, E, P>(opcode_function<op>::template apply<T>(l, rhs.GetValue()),
+                                                   dr * rhs.GetError());
+    }
+
+  } // namespace detail
+
+
+  /**@name Arithmetic operator definitions
+   *@{
+   */
+
+  /// Product. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  operator*(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Multiply>(lhs, rhs);
+  }
+
+  /// Product. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator*(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Multiply>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Product. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator*(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Multiply>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Division. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  operator/(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Divide>(lhs, rhs);
+  }
+
+  /// Division. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator/(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Divide>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Division. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator/(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Divide>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Addition. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  operator+(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Plus>(lhs, rhs);
+  }
+
+  /// Addition. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator+(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Plus>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Addition. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator+(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Plus>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Subtraction. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  operator-(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Minus>(lhs, rhs);
+  }
+
+  /// Subtraction. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator-(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Minus>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Subtraction. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  operator-(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Minus>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+  /// Output operator, same format as for ValueWithError
+  template<typename T, typename E, typename P, typename charT, typename traits>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return out << v.ToValueWithError();
+  }
+
+  /**@name Math function overloads
+   *
+   * Same set of functions as for ValueWithError.
+   *@{
+   */
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  abs(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Abs>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  acos(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Acos>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  acosh(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Acosh>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  asin(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Asin>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  asinh(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Asinh>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  atan(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Atan>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  atanh(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Atanh>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  cbrt(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Cbrt>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  cos(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Cos>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  cosh(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Cosh>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  erf(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Erf>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  erfc(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Erfc>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  exp(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Exp>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  exp2(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Exp2>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  expm1(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Expm1>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  fabs(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Fabs>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  lgamma(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Lgamma>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  log(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Log>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  log10(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Log10>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  log1p(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Log1p>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  log2(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Log2>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  sin(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Sin>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  sinh(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Sinh>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  sqrt(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Sqrt>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  tan(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Tan>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  tanh(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Tanh>(v);
+  }
+
+  template<typename T, typename E, typename P>
+  MixedPrecisionValueWithError<T, E, P>
+  tgamma(const MixedPrecisionValueWithError<T, E, P>& v)
+  {
+    return detail::mixed_precision_unary<detail::Opcode::Tgamma>(v);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  atan2(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Atan2>(lhs, rhs);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  atan2(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Atan2>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  atan2(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Atan2>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  hypot(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Hypot>(lhs, rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  hypot(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Hypot>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Square root of the sum of the squares. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  hypot(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Hypot>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Raises a number to the given power. Overload for two MixedPrecisionValueWithError arguments.
+  template<typename T1, typename E1, typename T2, typename E2, typename P>
+  MixedPrecisionValueWithError<typename detail::promote_args<T1, T2>::type,
+                               typename detail::promote_args<E1, E2>::type, P>
+  pow(const MixedPrecisionValueWithError<T1, E1, P>& lhs, const MixedPrecisionValueWithError<T2, E2, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Pow>(lhs, rhs);
+  }
+
+  /// Raises a number to the given power. Overload for a MixedPrecisionValueWithError and a plain value.
+  template<typename T, typename E, typename P, typename V>
+  typename detail::enable_if_mixed_precision_scalar<V, T, MixedPrecisionValueWithError<T, E, P> >::type
+  pow(const MixedPrecisionValueWithError<T, E, P>& lhs, const V& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Pow>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Raises a number to the given power. Overload for a plain value and a MixedPrecisionValueWithError.
+  template<typename T, typename E, typename P, typename U>
+  typename detail::enable_if_mixed_precision_scalar<U, T, MixedPrecisionValueWithError<T, E, P> >::type
+  pow(const U& lhs, const MixedPrecisionValueWithError<T, E, P>& rhs)
+  {
+    return detail::mixed_precision_binary<detail::Opcode::Pow>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // MIXED_PRECISION_VALUE_WITH_ERROR_HPP
@@ -0,0 +1,679 @@
+#ifndef MULTI_COMPONENT_VALUE_WITH_ERROR_HPP
+#define MULTI_COMPONENT_VALUE_WITH_ERROR_HPP
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include "ValueWithError.hpp"
+#include "DetailDerivatives.hpp"
+
+namespace error_propagation {
+
+  /** @brief Value with N separate error components, e.g. statistical and several systematic uncertainties
+   *
+   * Every component is propagated as if it were the error of a separate ValueWithError, but the value and the
+   * derivatives are computed only once per operation. The component updates are plain loops over fixed size
+   * arrays which the compiler vectorizes. For floating point types and the default QuadratureCombinationPolicy
+   * the components of two arguments are combined with a square root of the sum of squares, the components which
+   * over- or underflow in the squares are recomputed with the scaled hypot afterwards.
+   *
+   * The components are assumed to be independent sources of uncertainty, GetTotalError() combines them with
+   * the combination policy of P, i.e. in quadrature by default.
+   *
+   * @code{cpp}
+     MultiComponentValueWithError<double, 2> x(1.5, {{0.1, 0.02}});  // statistical, systematic
+     auto y = exp(x) * x;
+     y.GetError(0);       // statistical error of y
+     y.GetTotalError();
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam N  Number of error components
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, std::size_t N, typename P = DEFAULT_POLICY_CLASS>
+  class MultiComponentValueWithError
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef std::array<T, N> error_array;
+
+    static CONSTEXPR std::size_t NumComponents()
+    {
+      return N;
+    }
+
+    ///@name Constructor
+    ///@{
+    MultiComponentValueWithError(const T& value, const error_array& errors)
+      :
+      m_value(value),
+      m_errors(errors)
+    {
+      using std::abs;
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        m_errors[i] = abs(m_errors[i]);
+      }
+    }
+
+    /// Exact value
+    explicit MultiComponentValueWithError(const T& value)
+      :
+      m_value(value),
+      m_errors()
+    {}
+
+    MultiComponentValueWithError()
+      :
+      m_value(),
+      m_errors()
+    {}
+
+    template<typename U>
+    MultiComponentValueWithError(const MultiComponentValueWithError<U, N, P>& rhs)
+      :
+      m_value(static_cast<T>(rhs.GetValue()))
+    {
+      for(std::size_t i = 0; i < N; i++)
+      {
+        m_errors[i] = static_cast<T>(rhs.GetError(i));
+      }
+    }
+    ///@}
+
+    ///@name Getters
+    ///@{
+    const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    const error_array& GetErrors() const
+    {
+      return m_errors;
+    }
+
+    /// Error component i
+    const T& GetError(std::size_t i) const
+    {
+      assert(i < N);
+      return m_errors[i];
+    }
+
+    /// All components combined with the combination policy of P
+    T GetTotalError() const
+    {
+      T total = T();
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        total = detail::combine_errors<P>(total, m_errors[i]);
+      }
+
+      return total;
+    }
+    ///@}
+
+    /// Value with the total error
+    ValueWithError<T, P> ToValueWithError() const
+    {
+      return ValueWithError<T, P>(m_value, GetTotalError());
+    }
+
+    /// Value with error component i only
+    ValueWithError<T, P> GetComponent(std::size_t i) const
+    {
+      return ValueWithError<T, P>(m_value, GetError(i));
+    }
+
+    ///@name Compound operators
+    ///@{
+    template<typename U>
+    MultiComponentValueWithError& operator*=(const U& rhs)
+    {
+      return *this = *this * rhs;
+    }
+
+    template<typename U>
+    MultiComponentValueWithError& operator/=(const U& rhs)
+    {
+      return *this = *this / rhs;
+    }
+
+    template<typename U>
+    MultiComponentValueWithError& operator+=(const U& rhs)
+    {
+      return *this = *this + rhs;
+    }
+
+    template<typename U>
+    MultiComponentValueWithError& operator-=(const U& rhs)
+    {
+      return *this = *this - rhs;
+    }
+    ///@}
+
+  private:
+    T m_value;
+    error_array m_errors;
+  };
+
+  namespace detail {
+
+    /// Enables the overloads for a MultiComponentValueWithError and a plain value of arithmetic type or its own value type only
+    template<typename U, typename T, typename R>
+    struct enable_if_multi_component_scalar : std::enable_if<std::is_arithmetic<U>::value || std::is_same<U, T>::value, R>
+    {};
+
+    /// Combination policy of P is the quadrature sum and T a floating point type
+    template<typename T, typename P>
+    struct is_fast_quadrature : std::integral_constant<bool, std::is_floating_point<T>::value &&
+                                                             std::is_same<typename combination_policy<P>::type,
+                                                                          QuadratureCombinationPolicy>::value>
+    {};
+
+    /// result[i] = combine_errors(dl * lhs[i], dr * rhs[i])
+    template<typename P, typename T, std::size_t N>
+    void combine_components(const T& dl, const std::array<T, N>& lhs, const T& dr, const std::array<T, N>& rhs,
+                            std::array<T, N>& result, std::false_type)
+    {
+      for(std::size_t i = 0; i < N; i++)
+      {
+        result[i] = combine_errors<P>(dl * lhs[i], dr * rhs[i]);
+      }
+    }
+
+    template<typename P, typename T, std::size_t N>
+    void combine_components(const T& dl, const std::array<T, N>& lhs, const T& dr, const std::array<T, N>& rhs,
+                            std::array<T, N>& result, std::true_type)
+    {
+      using std::sqrt;
+
+      // the squares of values in this range neither over- nor underflow
+      const T upper = sqrt(std::numeric_limits<T>::max()) / 2;
+      const T lower = sqrt(std::numeric_limits<T>::min()) * 2;
+
+      // non-short-circuit operators keep the loop free of branches
+      int outOfRange = 0;
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        const T a = dl * lhs[i];
+        const T b = dr * rhs[i];
+        result[i] = sqrt(a * a + b * b);
+        const int overflow = !(result[i] <= upper);
+        const int underflow = (result[i] < lower) & ((a != T()) | (b != T()));
+        outOfRange |= overflow | underflow;
+      }
+
+      if(outOfRange)
+      {
+        combine_components<P>(dl, lhs, dr, rhs, result, std::false_type());
+      }
+    }
+
+    template<Opcode op, typename T, std::size_t N, typename P>
+    MultiComponentValueWithError<T, N, P>
+    multi_component_unary(const MultiComponentValueWithError<T, N, P>& a)
+    {
+      using std::abs;
+
+      const T d = abs(derivative<op>::first(a.GetValue()));
+
+      std::array<T, N> errors;
+      for(std::size_t i = 0; i < N; i++)
+      {
+        errors[i] = d * a.GetError(i);
+      }
+
+      return MultiComponentValueWithError<T, N, P>(opcode_function<op>::apply(a.GetValue()), errors);
+    }
+
+    template<Opcode op, typename T1, typename T2, std::size_t N, typename P>
+    MultiComponentValueWithError<typename promote_args<T1, T2>::type, N, P>
+    multi_component_binary(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+    {
+      typedef typename promote_args<T1, T2>::type T;
+      typedef MultiComponentValueWithError<T, N, P> R;
+
+      // no copies if the types already match
+      const R& l = lhs;
+      const R& r = rhs;
+
+      T dl, dr;
+      derivative<op>::first(l.GetValue(), r.GetValue(), dl, dr);
+
+      std::array<T, N> errors;
+      combine_components<P>(dl, l.GetErrors(), dr, r.GetErrors(), errors, is_fast_quadrature<T, P>());
+
+      return MultiComponentValueWithError<T, N, P>(opcode_function<op>::template apply<T>(l.GetValue(), r.GetValue()), errors);
+    }
+
+    template<Opcode op, typename T, std::size_t N, typename P>
+    MultiComponentValueWithError<T, N, P>
+    multi_component_binary(const MultiComponentValueWithError<T, N, P>& lhs, const T& r)
+    {
+      using std::abs;
+
+      T dl, dr;
+      derivative<op>::first(lhs.GetValue(), r, dl, dr);
+      dl = abs(dl);
+
+      std::array<T, N> errors;
+      for(std::size_t i = 0; i < N; i++)
+      {
+        errors[i] = dl * lhs.GetError(i);
+      }
+
+      return MultiComponentValueWithError<T, N, P>(opcode_function<op>::template apply<T>(lhs.GetValue(), r), errors);
+    }
+
+    template<Opcode op, typename T, std::size_t N, typename P>
+    MultiComponentValueWithError<T, N, P>
+    multi_component_binary(const T& l, const MultiComponentValueWithError<T, N, P>& rhs)
+    {
+      using std::abs;
+
+      T dl, dr;
+      derivative<op>::first(l, rhs.GetValue(), dl, dr);
+      dr = abs(dr);
+
+      std::array<T, N> errors;
+      for(std::size_t i = 0; i < N; i++)
+      {
+        errors[i] = dr * rhs.GetError(i);
+      }
+
+      return MultiComponentValueWithError<T, N, P>(opcode_function<op>::template apply<T>(l, rhs.GetValue()), errors);
+    }
+
+  } // namespace detail
+
+
+  /**@name Arithmetic operator definitions
+   *@{
+   */
+
+  /// Product. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  operator*(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Multiply>(lhs, rhs);
+  }
+
+  /// Product. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  operator*(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Multiply>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Product. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  operator*(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Multiply>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Division. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  operator/(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Divide>(lhs, rhs);
+  }
+
+  /// Division. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  operator/(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Divide>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Division. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  operator/(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Divide>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Addition. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  operator+(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Plus>(lhs, rhs);
+  }
+
+  /// Addition. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  operator+(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Plus>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Addition. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  operator+(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Plus>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Subtraction. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  operator-(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Minus>(lhs, rhs);
+  }
+
+  /// Subtraction. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  operator-(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Minus>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Subtraction. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  operator-(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Minus>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+  /// Output operator, the value with the total error in the same format as for ValueWithError
+  template<typename T, std::size_t N, typename P, typename charT, typename traits>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return out << v.ToValueWithError();
+  }
+
+  /**@name Math function overloads
+   *
+   * Same set of functions as for ValueWithError.
+   *@{
+   */
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  abs(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Abs>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  acos(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Acos>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  acosh(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Acosh>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  asin(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Asin>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  asinh(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Asinh>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  atan(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Atan>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  atanh(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Atanh>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  cbrt(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Cbrt>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  cos(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Cos>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  cosh(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Cosh>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  erf(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Erf>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  erfc(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Erfc>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  exp(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Exp>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  exp2(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Exp2>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  expm1(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Expm1>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  fabs(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Fabs>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  lgamma(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Lgamma>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  log(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Log>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  log10(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Log10>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  log1p(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Log1p>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  log2(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Log2>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  sin(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Sin>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  sinh(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Sinh>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  sqrt(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Sqrt>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  tan(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Tan>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  tanh(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Tanh>(v);
+  }
+
+  template<typename T, std::size_t N, typename P>
+  MultiComponentValueWithError<T, N, P>
+  tgamma(const MultiComponentValueWithError<T, N, P>& v)
+  {
+    return detail::multi_component_unary<detail::Opcode::Tgamma>(v);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  atan2(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Atan2>(lhs, rhs);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  atan2(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Atan2>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  atan2(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Atan2>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  hypot(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Hypot>(lhs, rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  hypot(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Hypot>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Square root of the sum of the squares. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  hypot(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Hypot>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Raises a number to the given power. Overload for two MultiComponentValueWithError arguments.
+  template<typename T1, typename T2, std::size_t N, typename P>
+  MultiComponentValueWithError<typename detail::promote_args<T1, T2>::type, N, P>
+  pow(const MultiComponentValueWithError<T1, N, P>& lhs, const MultiComponentValueWithError<T2, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Pow>(lhs, rhs);
+  }
+
+  /// Raises a number to the given power. Overload for a MultiComponentValueWithError and a plain value.
+  template<typename T, std::size_t N, typename P, typename V>
+  typename detail::enable_if_multi_component_scalar<V, T, MultiComponentValueWithError<T, N, P> >::type
+  pow(const MultiComponentValueWithError<T, N, P>& lhs, const V& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Pow>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Raises a number to the given power. Overload for a plain value and a MultiComponentValueWithError.
+  template<typename T, std::size_t N, typename P, typename U>
+  typename detail::enable_if_multi_component_scalar<U, T, MultiComponentValueWithError<T, N, P> >::type
+  pow(const U& lhs, const MultiComponentValueWithError<T, N, P>& rhs)
+  {
+    return detail::multi_component_binary<detail::Opcode::Pow>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // MULTI_COMPONENT_VALUE_WITH_ERROR_HPP
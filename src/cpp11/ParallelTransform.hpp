@@ -0,0 +1,220 @@
+#ifndef PARALLEL_TRANSFORM_HPP
+#define PARALLEL_TRANSFORM_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include "ValueWithError.hpp"
+#include "ThreadPool.hpp"
+
+namespace error_propagation {
+
+  /** @brief Non-owning view of n elements stored as separate columns of values and errors (structure of arrays)
+   *
+   * The elements are read and written as ValueWithError<T, P>. Use a const T for read-only columns, a mutable
+   * span converts to the corresponding read-only one.
+   *
+   * @tparam T  Arithmetic type of the columns, optionally const
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class ValueWithErrorSpan
+  {
+    public:
+    typedef typename std::remove_const<T>::type value_type;
+    typedef P policy_type;
+    typedef ValueWithError<value_type, P> element_type;
+    typedef std::size_t size_type;
+
+    ValueWithErrorSpan(T* values, T* errors, size_type size)
+      :
+      m_values(values),
+      m_errors(errors),
+      m_size(size)
+    {
+    }
+
+    operator ValueWithErrorSpan<const value_type, P>() const
+    {
+      return ValueWithErrorSpan<const value_type, P>(m_values, m_errors, m_size);
+    }
+
+    size_type size() const
+    {
+      return m_size;
+    }
+
+    T* GetValues() const
+    {
+      return m_values;
+    }
+
+    T* GetErrors() const
+    {
+      return m_errors;
+    }
+
+    element_type Get(size_type i) const
+    {
+      assert(i < m_size);
+      return element_type(m_values[i], m_errors[i]);
+    }
+
+    void Set(size_type i, const element_type& v) const
+    {
+      assert(i < m_size);
+      m_values[i] = v.GetValue();
+      m_errors[i] = v.GetError();
+    }
+
+    private:
+    T* m_values;
+    T* m_errors;
+    size_type m_size;
+  };
+
+  namespace detail {
+
+    inline std::size_t parallel_grain(const ThreadPool& pool, std::size_t n, std::size_t grain)
+    {
+      return grain > 0 ? grain : pool.DefaultGrain(n);
+    }
+
+  } // namespace detail
+
+  /**@name Parallel kernels
+   *
+   * Apply f to every element like std::for_each and std::transform, distributed over the threads of a ThreadPool
+   * with ThreadPool::ParallelFor(). The elements are processed in blocks of grain elements, a grain of zero selects
+   * ThreadPool::DefaultGrain(). For functions whose cost varies strongly between the elements, e.g. tgamma over a
+   * wide range or iterative user functions, a smaller grain lets idle threads steal more of the expensive blocks.
+   *
+   * f is called concurrently from several threads. The results are identical to the serial loop, the output may be
+   * equal to the first input.
+   *
+   * @code{cpp}
+     ThreadPool pool;
+     parallel_transform(pool, x.data(), x.data() + x.size(), y.data(),
+                        [](const ValueWithError<double>& v) { return tgamma(v); }, 256);
+     @endcode
+   *@{
+   */
+
+  /// Calls f(element) for every element of [first, last)
+  template<typename T, typename P, typename F>
+  void parallel_for_each(ThreadPool& pool, ValueWithError<T, P>* first, ValueWithError<T, P>* last, F f,
+                         std::size_t grain = 0)
+  {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        f(first[i]);
+      }
+    });
+  }
+
+  /// Calls f(element) for every element of the read-only [first, last)
+  template<typename T, typename P, typename F>
+  void parallel_for_each(ThreadPool& pool, const ValueWithError<T, P>* first, const ValueWithError<T, P>* last, F f,
+                         std::size_t grain = 0)
+  {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        f(first[i]);
+      }
+    });
+  }
+
+  /// Calls f(element) with a copy of every element of span, use parallel_transform() to modify the elements
+  template<typename T, typename P, typename F>
+  void parallel_for_each(ThreadPool& pool, ValueWithErrorSpan<T, P> span, F f, std::size_t grain = 0)
+  {
+    const std::size_t n = span.size();
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        f(span.Get(i));
+      }
+    });
+  }
+
+  /// Unary kernel, result[i] = f(first[i])
+  template<typename T, typename P, typename F>
+  void parallel_transform(ThreadPool& pool, const ValueWithError<T, P>* first, const ValueWithError<T, P>* last,
+                          ValueWithError<T, P>* result, F f, std::size_t grain = 0)
+  {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        result[i] = f(first[i]);
+      }
+    });
+  }
+
+  /// Binary kernel, result[i] = f(first1[i], first2[i])
+  template<typename T, typename P, typename F>
+  void parallel_transform(ThreadPool& pool, const ValueWithError<T, P>* first1, const ValueWithError<T, P>* last1,
+                          const ValueWithError<T, P>* first2, ValueWithError<T, P>* result, F f, std::size_t grain = 0)
+  {
+    const std::size_t n = static_cast<std::size_t>(last1 - first1);
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        result[i] = f(first1[i], first2[i]);
+      }
+    });
+  }
+
+  /// Unary kernel on columns, result.Set(i, f(input.Get(i))). U is T or const T.
+  template<typename T, typename U, typename P, typename F>
+  void parallel_transform(ThreadPool& pool, ValueWithErrorSpan<U, P> input, ValueWithErrorSpan<T, P> result, F f,
+                          std::size_t grain = 0)
+  {
+    assert(input.size() == result.size());
+    const std::size_t n = input.size();
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        result.Set(i, f(input.Get(i)));
+      }
+    });
+  }
+
+  /// Binary kernel on columns, result.Set(i, f(input1.Get(i), input2.Get(i))). U1 and U2 are T or const T.
+  template<typename T, typename U1, typename U2, typename P, typename F>
+  void parallel_transform(ThreadPool& pool, ValueWithErrorSpan<U1, P> input1, ValueWithErrorSpan<U2, P> input2,
+                          ValueWithErrorSpan<T, P> result, F f, std::size_t grain = 0)
+  {
+    assert(input1.size() == result.size() && input2.size() == result.size());
+    const std::size_t n = input1.size();
+
+    pool.ParallelFor(n, detail::parallel_grain(pool, n, grain), [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        result.Set(i, f(input1.Get(i), input2.Get(i)));
+      }
+    });
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // PARALLEL_TRANSFORM_HPP
@@ -0,0 +1,705 @@
+#ifndef QUANTIZED_ERROR_ARRAY_HPP
+#define QUANTIZED_ERROR_ARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef __F16C__
+#include <immintrin.h>
+#endif // __F16C__
+
+#include "ValueWithError.hpp"
+#include "DetailFunctional.hpp"
+
+namespace error_propagation {
+
+  namespace detail {
+
+    inline std::uint32_t float_to_bits(float f)
+    {
+      std::uint32_t bits;
+      std::memcpy(&bits, &f, sizeof(bits));
+      return bits;
+    }
+
+    inline float bits_to_float(std::uint32_t bits)
+    {
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+    }
+
+    /// 2^exponent for normal results, built from the bits unlike std::ldexp so that loops can be vectorized
+    inline void power_of_two(int exponent, float& result)
+    {
+      result = bits_to_float(static_cast<std::uint32_t>(exponent + 127) << 23);
+    }
+
+    inline void power_of_two(int exponent, double& result)
+    {
+      const std::uint64_t bits = static_cast<std::uint64_t>(exponent + 1023) << 52;
+      std::memcpy(&result, &bits, sizeof(result));
+    }
+
+    /// IEEE binary16 with round to nearest even, overflows to infinity
+    inline std::uint16_t float_to_half(float value)
+    {
+      const std::uint32_t infinity = 255u << 23;
+      const std::uint32_t halfOverflow = (127u + 16u) << 23;
+      const std::uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+      std::uint32_t bits = float_to_bits(value);
+      const std::uint32_t sign = bits & 0x80000000u;
+      bits ^= sign;
+
+      std::uint32_t result;
+
+      if(bits >= halfOverflow)
+      {
+        result = bits > infinity ? 0x7e00u : 0x7c00u;
+      }
+      else if(bits < (113u << 23))
+      {
+        // subnormal, the float addition does the rounding
+        result = float_to_bits(bits_to_float(bits) + bits_to_float(denormMagic)) - denormMagic;
+      }
+      else
+      {
+        const std::uint32_t odd = (bits >> 13) & 1u;
+        bits += ((15u - 127u) << 23) + 0xfffu + odd;
+        result = bits >> 13;
+      }
+
+      return static_cast<std::uint16_t>(result | (sign >> 16));
+    }
+
+    /// Exact, branches compile to selects
+    inline float half_to_float(std::uint16_t half)
+    {
+      const std::uint32_t shiftedExponent = 0x7c00u << 13;
+
+      std::uint32_t bits = (half & 0x7fffu) << 13;
+      const std::uint32_t exponent = bits & shiftedExponent;
+      bits += (127u - 15u) << 23;
+
+      // infinity and NaN
+      bits += exponent == shiftedExponent ? (128u - 16u) << 23 : 0u;
+
+      // subnormal, renormalized by a float subtraction
+      const float subnormal = bits_to_float(bits + (1u << 23)) - bits_to_float(113u << 23);
+      const std::uint32_t magnitude = exponent == 0 ? float_to_bits(subnormal) : bits;
+
+      return bits_to_float(magnitude | (static_cast<std::uint32_t>(half & 0x8000u) << 16));
+    }
+
+    /// Upper half of a float with round to nearest even
+    inline std::uint16_t float_to_bfloat16(float value)
+    {
+      const std::uint32_t bits = float_to_bits(value);
+
+      if(value != value)
+      {
+        return static_cast<std::uint16_t>((bits >> 16) | 0x40u);
+      }
+
+      return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+    }
+
+    inline float bfloat16_to_float(std::uint16_t value)
+    {
+      return bits_to_float(static_cast<std::uint32_t>(value) << 16);
+    }
+
+  } // namespace detail
+
+  /**@name Error encodings for QuantizedErrorArray
+   *
+   * Each encoding converts an error, given together with its value, to a code of type storage_type and back.
+   * Decode() processes a whole block of codes, the loops are simple enough for the compiler to vectorize them.
+   *@{
+   */
+
+  /** @brief IEEE half precision errors
+   *
+   * Relative rounding error at most 2^-11 (0.05%) for errors in [6.1e-5, 65504]. Smaller errors are subnormal
+   * and lose relative precision, errors below 3e-8 become zero and errors above 65504 become infinite.
+   * Decoding uses the F16C instructions if enabled, e.g. with -mf16c, for float values.
+   */
+  struct HalfErrorEncoding
+  {
+    typedef std::uint16_t storage_type;
+
+    template<typename T>
+    static storage_type Encode(const T& /* value */, const T& error)
+    {
+      return detail::float_to_half(static_cast<float>(error));
+    }
+
+    template<typename T>
+    static void Decode(const T* /* values */, const storage_type* codes, T* errors, std::size_t n)
+    {
+      for(std::size_t i = 0; i < n; i++)
+      {
+        errors[i] = static_cast<T>(detail::half_to_float(codes[i]));
+      }
+    }
+
+#ifdef __F16C__
+    static void Decode(const float* /* values */, const storage_type* codes, float* errors, std::size_t n)
+    {
+      std::size_t i = 0;
+
+      for(; i + 8 <= n; i += 8)
+      {
+        _mm256_storeu_ps(errors + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i))));
+      }
+
+      for(; i < n; i++)
+      {
+        errors[i] = detail::half_to_float(codes[i]);
+      }
+    }
+#endif // __F16C__
+  };
+
+  /** @brief bfloat16 errors
+   *
+   * Same range as float, but the relative rounding error is up to 2^-8 (0.4%).
+   */
+  struct BFloat16ErrorEncoding
+  {
+    typedef std::uint16_t storage_type;
+
+    template<typename T>
+    static storage_type Encode(const T& /* value */, const T& error)
+    {
+      return detail::float_to_bfloat16(static_cast<float>(error));
+    }
+
+    template<typename T>
+    static void Decode(const T* /* values */, const storage_type* codes, T* errors, std::size_t n)
+    {
+      for(std::size_t i = 0; i < n; i++)
+      {
+        errors[i] = static_cast<T>(detail::bfloat16_to_float(codes[i]));
+      }
+    }
+  };
+
+  /** @brief Logarithm of the error relative to the value
+   *
+   * Code 0 is an exact value, code c > 0 is the relative error 2^(MinExponent + (c - 1) / 2^CodesPerOctaveLog2).
+   * The relative precision of the error is therefore 2^(2^-(CodesPerOctaveLog2 + 1)) - 1, independent of its
+   * magnitude. Relative errors outside of the range are clamped to the smallest or largest code. Errors of
+   * elements with value zero can't be represented relative to the value and are decoded as zero.
+   *
+   * @tparam Storage            unsigned integer type of the codes
+   * @tparam CodesPerOctaveLog2 binary logarithm of the number of codes per factor two
+   * @tparam MinExponent        binary logarithm of the smallest relative error
+   */
+  template<typename Storage, int CodesPerOctaveLog2, int MinExponent>
+  struct LogQuantizedErrorEncoding
+  {
+    typedef Storage storage_type;
+
+    static CONSTEXPR std::uint32_t CodesPerOctave()
+    {
+      return 1u << CodesPerOctaveLog2;
+    }
+
+    static CONSTEXPR std::uint32_t MaxCode()
+    {
+      return std::numeric_limits<Storage>::max();
+    }
+
+    template<typename T>
+    static storage_type Encode(const T& value, const T& error)
+    {
+      using std::abs;
+      using std::log2;
+
+      if(error == T())
+      {
+        return 0;
+      }
+
+      const T relative = abs(error / value);
+
+      if(!(relative < std::numeric_limits<T>::max()))
+      {
+        return static_cast<storage_type>(MaxCode());
+      }
+
+      const double code = 1.0 + std::floor((static_cast<double>(log2(relative)) - MinExponent) * CodesPerOctave() + 0.5);
+      return static_cast<storage_type>(std::min(std::max(code, 1.0), static_cast<double>(MaxCode())));
+    }
+
+    template<typename T>
+    static void Decode(const T* values, const storage_type* codes, T* errors, std::size_t n)
+    {
+      Decode(values, codes, errors, n, std::integral_constant<bool, (sizeof(Storage) == 1)>());
+    }
+
+  private:
+    /// Few codes, one table lookup per element
+    template<typename T>
+    static void Decode(const T* values, const storage_type* codes, T* errors, std::size_t n, std::true_type)
+    {
+      using std::abs;
+
+      const std::array<T, MaxCode() + 1>& scales = Scales<T>();
+
+      for(std::size_t i = 0; i < n; i++)
+      {
+        errors[i] = abs(values[i]) * scales[codes[i]];
+      }
+    }
+
+    /// Too many codes for a cache friendly table, the exponent is built from the bits
+    template<typename T>
+    static void Decode(const T* values, const storage_type* codes, T* errors, std::size_t n, std::false_type)
+    {
+      using std::abs;
+
+      const std::array<T, 1u << CodesPerOctaveLog2>& mantissas = Mantissas<T>();
+
+      for(std::size_t i = 0; i < n; i++)
+      {
+        const std::uint32_t k = codes[i] == 0 ? 0u : codes[i] - 1u;
+
+        T scale;
+        detail::power_of_two(MinExponent + static_cast<int>(k >> CodesPerOctaveLog2), scale);
+
+        errors[i] = codes[i] == 0 ? T() : abs(values[i]) * mantissas[k & (CodesPerOctave() - 1)] * scale;
+      }
+    }
+
+    /// 2^(k / CodesPerOctave) for one octave
+    template<typename T>
+    static const std::array<T, 1u << CodesPerOctaveLog2>& Mantissas()
+    {
+      static const std::array<T, 1u << CodesPerOctaveLog2> mantissas = []
+      {
+        std::array<T, 1u << CodesPerOctaveLog2> m;
+        for(std::uint32_t k = 0; k < m.size(); k++)
+        {
+          m[k] = static_cast<T>(std::exp2(static_cast<double>(k) / CodesPerOctave()));
+        }
+        return m;
+      }();
+
+      return mantissas;
+    }
+
+    /// Relative error of every code
+    template<typename T>
+    static const std::array<T, MaxCode() + 1>& Scales()
+    {
+      static const std::array<T, MaxCode() + 1> scales = []
+      {
+        std::array<T, MaxCode() + 1> s;
+        s[0] = T();
+        for(std::uint32_t c = 1; c < s.size(); c++)
+        {
+          s[c] = static_cast<T>(std::exp2(MinExponent + static_cast<double>(c - 1) / CodesPerOctave()));
+        }
+        return s;
+      }();
+
+      return scales;
+    }
+  };
+
+  /// One byte per error, relative errors from 6e-8 to 215 with a precision of 4.4%
+  typedef LogQuantizedErrorEncoding<std::uint8_t, 3, -24> LogQuantized8ErrorEncoding;
+
+  /// Two bytes per error, relative errors from 1.4e-17 to 256 with a precision of 0.034%
+  typedef LogQuantizedErrorEncoding<std::uint16_t, 10, -56> LogQuantized16ErrorEncoding;
+  ///@}
+
+  /** @brief Array of values with errors stored in a compact encoding
+   *
+   * For large, memory-bound datasets where the error column would cost as much as the values. The values are
+   * stored with full precision, the errors with one of HalfErrorEncoding, BFloat16ErrorEncoding,
+   * LogQuantized8ErrorEncoding or LogQuantized16ErrorEncoding, see there for the precision loss. The errors are
+   * decoded on the fly in blocks, element-wise operations use the ValueWithError operators and encode the
+   * resulting errors again, so the quantization error is added in every operation.
+   *
+   * @code{cpp}
+     QuantizedErrorArray<float, HalfErrorEncoding> a(values, errors);
+     auto b = a * 2.0f + a;
+     std::vector<ValueWithError<float>> result = b.ToDense();
+     @endcode
+   *
+   * @tparam T        float or double
+   * @tparam Encoding Error encoding
+   * @tparam P        Policy class, see ValueWithError
+   */
+  template<typename T, typename Encoding, typename P = DEFAULT_POLICY_CLASS>
+  class QuantizedErrorArray
+  {
+    public:
+    typedef T value_type;
+    typedef Encoding encoding_type;
+    typedef typename Encoding::storage_type storage_type;
+    typedef P policy_type;
+    typedef std::size_t size_type;
+
+    /// Number of elements decoded at once
+    static CONSTEXPR size_type BlockSize()
+    {
+      return 256;
+    }
+
+    ///@name Constructor
+    ///@{
+    QuantizedErrorArray()
+    {}
+
+    /// Array from values and errors of the same size
+    QuantizedErrorArray(std::vector<T> values, const std::vector<T>& errors)
+      :
+      m_values(std::move(values))
+    {
+      using std::abs;
+
+      assert(m_values.size() == errors.size());
+
+      m_codes.reserve(m_values.size());
+      for(size_type i = 0; i < m_values.size(); i++)
+      {
+        m_codes.push_back(Encoding::Encode(m_values[i], abs(errors[i])));
+      }
+    }
+
+    /// Conversion from the dense representation
+    explicit QuantizedErrorArray(const std::vector<ValueWithError<T, P>>& dense)
+    {
+      m_values.reserve(dense.size());
+      m_codes.reserve(dense.size());
+
+      for(const ValueWithError<T, P>& v : dense)
+      {
+        m_values.push_back(v.GetValue());
+        m_codes.push_back(Encoding::Encode(v.GetValue(), v.GetError()));
+      }
+    }
+
+    /// Array from values and already encoded errors, e.g. read from a file
+    static QuantizedErrorArray FromCodes(std::vector<T> values, std::vector<storage_type> codes)
+    {
+      assert(values.size() == codes.size());
+
+      QuantizedErrorArray result;
+      result.m_values = std::move(values);
+      result.m_codes = std::move(codes);
+      return result;
+    }
+    ///@}
+
+    /// Conversion to the dense representation
+    std::vector<ValueWithError<T, P>> ToDense() const
+    {
+      std::vector<ValueWithError<T, P>> dense(m_values.size());
+      Decode(0, m_values.size(), dense.data());
+      return dense;
+    }
+
+    /// Decodes the errors of the elements [begin, end)
+    void DecodeErrors(size_type begin, size_type end, T* errors) const
+    {
+      assert(begin <= end && end <= m_values.size());
+      Encoding::Decode(m_values.data() + begin, m_codes.data() + begin, errors, end - begin);
+    }
+
+    /// Decodes the elements [begin, end)
+    void Decode(size_type begin, size_type end, ValueWithError<T, P>* result) const
+    {
+      std::array<T, BlockSize()> errors;
+
+      for(size_type first = begin; first < end; first += BlockSize())
+      {
+        const size_type last = std::min(first + BlockSize(), end);
+        DecodeErrors(first, last, errors.data());
+
+        for(size_type i = first; i < last; i++)
+        {
+          result[i - begin] = ValueWithError<T, P>(m_values[i], errors[i - first]);
+        }
+      }
+    }
+
+    ///@name Getters
+    ///@{
+    size_type size() const
+    {
+      return m_values.size();
+    }
+
+    /// Element i, prefer Decode() for ranges
+    ValueWithError<T, P> operator[](size_type i) const
+    {
+      T error;
+      DecodeErrors(i, i + 1, &error);
+      return ValueWithError<T, P>(m_values[i], error);
+    }
+
+    const std::vector<T>& GetValues() const
+    {
+      return m_values;
+    }
+
+    const std::vector<storage_type>& GetCodes() const
+    {
+      return m_codes;
+    }
+
+    /// Storage per element
+    static CONSTEXPR size_type BytesPerElement()
+    {
+      return sizeof(T) + sizeof(storage_type);
+    }
+    ///@}
+
+    ///@name Arithmetic operators
+    ///@{
+    template<typename U>
+    QuantizedErrorArray<T, Encoding, P>&
+    operator*=(const U& rhs)
+    {
+      *this = (*this) * rhs;
+      return *this;
+    }
+
+    template<typename U>
+    QuantizedErrorArray<T, Encoding, P>&
+    operator/=(const U& rhs)
+    {
+      *this = (*this) / rhs;
+      return *this;
+    }
+
+    template<typename U>
+    QuantizedErrorArray<T, Encoding, P>&
+    operator+=(const U& rhs)
+    {
+      *this = (*this) + rhs;
+      return *this;
+    }
+
+    template<typename U>
+    QuantizedErrorArray<T, Encoding, P>&
+    operator-=(const U& rhs)
+    {
+      *this = (*this) - rhs;
+      return *this;
+    }
+    ///@}
+
+    void swap(QuantizedErrorArray<T, Encoding, P>& obj)
+    {
+      using std::swap;
+      swap(this->m_values, obj.m_values);
+      swap(this->m_codes, obj.m_codes);
+    }
+
+  private:
+    std::vector<T> m_values;
+    std::vector<storage_type> m_codes;
+  };
+
+  template<typename T, typename Encoding, typename P>
+  void swap(QuantizedErrorArray<T, Encoding, P>& lhs, QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  namespace detail {
+
+    /// Element-wise operation, f(i, lhsError, rhsError) returns the resulting ValueWithError of element i
+    template<typename T, typename Encoding, typename P, typename F>
+    QuantizedErrorArray<T, Encoding, P>
+    quantized_op(const QuantizedErrorArray<T, Encoding, P>* lhs, const QuantizedErrorArray<T, Encoding, P>* rhs,
+                 std::size_t n, F f)
+    {
+      typedef QuantizedErrorArray<T, Encoding, P> Array;
+
+      std::vector<T> values(n);
+      std::vector<typename Array::storage_type> codes(n);
+      std::array<T, Array::BlockSize()> le, re;
+      le.fill(T());
+      re.fill(T());
+
+      for(std::size_t first = 0; first < n; first += Array::BlockSize())
+      {
+        const std::size_t last = std::min(first + Array::BlockSize(), n);
+
+        if(lhs)
+        {
+          lhs->DecodeErrors(first, last, le.data());
+        }
+
+        if(rhs)
+        {
+          rhs->DecodeErrors(first, last, re.data());
+        }
+
+        for(std::size_t i = first; i < last; i++)
+        {
+          const ValueWithError<T, P> result = f(i, le[i - first], re[i - first]);
+          values[i] = result.GetValue();
+          codes[i] = Encoding::Encode(result.GetValue(), result.GetError());
+        }
+      }
+
+      return Array::FromCodes(std::move(values), std::move(codes));
+    }
+
+    template<typename T, typename Encoding, typename P, typename Op>
+    QuantizedErrorArray<T, Encoding, P>
+    quantized_binary_op(const QuantizedErrorArray<T, Encoding, P>& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+
+      assert(lhs.size() == rhs.size());
+
+      const std::vector<T>& lv = lhs.GetValues();
+      const std::vector<T>& rv = rhs.GetValues();
+
+      return quantized_op(&lhs, &rhs, lhs.size(), [&](std::size_t i, const T& le, const T& re)
+      {
+        return VT(op(VT(lv[i], le), VT(rv[i], re)));
+      });
+    }
+
+    template<typename T, typename Encoding, typename P, typename V, typename Op>
+    QuantizedErrorArray<T, Encoding, P>
+    quantized_scalar_op(const QuantizedErrorArray<T, Encoding, P>& lhs, const V& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+
+      const std::vector<T>& lv = lhs.GetValues();
+
+      return quantized_op<T, Encoding, P>(&lhs, nullptr, lhs.size(), [&](std::size_t i, const T& le, const T&)
+      {
+        return VT(op(VT(lv[i], le), rhs));
+      });
+    }
+
+    template<typename T, typename Encoding, typename P, typename U, typename Op>
+    QuantizedErrorArray<T, Encoding, P>
+    scalar_quantized_op(const U& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+
+      const std::vector<T>& rv = rhs.GetValues();
+
+      return quantized_op<T, Encoding, P>(nullptr, &rhs, rhs.size(), [&](std::size_t i, const T&, const T& re)
+      {
+        return VT(op(lhs, VT(rv[i], re)));
+      });
+    }
+
+  } // namespace detail
+
+  /**@name Arithmetic operator definitions
+   *
+   * Element-wise, the error of every element is the ValueWithError result of the decoded operands encoded again.
+   *@{
+   */
+  template<typename T, typename Encoding, typename P>
+  QuantizedErrorArray<T, Encoding, P>
+  operator*(const QuantizedErrorArray<T, Encoding, P>& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::quantized_binary_op(lhs, rhs, detail::multiplies());
+  }
+
+  template<typename T, typename Encoding, typename P, typename V>
+  QuantizedErrorArray<T, Encoding, P>
+  operator*(const QuantizedErrorArray<T, Encoding, P>& lhs, const V& rhs)
+  {
+    return detail::quantized_scalar_op(lhs, rhs, detail::multiplies());
+  }
+
+  template<typename T, typename Encoding, typename P, typename U>
+  QuantizedErrorArray<T, Encoding, P>
+  operator*(const U& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::scalar_quantized_op(lhs, rhs, detail::multiplies());
+  }
+
+  template<typename T, typename Encoding, typename P>
+  QuantizedErrorArray<T, Encoding, P>
+  operator/(const QuantizedErrorArray<T, Encoding, P>& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::quantized_binary_op(lhs, rhs, detail::divides());
+  }
+
+  template<typename T, typename Encoding, typename P, typename V>
+  QuantizedErrorArray<T, Encoding, P>
+  operator/(const QuantizedErrorArray<T, Encoding, P>& lhs, const V& rhs)
+  {
+    return detail::quantized_scalar_op(lhs, rhs, detail::divides());
+  }
+
+  template<typename T, typename Encoding, typename P, typename U>
+  QuantizedErrorArray<T, Encoding, P>
+  operator/(const U& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::scalar_quantized_op(lhs, rhs, detail::divides());
+  }
+
+  template<typename T, typename Encoding, typename P>
+  QuantizedErrorArray<T, Encoding, P>
+  operator+(const QuantizedErrorArray<T, Encoding, P>& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::quantized_binary_op(lhs, rhs, detail::plus());
+  }
+
+  template<typename T, typename Encoding, typename P, typename V>
+  QuantizedErrorArray<T, Encoding, P>
+  operator+(const QuantizedErrorArray<T, Encoding, P>& lhs, const V& rhs)
+  {
+    return detail::quantized_scalar_op(lhs, rhs, detail::plus());
+  }
+
+  template<typename T, typename Encoding, typename P, typename U>
+  QuantizedErrorArray<T, Encoding, P>
+  operator+(const U& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::scalar_quantized_op(lhs, rhs, detail::plus());
+  }
+
+  template<typename T, typename Encoding, typename P>
+  QuantizedErrorArray<T, Encoding, P>
+  operator-(const QuantizedErrorArray<T, Encoding, P>& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::quantized_binary_op(lhs, rhs, detail::minus());
+  }
+
+  template<typename T, typename Encoding, typename P, typename V>
+  QuantizedErrorArray<T, Encoding, P>
+  operator-(const QuantizedErrorArray<T, Encoding, P>& lhs, const V& rhs)
+  {
+    return detail::quantized_scalar_op(lhs, rhs, detail::minus());
+  }
+
+  template<typename T, typename Encoding, typename P, typename U>
+  QuantizedErrorArray<T, Encoding, P>
+  operator-(const U& lhs, const QuantizedErrorArray<T, Encoding, P>& rhs)
+  {
+    return detail::scalar_quantized_op(lhs, rhs, detail::minus());
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // QUANTIZED_ERROR_ARRAY_HPP
@@ -0,0 +1,491 @@
+#ifndef RELATIVE_VALUE_WITH_ERROR_HPP
+#define RELATIVE_VALUE_WITH_ERROR_HPP
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+#include "ValueWithError.hpp"
+#include "DetailOpcodes.hpp"
+
+namespace error_propagation {
+
+  namespace detail {
+
+    /// Absolute error divided by the absolute value, zero for exact values, the absolute error for a value of zero
+    template<typename T>
+    T relative_error(const T& value, const T& error)
+    {
+      using std::abs;
+      return value == T() ? abs(error) : abs(error / value);
+    }
+
+  } // namespace detail
+
+  /** @brief Value with error where the error is stored relative to the value
+   *
+   * For long chains of products and quotients. Relative errors of uncorrelated factors combine in quadrature (or
+   * with the combination policy of P), so products and quotients cost the product of the values and a single
+   * hypot, scaling with a plain value doesn't touch the error at all and powers only scale it. Additions and
+   * subtractions convert to absolute errors and back, which costs three multiplications and a division more than
+   * for ValueWithError. The math functions provided are the ones where the relative error has a simple form, use
+   * ToValueWithError() for everything else.
+   *
+   * The conversion from and to ValueWithError is exact up to the rounding of the division and the
+   * multiplication. A value of zero, e.g. after a cancellation in a sum, has an infinite relative error, so the
+   * absolute error is stored for it instead and operations with such an operand go through ValueWithError.
+   *
+   * @code{cpp}
+     RelativeValueWithError<double> x(ValueWithError<double>(2.0, 0.1));
+     auto y = pow(x, 3) * x / (x * 4.0);   // relative error only
+     std::cout << y.ToValueWithError();
+     @endcode
+   *
+   * @tparam T  Arithmetic type of the value and of the relative error, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class RelativeValueWithError
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+
+    ///@name Constructor
+    ///@{
+    /// From the absolute error
+    RelativeValueWithError(const T& value, const T& error)
+      :
+      m_value(value),
+      m_error(detail::relative_error(value, error))
+    {}
+
+    RelativeValueWithError()
+      :
+      m_value(),
+      m_error()
+    {}
+
+    explicit RelativeValueWithError(const ValueWithError<T, P>& v)
+      :
+      m_value(v.GetValue()),
+      m_error(detail::relative_error(v.GetValue(), v.GetError()))
+    {}
+
+    template<typename U>
+    RelativeValueWithError(const RelativeValueWithError<U, P>& rhs)
+      :
+      m_value(static_cast<T>(rhs.m_value)),
+      m_error(static_cast<T>(rhs.m_error))
+    {}
+
+    /// From the error relative to the absolute value, the absolute error of a value of zero is zero
+    static RelativeValueWithError FromRelativeError(const T& value, const T& relativeError)
+    {
+      using std::abs;
+
+      RelativeValueWithError result;
+      result.m_value = value;
+      result.m_error = value == T() ? T() : abs(relativeError);
+      return result;
+    }
+    ///@}
+
+    ///@name Getters
+    ///@{
+    const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    /// Absolute error
+    T GetError() const
+    {
+      using std::abs;
+      return m_value == T() ? m_error : abs(m_value) * m_error;
+    }
+
+    /// Absolute error divided by the absolute value, infinite for a value of zero with an error
+    T GetRelativeError() const
+    {
+      return m_value != T() || m_error == T() ? m_error : std::numeric_limits<T>::infinity();
+    }
+    ///@}
+
+    ValueWithError<T, P> ToValueWithError() const
+    {
+      return ValueWithError<T, P>(m_value, GetError());
+    }
+
+    ///@name Compound operators
+    ///@{
+    template<typename U>
+    RelativeValueWithError& operator*=(const U& rhs)
+    {
+      return *this = *this * rhs;
+    }
+
+    template<typename U>
+    RelativeValueWithError& operator/=(const U& rhs)
+    {
+      return *this = *this / rhs;
+    }
+
+    template<typename U>
+    RelativeValueWithError& operator+=(const U& rhs)
+    {
+      return *this = *this + rhs;
+    }
+
+    template<typename U>
+    RelativeValueWithError& operator-=(const U& rhs)
+    {
+      return *this = *this - rhs;
+    }
+    ///@}
+
+  private:
+    template<typename, typename>
+    friend class RelativeValueWithError;
+
+    T m_value;
+    // relative error, or the absolute error for a value of zero
+    T m_error;
+  };
+
+  /**@name Arithmetic operator definitions
+   * With @f$ r_x = e_x / |v_x| @f$ the relative error.
+   *@{
+   */
+
+  /// Product.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] \cdot [v_y\pm r_y] = \left[ v_x \cdot v_y\pm \textrm{hypot}(r_x, r_y) \right] @f$
+   */
+  template<typename U, typename V, typename P>
+  RelativeValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator*(const RelativeValueWithError<U, P>& lhs, const RelativeValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    if(lhs.GetValue() == U() || rhs.GetValue() == V())
+    {
+      return RelativeValueWithError<R, P>(lhs.ToValueWithError() * rhs.ToValueWithError());
+    }
+
+    return RelativeValueWithError<R, P>::FromRelativeError(lhs.GetValue() * rhs.GetValue(),
+                                                           detail::combine_errors<P, R>(lhs.GetRelativeError(), rhs.GetRelativeError()));
+  }
+
+  /// Product.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] \cdot v_y = \left[ v_x \cdot v_y\pm r_x \right] @f$
+   */
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, RelativeValueWithError<T, P> >::type
+  operator*(const RelativeValueWithError<T, P>& lhs, const V& rhs)
+  {
+    if(lhs.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(lhs.ToValueWithError() * rhs);
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(lhs.GetValue() * static_cast<T>(rhs), lhs.GetRelativeError());
+  }
+
+  /// Product.
+  /**
+   *  *Computation:* @f$ v_x \cdot [v_y\pm r_y] = \left[ v_x \cdot v_y\pm r_y \right] @f$
+   */
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, RelativeValueWithError<T, P> >::type
+  operator*(const U& lhs, const RelativeValueWithError<T, P>& rhs)
+  {
+    if(rhs.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(lhs * rhs.ToValueWithError());
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(static_cast<T>(lhs) * rhs.GetValue(), rhs.GetRelativeError());
+  }
+
+  /// Division.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] / [v_y\pm r_y] = \left[ v_x / v_y\pm \textrm{hypot}(r_x, r_y) \right] @f$
+   */
+  template<typename U, typename V, typename P>
+  RelativeValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator/(const RelativeValueWithError<U, P>& lhs, const RelativeValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    if(lhs.GetValue() == U() || rhs.GetValue() == V())
+    {
+      return RelativeValueWithError<R, P>(lhs.ToValueWithError() / rhs.ToValueWithError());
+    }
+
+    return RelativeValueWithError<R, P>::FromRelativeError(lhs.GetValue() / rhs.GetValue(),
+                                                           detail::combine_errors<P, R>(lhs.GetRelativeError(), rhs.GetRelativeError()));
+  }
+
+  /// Division.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] / v_y = \left[ v_x / v_y\pm r_x \right] @f$
+   */
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, RelativeValueWithError<T, P> >::type
+  operator/(const RelativeValueWithError<T, P>& lhs, const V& rhs)
+  {
+    if(lhs.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(lhs.ToValueWithError() / rhs);
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(lhs.GetValue() / static_cast<T>(rhs), lhs.GetRelativeError());
+  }
+
+  /// Division.
+  /**
+   *  *Computation:* @f$ v_x / [v_y\pm r_y] = \left[ v_x / v_y\pm r_y \right] @f$
+   */
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, RelativeValueWithError<T, P> >::type
+  operator/(const U& lhs, const RelativeValueWithError<T, P>& rhs)
+  {
+    if(rhs.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(lhs / rhs.ToValueWithError());
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(static_cast<T>(lhs) / rhs.GetValue(), rhs.GetRelativeError());
+  }
+
+  /// Addition.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] + [v_y\pm r_y] = \left[ v_x + v_y\pm \textrm{hypot}(|v_x| r_x, |v_y| r_y) / |v_x + v_y| \right] @f$
+   */
+  template<typename U, typename V, typename P>
+  RelativeValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator+(const RelativeValueWithError<U, P>& lhs, const RelativeValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    const R value = lhs.GetValue() + rhs.GetValue();
+    return RelativeValueWithError<R, P>(value, detail::combine_errors<P, R>(lhs.GetError(), rhs.GetError()));
+  }
+
+  /// Addition.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] + v_y = \left[ v_x + v_y\pm |v_x| r_x / |v_x + v_y| \right] @f$
+   */
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, RelativeValueWithError<T, P> >::type
+  operator+(const RelativeValueWithError<T, P>& lhs, const V& rhs)
+  {
+    const T value = lhs.GetValue() + static_cast<T>(rhs);
+    return RelativeValueWithError<T, P>(value, lhs.GetError());
+  }
+
+  /// Addition.
+  /**
+   *  *Computation:* @f$ v_x + [v_y\pm r_y] = \left[ v_x + v_y\pm |v_y| r_y / |v_x + v_y| \right] @f$
+   */
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, RelativeValueWithError<T, P> >::type
+  operator+(const U& lhs, const RelativeValueWithError<T, P>& rhs)
+  {
+    return rhs + lhs;
+  }
+
+  /// Subtraction.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] - [v_y\pm r_y] = \left[ v_x - v_y\pm \textrm{hypot}(|v_x| r_x, |v_y| r_y) / |v_x - v_y| \right] @f$
+   */
+  template<typename U, typename V, typename P>
+  RelativeValueWithError<typename detail::promote_args<U, V>::type, P>
+  operator-(const RelativeValueWithError<U, P>& lhs, const RelativeValueWithError<V, P>& rhs)
+  {
+    typedef typename detail::promote_args<U, V>::type R;
+    const R value = lhs.GetValue() - rhs.GetValue();
+    return RelativeValueWithError<R, P>(value, detail::combine_errors<P, R>(lhs.GetError(), rhs.GetError()));
+  }
+
+  /// Subtraction.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x] - v_y = \left[ v_x - v_y\pm |v_x| r_x / |v_x - v_y| \right] @f$
+   */
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, RelativeValueWithError<T, P> >::type
+  operator-(const RelativeValueWithError<T, P>& lhs, const V& rhs)
+  {
+    const T value = lhs.GetValue() - static_cast<T>(rhs);
+    return RelativeValueWithError<T, P>(value, lhs.GetError());
+  }
+
+  /// Subtraction.
+  /**
+   *  *Computation:* @f$ v_x - [v_y\pm r_y] = \left[ v_x - v_y\pm |v_y| r_y / |v_x - v_y| \right] @f$
+   */
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, RelativeValueWithError<T, P> >::type
+  operator-(const U& lhs, const RelativeValueWithError<T, P>& rhs)
+  {
+    const T value = static_cast<T>(lhs) - rhs.GetValue();
+    return RelativeValueWithError<T, P>(value, rhs.GetError());
+  }
+  ///@}
+
+  /// Output operator, same format as for ValueWithError
+  template<typename T, typename P, typename charT, typename traits>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const RelativeValueWithError<T, P>& v)
+  {
+    return out << v.ToValueWithError();
+  }
+
+  /**@name Math function overloads
+   *@{
+   */
+
+  /// Absolute value.
+  template<typename T, typename P>
+  RelativeValueWithError<T, P>
+  abs(const RelativeValueWithError<T, P>& x)
+  {
+    using std::abs;
+    if(x.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(T(), x.GetError());
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(abs(x.GetValue()), x.GetRelativeError());
+  }
+
+  /// Absolute value.
+  template<typename T, typename P>
+  RelativeValueWithError<T, P>
+  fabs(const RelativeValueWithError<T, P>& x)
+  {
+    return abs(x);
+  }
+
+  /// Raises a number to the given power.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x]^{v_y} = \left[ v_x^{v_y} \pm |v_y| r_x \right] @f$
+   */
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, RelativeValueWithError<T, P> >::type
+  pow(const RelativeValueWithError<T, P>& x, const V& y)
+  {
+    using std::abs;
+    using std::pow;
+    if(x.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(pow(x.ToValueWithError(), y));
+    }
+
+    const T exponent = static_cast<T>(y);
+    return RelativeValueWithError<T, P>::FromRelativeError(pow(x.GetValue(), exponent), abs(exponent) * x.GetRelativeError());
+  }
+
+  /// Raises a number to the given power.
+  /**
+   *  *Computation:* @f$ v_x^{[v_y\pm r_y]} = \left[ v_x^{v_y} \pm |\ln(v_x) v_y| r_y \right] @f$
+   */
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, RelativeValueWithError<T, P> >::type
+  pow(const U& x, const RelativeValueWithError<T, P>& y)
+  {
+    using std::abs;
+    using std::log;
+    using std::pow;
+    const T base = static_cast<T>(x);
+    return RelativeValueWithError<T, P>::FromRelativeError(pow(base, y.GetValue()), abs(log(base)) * y.GetError());
+  }
+
+  /// Raises a number to the given power.
+  /**
+   *  *Computation:* @f$ [v_x\pm r_x]^{[v_y\pm r_y]} = \left[ v_x^{v_y} \pm \textrm{hypot}(v_y r_x, \ln(v_x) v_y r_y) \right] @f$
+   */
+  template<typename U, typename V, typename P>
+  RelativeValueWithError<typename detail::promote_args<U, V>::type, P>
+  pow(const RelativeValueWithError<U, P>& x, const RelativeValueWithError<V, P>& y)
+  {
+    using std::log;
+    using std::pow;
+    typedef typename detail::promote_args<U, V>::type R;
+    if(x.GetValue() == U())
+    {
+      return RelativeValueWithError<R, P>(pow(x.ToValueWithError(), y.ToValueWithError()));
+    }
+
+    return RelativeValueWithError<R, P>::FromRelativeError(pow(static_cast<R>(x.GetValue()), static_cast<R>(y.GetValue())),
+                                                           detail::combine_errors<P, R>(y.GetValue() * x.GetRelativeError(),
+                                                                                        log(x.GetValue()) * y.GetError()));
+  }
+
+  /// Square root.
+  /**
+   *  *Computation:* @f$ \sqrt{[v_x\pm r_x]} = \left[ \sqrt{v_x} \pm r_x / 2 \right] @f$
+   */
+  template<typename T, typename P>
+  RelativeValueWithError<T, P>
+  sqrt(const RelativeValueWithError<T, P>& x)
+  {
+    using std::sqrt;
+    if(x.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(sqrt(x.ToValueWithError()));
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(sqrt(x.GetValue()), x.GetRelativeError() / 2);
+  }
+
+  /// Cubic root.
+  /**
+   *  *Computation:* @f$ \sqrt[3]{[v_x\pm r_x]} = \left[ \sqrt[3]{v_x} \pm r_x / 3 \right] @f$
+   */
+  template<typename T, typename P>
+  RelativeValueWithError<T, P>
+  cbrt(const RelativeValueWithError<T, P>& x)
+  {
+    using std::cbrt;
+    if(x.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(cbrt(x.ToValueWithError()));
+    }
+
+    return RelativeValueWithError<T, P>::FromRelativeError(cbrt(x.GetValue()), x.GetRelativeError() / 3);
+  }
+
+  /// Exponential function.
+  /**
+   *  *Computation:* @f$ \exp([v_x\pm r_x]) = \left[ \exp(v_x) \pm |v_x| r_x \right] @f$
+   */
+  template<typename T, typename P>
+  RelativeValueWithError<T, P>
+  exp(const RelativeValueWithError<T, P>& x)
+  {
+    using std::exp;
+    return RelativeValueWithError<T, P>::FromRelativeError(exp(x.GetValue()), x.GetError());
+  }
+
+  /// Natural logarithm.
+  /**
+   *  *Computation:* @f$ \ln([v_x\pm r_x]) = \left[ \ln(v_x) \pm r_x / |\ln(v_x)| \right] @f$
+   */
+  template<typename T, typename P>
+  RelativeValueWithError<T, P>
+  log(const RelativeValueWithError<T, P>& x)
+  {
+    using std::log;
+    if(x.GetValue() == T())
+    {
+      return RelativeValueWithError<T, P>(log(x.ToValueWithError()));
+    }
+
+    const T value = log(x.GetValue());
+    return RelativeValueWithError<T, P>(value, x.GetRelativeError());
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // RELATIVE_VALUE_WITH_ERROR_HPP
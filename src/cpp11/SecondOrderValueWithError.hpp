@@ -0,0 +1,577 @@
+#ifndef SECOND_ORDER_VALUE_WITH_ERROR_HPP
+#define SECOND_ORDER_VALUE_WITH_ERROR_HPP
+
+#include <cmath>
+#include <ostream>
+
+#include "ValueWithError.hpp"
+#include "DetailDerivatives.hpp"
+
+namespace error_propagation {
+
+  /** @brief Value with error using second order error propagation
+   *
+   * Opt-in alternative to ValueWithError for large relative errors, where the first order formulas give biased
+   * results. Every value is treated as a normally distributed variable with the value as mean and the squared
+   * error as variance. Each operation includes the second derivatives of the function:
+   *
+   * \f$ \textrm{E}[f] = f(v) + \frac{1}{2}f''(v)e^2, \quad \textrm{Var}[f] = f'(v)^2e^2 + \frac{1}{2}f''(v)^2e^4 \f$
+   *
+   * and for two arguments additionally the mixed term \f$ (\partial_x\partial_y f)^2e_x^2e_y^2 \f$. Sums and
+   * products of independent values are therefore exact. As for ValueWithError the operands are assumed to be
+   * uncorrelated. The cost is a small constant factor over ValueWithError, one more derivative per operation.
+   *
+   * @code{cpp}
+     SecondOrderValueWithError<double> x(1.0, 0.3);
+     auto y = exp(x);                      // mean 1.045 * e instead of e
+     std::cout << y.ToValueWithError();
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class SecondOrderValueWithError
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+
+    ///@name Constructor
+    ///@{
+    SecondOrderValueWithError(const T& value, const T& error)
+      :
+      m_value(value),
+      m_variance(error * error)
+    {}
+
+    SecondOrderValueWithError()
+      :
+      m_value(),
+      m_variance()
+    {}
+
+    explicit SecondOrderValueWithError(const ValueWithError<T, P>& v)
+      :
+      m_value(v.GetValue()),
+      m_variance(v.GetError() * v.GetError())
+    {}
+    ///@}
+
+    /// Construct from mean and variance
+    static SecondOrderValueWithError FromMoments(const T& mean, const T& variance)
+    {
+      SecondOrderValueWithError result;
+      result.m_value = mean;
+      result.m_variance = variance;
+      return result;
+    }
+
+    ///@name Getters
+    ///@{
+    /// Mean, including the second order bias correction of all operations
+    const T& GetValue() const
+    {
+      return m_value;
+    }
+
+    T GetError() const
+    {
+      using std::sqrt;
+      return sqrt(m_variance);
+    }
+
+    const T& GetVariance() const
+    {
+      return m_variance;
+    }
+    ///@}
+
+    ValueWithError<T, P> ToValueWithError() const
+    {
+      return ValueWithError<T, P>(m_value, GetError());
+    }
+
+    ///@name Compound operators
+    ///@{
+    template<typename U>
+    SecondOrderValueWithError& operator*=(const U& rhs)
+    {
+      return *this = *this * rhs;
+    }
+
+    template<typename U>
+    SecondOrderValueWithError& operator/=(const U& rhs)
+    {
+      return *this = *this / rhs;
+    }
+
+    template<typename U>
+    SecondOrderValueWithError& operator+=(const U& rhs)
+    {
+      return *this = *this + rhs;
+    }
+
+    template<typename U>
+    SecondOrderValueWithError& operator-=(const U& rhs)
+    {
+      return *this = *this - rhs;
+    }
+    ///@}
+
+  private:
+    T m_value;
+    T m_variance;
+  };
+
+  namespace detail {
+
+    template<Opcode op, typename T, typename P>
+    SecondOrderValueWithError<T, P>
+    second_order_unary(const SecondOrderValueWithError<T, P>& a)
+    {
+      const T& v = a.GetValue();
+      const T& variance = a.GetVariance();
+
+      const T d = derivative<op>::first(v);
+      const T curvature = derivative<op>::second(v) * variance;
+
+      return SecondOrderValueWithError<T, P>::FromMoments(opcode_function<op>::apply(v) + curvature / T(2),
+                                                          d * d * variance + curvature * curvature / T(2));
+    }
+
+    template<Opcode op, typename T, typename P>
+    SecondOrderValueWithError<T, P>
+    second_order_binary(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+    {
+      const T& l = lhs.GetValue();
+      const T& r = rhs.GetValue();
+      const T& lv = lhs.GetVariance();
+      const T& rv = rhs.GetVariance();
+
+      T dl, dr, dll, drr, dlr;
+      derivative<op>::first(l, r, dl, dr);
+      derivative<op>::second(l, r, dll, drr, dlr);
+
+      const T cl = dll * lv;
+      const T cr = drr * rv;
+
+      return SecondOrderValueWithError<T, P>::FromMoments(opcode_function<op>::template apply<T>(l, r) + (cl + cr) / T(2),
+                                                          dl * dl * lv + dr * dr * rv + (cl * cl + cr * cr) / T(2)
+                                                          + dlr * dlr * lv * rv);
+    }
+
+    template<Opcode op, typename T, typename P>
+    SecondOrderValueWithError<T, P>
+    second_order_binary(const SecondOrderValueWithError<T, P>& lhs, const T& r)
+    {
+      const T& l = lhs.GetValue();
+      const T& lv = lhs.GetVariance();
+
+      T dl, dr, dll, drr, dlr;
+      derivative<op>::first(l, r, dl, dr);
+      derivative<op>::second(l, r, dll, drr, dlr);
+
+      const T cl = dll * lv;
+
+      return SecondOrderValueWithError<T, P>::FromMoments(opcode_function<op>::template apply<T>(l, r) + cl / T(2),
+                                                          dl * dl * lv + cl * cl / T(2));
+    }
+
+    template<Opcode op, typename T, typename P>
+    SecondOrderValueWithError<T, P>
+    second_order_binary(const T& l, const SecondOrderValueWithError<T, P>& rhs)
+    {
+      const T& r = rhs.GetValue();
+      const T& rv = rhs.GetVariance();
+
+      T dl, dr, dll, drr, dlr;
+      derivative<op>::first(l, r, dl, dr);
+      derivative<op>::second(l, r, dll, drr, dlr);
+
+      const T cr = drr * rv;
+
+      return SecondOrderValueWithError<T, P>::FromMoments(opcode_function<op>::template apply<T>(l, r) + cr / T(2),
+                                                          dr * dr * rv + cr * cr / T(2));
+    }
+
+  } // namespace detail
+
+  /**@name Arithmetic operator definitions
+   *@{
+   */
+  /// Product. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  operator*(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Multiply>(lhs, rhs);
+  }
+
+  /// Product. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  operator*(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Multiply>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Product. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  operator*(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Multiply>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Division. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  operator/(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Divide>(lhs, rhs);
+  }
+
+  /// Division. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  operator/(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Divide>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Division. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  operator/(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Divide>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Addition. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  operator+(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Plus>(lhs, rhs);
+  }
+
+  /// Addition. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  operator+(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Plus>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Addition. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  operator+(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Plus>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Subtraction. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  operator-(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Minus>(lhs, rhs);
+  }
+
+  /// Subtraction. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  operator-(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Minus>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Subtraction. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  operator-(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Minus>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+  /// Output operator, same format as for ValueWithError
+  template<typename T, typename P, typename charT, typename traits>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const SecondOrderValueWithError<T, P>& v)
+  {
+    return out << v.ToValueWithError();
+  }
+
+  /**@name Math function overloads
+   *
+   * Same set of functions as for ValueWithError.
+   *@{
+   */
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  abs(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Abs>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  acos(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Acos>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  acosh(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Acosh>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  asin(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Asin>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  asinh(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Asinh>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  atan(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Atan>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  atanh(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Atanh>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  cbrt(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Cbrt>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  cos(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Cos>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  cosh(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Cosh>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  erf(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Erf>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  erfc(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Erfc>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  exp(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Exp>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  exp2(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Exp2>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  expm1(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Expm1>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  fabs(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Fabs>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  lgamma(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Lgamma>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  log(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Log>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  log10(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Log10>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  log1p(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Log1p>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  log2(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Log2>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  sin(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Sin>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  sinh(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Sinh>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  sqrt(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Sqrt>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  tan(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Tan>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  tanh(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Tanh>(v);
+  }
+
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  tgamma(const SecondOrderValueWithError<T, P>& v)
+  {
+    return detail::second_order_unary<detail::Opcode::Tgamma>(v);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  atan2(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Atan2>(lhs, rhs);
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  atan2(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Atan2>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Arc tangent, using signs to determine quadrants. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  atan2(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Atan2>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  hypot(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Hypot>(lhs, rhs);
+  }
+
+  /// Square root of the sum of the squares. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  hypot(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Hypot>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Square root of the sum of the squares. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  hypot(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Hypot>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Raises a number to the given power. Overload for two SecondOrderValueWithError arguments.
+  template<typename T, typename P>
+  SecondOrderValueWithError<T, P>
+  pow(const SecondOrderValueWithError<T, P>& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Pow>(lhs, rhs);
+  }
+
+  /// Raises a number to the given power. Overload for a SecondOrderValueWithError and an arithmetic type.
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_arithmetic<V, SecondOrderValueWithError<T, P> >::type
+  pow(const SecondOrderValueWithError<T, P>& lhs, const V& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Pow>(lhs, static_cast<T>(rhs));
+  }
+
+  /// Raises a number to the given power. Overload for an arithmetic type and a SecondOrderValueWithError.
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_arithmetic<U, SecondOrderValueWithError<T, P> >::type
+  pow(const U& lhs, const SecondOrderValueWithError<T, P>& rhs)
+  {
+    return detail::second_order_binary<detail::Opcode::Pow>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // SECOND_ORDER_VALUE_WITH_ERROR_HPP
@@ -0,0 +1,734 @@
+#ifndef SIMD_PACK_HPP
+#define SIMD_PACK_HPP
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include "ValueWithError.hpp"
+#include "DetailOpcodes.hpp"
+
+namespace error_propagation {
+
+  /** @brief Fixed number of lanes of an arithmetic type, the operations are applied lane-wise
+   *
+   * Used as ValueWithError<SimdPack<double, 4> > to propagate the errors of W independent measurements with one
+   * object, in the same way as ValueWithError<Eigen::Array3d>. All loops over the lanes have a fixed trip count,
+   * so the arithmetic operators are vectorized by the compiler for the instruction set it targets, without any
+   * intrinsics. The math functions call the scalar functions for each lane and are only vectorized if the
+   * compiler provides vector versions of them. This is a portable replacement for std::experimental::simd,
+   * which requires C++17.
+   *
+   * All operators and math functions of ValueWithError are supported, comparisons are not, as for Eigen::Array.
+   * The errors of two arguments are combined per lane with the combination policy of the ValueWithError, in
+   * quadrature by default, see hypot(). Plain values of arithmetic type are broadcast to all lanes.
+   *
+   * @code{cpp}
+     typedef ValueWithError<SimdPack<double, 4> > V4;
+     std::vector<V4> packs = pack_lanes<4>(measurements);   // std::vector<ValueWithError<double> >
+     for(auto& x : packs)
+       x = exp(x) * 2.0;
+     measurements = unpack_lanes(packs, measurements.size());
+     @endcode
+   *
+   * @tparam T  Floating point type of each lane
+   * @tparam W  Number of lanes, e.g. 4 or 8 doubles for AVX2 or AVX-512
+   */
+  template<typename T, std::size_t W>
+  class SimdPack
+  {
+    public:
+    typedef T value_type;
+
+    ///@name Constructor
+    ///@{
+    SimdPack()
+      :
+      m_lanes()
+    {}
+
+    /// Broadcast to all lanes, implicit so that mixed arithmetic with plain values promotes to SimdPack
+    SimdPack(const T& value)
+    {
+      m_lanes.fill(value);
+    }
+
+    explicit SimdPack(const std::array<T, W>& lanes)
+      :
+      m_lanes(lanes)
+    {}
+    ///@}
+
+    static CONSTEXPR std::size_t Width()
+    {
+      return W;
+    }
+
+    ///@name Lane access
+    ///@{
+    T& operator[](std::size_t i)
+    {
+      assert(i < W);
+      return m_lanes[i];
+    }
+
+    const T& operator[](std::size_t i) const
+    {
+      assert(i < W);
+      return m_lanes[i];
+    }
+
+    const std::array<T, W>& GetLanes() const
+    {
+      return m_lanes;
+    }
+    ///@}
+
+    ///@name Compound operators
+    ///@{
+    template<typename U>
+    SimdPack& operator*=(const U& rhs)
+    {
+      return *this = *this * rhs;
+    }
+
+    template<typename U>
+    SimdPack& operator/=(const U& rhs)
+    {
+      return *this = *this / rhs;
+    }
+
+    template<typename U>
+    SimdPack& operator+=(const U& rhs)
+    {
+      return *this = *this + rhs;
+    }
+
+    template<typename U>
+    SimdPack& operator-=(const U& rhs)
+    {
+      return *this = *this - rhs;
+    }
+    ///@}
+
+    private:
+    std::array<T, W> m_lanes;
+  };
+
+  namespace detail {
+
+    /// Enables the overloads for a SimdPack and a plain value of arithmetic type only
+    template<typename U, typename R>
+    struct enable_if_simd_scalar : std::enable_if<std::is_arithmetic<U>::value, R>
+    {};
+
+    template<Opcode op, typename T, std::size_t W>
+    SimdPack<T, W> simd_unary(const SimdPack<T, W>& a)
+    {
+      SimdPack<T, W> result;
+      for(std::size_t i = 0; i < W; i++)
+      {
+        result[i] = opcode_function<op>::apply(a[i]);
+      }
+      return result;
+    }
+
+    template<Opcode op, typename T, std::size_t W>
+    SimdPack<T, W> simd_binary(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+    {
+      SimdPack<T, W> result;
+      for(std::size_t i = 0; i < W; i++)
+      {
+        result[i] = opcode_function<op>::template apply<T>(lhs[i], rhs[i]);
+      }
+      return result;
+    }
+
+    template<Opcode op, typename T, std::size_t W>
+    SimdPack<T, W> simd_binary(const SimdPack<T, W>& lhs, const T& r)
+    {
+      SimdPack<T, W> result;
+      for(std::size_t i = 0; i < W; i++)
+      {
+        result[i] = opcode_function<op>::template apply<T>(lhs[i], r);
+      }
+      return result;
+    }
+
+    template<Opcode op, typename T, std::size_t W>
+    SimdPack<T, W> simd_binary(const T& l, const SimdPack<T, W>& rhs)
+    {
+      SimdPack<T, W> result;
+      for(std::size_t i = 0; i < W; i++)
+      {
+        result[i] = opcode_function<op>::template apply<T>(l, rhs[i]);
+      }
+      return result;
+    }
+
+  } // namespace detail
+
+  ///@name Arithmetic operators
+  ///@{
+  template<typename T, std::size_t W>
+  SimdPack<T, W> operator+(const SimdPack<T, W>& a)
+  {
+    return a;
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> operator-(const SimdPack<T, W>& a)
+  {
+    SimdPack<T, W> result;
+    for(std::size_t i = 0; i < W; i++)
+    {
+      result[i] = -a[i];
+    }
+    return result;
+  }
+
+  /// Product
+  template<typename T, std::size_t W>
+  SimdPack<T, W> operator*(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Multiply>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  operator*(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Multiply>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  operator*(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Multiply>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Division
+  template<typename T, std::size_t W>
+  SimdPack<T, W> operator/(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Divide>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  operator/(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Divide>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  operator/(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Divide>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Addition
+  template<typename T, std::size_t W>
+  SimdPack<T, W> operator+(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Plus>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  operator+(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Plus>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  operator+(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Plus>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Subtraction
+  template<typename T, std::size_t W>
+  SimdPack<T, W> operator-(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Minus>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  operator-(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Minus>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  operator-(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Minus>(static_cast<T>(lhs), rhs);
+  }
+  ///@}
+
+  /// Output operator, the lanes in square brackets, e.g. [1 2 3 4]
+  template<typename T, std::size_t W, typename charT, typename traits>
+  std::basic_ostream<charT,traits>&
+  operator<<(std::basic_ostream<charT,traits>& out, const SimdPack<T, W>& a)
+  {
+    out << '[';
+    for(std::size_t i = 0; i < W; i++)
+    {
+      out << (i == 0 ? "" : " ") << a[i];
+    }
+    return out << ']';
+  }
+
+  /**@name Math functions
+   *
+   * Lane-wise, same set of functions as for ValueWithError.
+   *@{
+   */
+  template<typename T, std::size_t W>
+  SimdPack<T, W> abs(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Abs>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> acos(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Acos>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> acosh(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Acosh>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> asin(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Asin>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> asinh(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Asinh>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> atan(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Atan>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> atanh(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Atanh>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> cbrt(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Cbrt>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> cos(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Cos>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> cosh(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Cosh>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> erf(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Erf>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> erfc(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Erfc>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> exp(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Exp>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> exp2(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Exp2>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> expm1(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Expm1>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> fabs(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Fabs>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> lgamma(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Lgamma>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> log(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Log>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> log10(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Log10>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> log1p(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Log1p>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> log2(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Log2>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> sin(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Sin>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> sinh(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Sinh>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> sqrt(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Sqrt>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> tan(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Tan>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> tanh(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Tanh>(a);
+  }
+
+  template<typename T, std::size_t W>
+  SimdPack<T, W> tgamma(const SimdPack<T, W>& a)
+  {
+    return detail::simd_unary<detail::Opcode::Tgamma>(a);
+  }
+
+  /// Arc tangent, using signs to determine quadrants
+  template<typename T, std::size_t W>
+  SimdPack<T, W> atan2(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Atan2>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  atan2(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Atan2>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  atan2(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Atan2>(static_cast<T>(lhs), rhs);
+  }
+
+  /// Raises a number to the given power
+  template<typename T, std::size_t W>
+  SimdPack<T, W> pow(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Pow>(lhs, rhs);
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  pow(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Pow>(lhs, static_cast<T>(rhs));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  pow(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return detail::simd_binary<detail::Opcode::Pow>(static_cast<T>(lhs), rhs);
+  }
+
+  /** @brief Square root of the sum of the squares, lane-wise
+   *
+   * Evaluates sqrt(a*a + b*b) for all lanes without branches and falls back to the scaled hypot for all lanes if
+   * a square can over- or underflow in any lane. The loop is only vectorized if the compiler may ignore errno for
+   * the square root, e.g. with -fno-math-errno.
+   */
+  template<typename T, std::size_t W>
+  SimdPack<T, W> hypot(const SimdPack<T, W>& lhs, const SimdPack<T, W>& rhs)
+  {
+    using std::sqrt;
+
+    // the squares of values in this range neither over- nor underflow
+    const T upper = sqrt(std::numeric_limits<T>::max()) / 2;
+    const T lower = sqrt(std::numeric_limits<T>::min()) * 2;
+
+    SimdPack<T, W> result;
+
+    // non-short-circuit operators keep the loop free of branches
+    int outOfRange = 0;
+
+    for(std::size_t i = 0; i < W; i++)
+    {
+      const T a = lhs[i];
+      const T b = rhs[i];
+      result[i] = sqrt(a * a + b * b);
+      const int overflow = !(result[i] <= upper);
+      const int underflow = (result[i] < lower) & ((a != T()) | (b != T()));
+      outOfRange |= overflow | underflow;
+    }
+
+    if(outOfRange)
+    {
+      return detail::simd_binary<detail::Opcode::Hypot>(lhs, rhs);
+    }
+
+    return result;
+  }
+
+  template<typename T, std::size_t W, typename V>
+  typename detail::enable_if_simd_scalar<V, SimdPack<T, W> >::type
+  hypot(const SimdPack<T, W>& lhs, const V& rhs)
+  {
+    return hypot(lhs, SimdPack<T, W>(static_cast<T>(rhs)));
+  }
+
+  template<typename T, std::size_t W, typename U>
+  typename detail::enable_if_simd_scalar<U, SimdPack<T, W> >::type
+  hypot(const U& lhs, const SimdPack<T, W>& rhs)
+  {
+    return hypot(SimdPack<T, W>(static_cast<T>(lhs)), rhs);
+  }
+  ///@}
+
+  namespace detail {
+
+    /// ValueWithError combines errors in quadrature with detail::hypot, use the lane-wise version
+    template<typename T, std::size_t W>
+    struct hypot_impl<SimdPack<T, W>, SimdPack<T, W>, false>
+    {
+      SimdPack<T, W> operator()(const SimdPack<T, W>& a, const SimdPack<T, W>& b) const
+      {
+        return hypot(a, b);
+      }
+    };
+
+    template<typename T, std::size_t W, typename U>
+    struct hypot_impl<SimdPack<T, W>, U, false>
+    {
+      SimdPack<T, W> operator()(const SimdPack<T, W>& a, const U& b) const
+      {
+        return hypot(a, b);
+      }
+    };
+
+    template<typename T, std::size_t W, typename U>
+    struct hypot_impl<U, SimdPack<T, W>, false>
+    {
+      SimdPack<T, W> operator()(const U& a, const SimdPack<T, W>& b) const
+      {
+        return hypot(a, b);
+      }
+    };
+
+    /// Lane-wise maximum for MaximumCombinationPolicy
+    template<typename T, std::size_t W>
+    struct max_abs_impl<SimdPack<T, W>, SimdPack<T, W>, false>
+    {
+      SimdPack<T, W> operator()(const SimdPack<T, W>& a, const SimdPack<T, W>& b) const
+      {
+        using std::abs;
+
+        SimdPack<T, W> result;
+        for(std::size_t i = 0; i < W; i++)
+        {
+          result[i] = abs(a[i]) < abs(b[i]) ? abs(b[i]) : abs(a[i]);
+        }
+        return result;
+      }
+    };
+
+    template<typename T, std::size_t W>
+    struct digamma_impl<SimdPack<T, W> >
+    {
+      SimdPack<T, W> operator()(const SimdPack<T, W>& a) const
+      {
+        SimdPack<T, W> result;
+        for(std::size_t i = 0; i < W; i++)
+        {
+          result[i] = digamma(a[i]);
+        }
+        return result;
+      }
+    };
+
+  } // namespace detail
+
+  /**@name Conversion between scalar values and lanes
+   *@{
+   */
+
+  /// Value and error of a single lane
+  template<typename T, std::size_t W, typename P>
+  ValueWithError<T, P> get_lane(const ValueWithError<SimdPack<T, W>, P>& v, std::size_t i)
+  {
+    return ValueWithError<T, P>(v.GetValue()[i], v.GetError()[i]);
+  }
+
+  /** @brief Groups W consecutive values into one pack
+   *
+   * The lanes of the last pack which are not covered by values repeat the last value, so that they don't raise
+   * domain errors in the math functions.
+   */
+  template<std::size_t W, typename T, typename P>
+  std::vector<ValueWithError<SimdPack<T, W>, P> >
+  pack_lanes(const std::vector<ValueWithError<T, P> >& values)
+  {
+    std::vector<ValueWithError<SimdPack<T, W>, P> > packs;
+    packs.reserve((values.size() + W - 1) / W);
+
+    for(std::size_t first = 0; first < values.size(); first += W)
+    {
+      SimdPack<T, W> value, error;
+      for(std::size_t i = 0; i < W; i++)
+      {
+        const ValueWithError<T, P>& v = values[first + i < values.size() ? first + i : values.size() - 1];
+        value[i] = v.GetValue();
+        error[i] = v.GetError();
+      }
+      packs.push_back(ValueWithError<SimdPack<T, W>, P>(value, error));
+    }
+
+    return packs;
+  }
+
+  /// Inverse of pack_lanes(), returns the first size values
+  template<typename T, std::size_t W, typename P>
+  std::vector<ValueWithError<T, P> >
+  unpack_lanes(const std::vector<ValueWithError<SimdPack<T, W>, P> >& packs, std::size_t size)
+  {
+    assert(size <= packs.size() * W);
+
+    std::vector<ValueWithError<T, P> > values;
+    values.reserve(size);
+
+    for(std::size_t i = 0; i < size; i++)
+    {
+      values.push_back(get_lane(packs[i / W], i % W));
+    }
+
+    return values;
+  }
+  ///@}
+
+} // namespace error_propagation
+
+namespace std {
+
+  /// Properties of a single lane, the values are broadcast to all lanes
+  template<typename T, std::size_t W>
+  class numeric_limits<error_propagation::SimdPack<T, W> > : public numeric_limits<T>
+  {
+    typedef error_propagation::SimdPack<T, W> S;
+
+    public:
+    static S min()
+    {
+      return S(numeric_limits<T>::min());
+    }
+
+    static S max()
+    {
+      return S(numeric_limits<T>::max());
+    }
+
+    static S lowest()
+    {
+      return S(numeric_limits<T>::lowest());
+    }
+
+    static S epsilon()
+    {
+      return S(numeric_limits<T>::epsilon());
+    }
+
+    static S round_error()
+    {
+      return S(numeric_limits<T>::round_error());
+    }
+
+    static S infinity()
+    {
+      return S(numeric_limits<T>::infinity());
+    }
+
+    static S quiet_NaN()
+    {
+      return S(numeric_limits<T>::quiet_NaN());
+    }
+
+    static S signaling_NaN()
+    {
+      return S(numeric_limits<T>::signaling_NaN());
+    }
+
+    static S denorm_min()
+    {
+      return S(numeric_limits<T>::denorm_min());
+    }
+  };
+
+} // namespace std
+
+#endif // SIMD_PACK_HPP
@@ -0,0 +1,581 @@
+#ifndef SPARSE_ERROR_ARRAY_HPP
+#define SPARSE_ERROR_ARRAY_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "ValueWithError.hpp"
+#include "DetailFunctional.hpp"
+
+namespace error_propagation {
+
+  /** @brief Array of values where only a small fraction carries a non-zero error
+   *
+   * The values are stored densely, the non-zero errors are stored together with their index in ascending order
+   * of the index. Element-wise operations compute the values for all elements in a plain loop and evaluate the
+   * ValueWithError operators only for indices where at least one operand has a non-zero error. Entries where
+   * both operands are exact therefore don't cost any error arithmetic.
+   *
+   * The error of each element is the same as computing the element with ValueWithError<T, P>, zero errors
+   * in the result are not stored. The only exception are exact elements with non-finite intermediate values,
+   * e.g. a division by an exact zero, these have zero error instead of NaN.
+   *
+   * @code{cpp}
+     SparseErrorArray<double> a(denseVector);
+     auto b = a * a + 2.0;
+     std::vector<ValueWithError<double>> result = b.ToDense();
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS>
+  class SparseErrorArray
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef std::size_t size_type;
+
+    ///@name Constructor
+    ///@{
+    SparseErrorArray()
+    {}
+
+    /// Array of exact values
+    explicit SparseErrorArray(std::vector<T> values)
+      :
+      m_values(std::move(values))
+    {}
+
+    /** @brief Array from values and the non-zero errors
+     *
+     * @param values       all values
+     * @param errorIndices indices of the elements with non-zero error, must be strictly ascending
+     * @param errors       errors of the elements given by errorIndices
+     */
+    SparseErrorArray(std::vector<T> values, std::vector<size_type> errorIndices, std::vector<T> errors)
+      :
+      m_values(std::move(values)),
+      m_errorIndices(std::move(errorIndices)),
+      m_errors(std::move(errors))
+    {
+      assert(m_errorIndices.size() == m_errors.size());
+      assert(std::adjacent_find(m_errorIndices.begin(), m_errorIndices.end(), std::greater_equal<size_type>()) == m_errorIndices.end());
+      assert(m_errorIndices.empty() || m_errorIndices.back() < m_values.size());
+
+      for(T& error : m_errors)
+      {
+        error = abs(error);
+      }
+    }
+
+    /// Conversion from the dense representation
+    explicit SparseErrorArray(const std::vector<ValueWithError<T, P>>& dense)
+    {
+      m_values.reserve(dense.size());
+
+      for(size_type i = 0; i < dense.size(); i++)
+      {
+        m_values.push_back(dense[i].GetValue());
+
+        if(dense[i].GetError() != T())
+        {
+          m_errorIndices.push_back(i);
+          m_errors.push_back(dense[i].GetError());
+        }
+      }
+    }
+    ///@}
+
+    /// Conversion to the dense representation
+    std::vector<ValueWithError<T, P>> ToDense() const
+    {
+      std::vector<ValueWithError<T, P>> dense;
+      dense.reserve(m_values.size());
+
+      for(const T& value : m_values)
+      {
+        dense.push_back(ValueWithError<T, P>(value));
+      }
+
+      for(size_type k = 0; k < m_errorIndices.size(); k++)
+      {
+        dense[m_errorIndices[k]] = ValueWithError<T, P>(m_values[m_errorIndices[k]], m_errors[k]);
+      }
+
+      return dense;
+    }
+
+    ///@name Getters
+    ///@{
+    size_type size() const
+    {
+      return m_values.size();
+    }
+
+    /// Number of elements with a non-zero error
+    size_type NumErrors() const
+    {
+      return m_errors.size();
+    }
+
+    /// Element i, the error is looked up with a binary search
+    ValueWithError<T, P> operator[](size_type i) const
+    {
+      const auto it = std::lower_bound(m_errorIndices.begin(), m_errorIndices.end(), i);
+
+      if(it == m_errorIndices.end() || *it != i)
+      {
+        return ValueWithError<T, P>(m_values[i]);
+      }
+
+      return ValueWithError<T, P>(m_values[i], m_errors[it - m_errorIndices.begin()]);
+    }
+
+    const std::vector<T>& GetValues() const
+    {
+      return m_values;
+    }
+
+    const std::vector<size_type>& GetErrorIndices() const
+    {
+      return m_errorIndices;
+    }
+
+    const std::vector<T>& GetErrors() const
+    {
+      return m_errors;
+    }
+    ///@}
+
+    ///@name Arithmetic operators
+    ///@{
+    template<typename U>
+    SparseErrorArray<T, P>&
+    operator*=(const U& rhs)
+    {
+      *this = (*this) * rhs;
+      return *this;
+    }
+
+    template<typename U>
+    SparseErrorArray<T, P>&
+    operator/=(const U& rhs)
+    {
+      *this = (*this) / rhs;
+      return *this;
+    }
+
+    template<typename U>
+    SparseErrorArray<T, P>&
+    operator+=(const U& rhs)
+    {
+      *this = (*this) + rhs;
+      return *this;
+    }
+
+    template<typename U>
+    SparseErrorArray<T, P>&
+    operator-=(const U& rhs)
+    {
+      *this = (*this) - rhs;
+      return *this;
+    }
+    ///@}
+
+    void swap(SparseErrorArray<T, P>& obj)
+    {
+      using std::swap;
+      swap(this->m_values, obj.m_values);
+      swap(this->m_errorIndices, obj.m_errorIndices);
+      swap(this->m_errors, obj.m_errors);
+    }
+
+  private:
+    std::vector<T> m_values;
+    std::vector<size_type> m_errorIndices;
+    std::vector<T> m_errors;
+  };
+
+  template<typename T, typename P>
+  void swap(SparseErrorArray<T, P>& lhs, SparseErrorArray<T, P>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  namespace detail {
+
+    /// Element-wise operation of two sparse arrays, merges the two index lists
+    template<typename T, typename P, typename Op>
+    SparseErrorArray<T, P>
+    sparse_binary_op(const SparseErrorArray<T, P>& lhs, const SparseErrorArray<T, P>& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+      typedef typename SparseErrorArray<T, P>::size_type size_type;
+
+      assert(lhs.size() == rhs.size());
+
+      const std::vector<T>& lv = lhs.GetValues();
+      const std::vector<T>& rv = rhs.GetValues();
+
+      std::vector<T> values(lv.size());
+      for(size_type i = 0; i < values.size(); i++)
+      {
+        values[i] = op(lv[i], rv[i]);
+      }
+
+      const std::vector<size_type>& li = lhs.GetErrorIndices();
+      const std::vector<size_type>& ri = rhs.GetErrorIndices();
+      const std::vector<T>& le = lhs.GetErrors();
+      const std::vector<T>& re = rhs.GetErrors();
+
+      std::vector<size_type> indices;
+      std::vector<T> errors;
+      indices.reserve(li.size() + ri.size());
+      errors.reserve(li.size() + ri.size());
+
+      size_type a = 0, b = 0;
+      while(a < li.size() || b < ri.size())
+      {
+        size_type i;
+        T error;
+
+        if(b == ri.size() || (a < li.size() && li[a] < ri[b]))
+        {
+          i = li[a];
+          error = op(VT(lv[i], le[a++]), rv[i]).GetError();
+        }
+        else if(a == li.size() || ri[b] < li[a])
+        {
+          i = ri[b];
+          error = op(lv[i], VT(rv[i], re[b++])).GetError();
+        }
+        else
+        {
+          i = li[a];
+          error = op(VT(lv[i], le[a++]), VT(rv[i], re[b++])).GetError();
+        }
+
+        if(error != T())
+        {
+          indices.push_back(i);
+          errors.push_back(error);
+        }
+      }
+
+      return SparseErrorArray<T, P>(std::move(values), std::move(indices), std::move(errors));
+    }
+
+    /// Enables the overloads for a SparseErrorArray and a plain value of arithmetic type or its own value type only
+    template<typename U, typename T, typename R>
+    struct enable_if_sparse_scalar : std::enable_if<std::is_arithmetic<U>::value || std::is_same<U, T>::value, R>
+    {};
+
+    /// Element-wise operation of a sparse array and a general compatible type
+    template<typename T, typename P, typename V, typename Op>
+    SparseErrorArray<T, P>
+    sparse_scalar_op(const SparseErrorArray<T, P>& lhs, const V& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+      typedef typename SparseErrorArray<T, P>::size_type size_type;
+
+      const std::vector<T>& lv = lhs.GetValues();
+
+      std::vector<T> values(lv.size());
+      for(size_type i = 0; i < values.size(); i++)
+      {
+        values[i] = op(lv[i], rhs);
+      }
+
+      const std::vector<size_type>& li = lhs.GetErrorIndices();
+      const std::vector<T>& le = lhs.GetErrors();
+
+      std::vector<size_type> indices;
+      std::vector<T> errors;
+      indices.reserve(li.size());
+      errors.reserve(li.size());
+
+      for(size_type k = 0; k < li.size(); k++)
+      {
+        const T error = op(VT(lv[li[k]], le[k]), rhs).GetError();
+
+        if(error != T())
+        {
+          indices.push_back(li[k]);
+          errors.push_back(error);
+        }
+      }
+
+      return SparseErrorArray<T, P>(std::move(values), std::move(indices), std::move(errors));
+    }
+
+    /// Element-wise operation of a general compatible type and a sparse array
+    template<typename T, typename P, typename U, typename Op>
+    SparseErrorArray<T, P>
+    scalar_sparse_op(const U& lhs, const SparseErrorArray<T, P>& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+      typedef typename SparseErrorArray<T, P>::size_type size_type;
+
+      const std::vector<T>& rv = rhs.GetValues();
+
+      std::vector<T> values(rv.size());
+      for(size_type i = 0; i < values.size(); i++)
+      {
+        values[i] = op(lhs, rv[i]);
+      }
+
+      const std::vector<size_type>& ri = rhs.GetErrorIndices();
+      const std::vector<T>& re = rhs.GetErrors();
+
+      std::vector<size_type> indices;
+      std::vector<T> errors;
+      indices.reserve(ri.size());
+      errors.reserve(ri.size());
+
+      for(size_type k = 0; k < ri.size(); k++)
+      {
+        const T error = op(lhs, VT(rv[ri[k]], re[k])).GetError();
+
+        if(error != T())
+        {
+          indices.push_back(ri[k]);
+          errors.push_back(error);
+        }
+      }
+
+      return SparseErrorArray<T, P>(std::move(values), std::move(indices), std::move(errors));
+    }
+
+    /// Element-wise operation of a sparse array and a ValueWithError, with an error the result has errors everywhere
+    template<typename T, typename P, typename Op>
+    SparseErrorArray<T, P>
+    sparse_value_op(const SparseErrorArray<T, P>& lhs, const ValueWithError<T, P>& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+      typedef typename SparseErrorArray<T, P>::size_type size_type;
+
+      if(rhs.GetError() == T())
+      {
+        return sparse_scalar_op(lhs, rhs.GetValue(), op);
+      }
+
+      const std::vector<T>& lv = lhs.GetValues();
+      const std::vector<size_type>& li = lhs.GetErrorIndices();
+      const std::vector<T>& le = lhs.GetErrors();
+
+      std::vector<T> values(lv.size());
+      std::vector<size_type> indices;
+      std::vector<T> errors;
+
+      for(size_type i = 0, k = 0; i < lv.size(); i++)
+      {
+        const T error = k < li.size() && li[k] == i ? le[k++] : T();
+        const VT result = op(VT(lv[i], error), rhs);
+        values[i] = result.GetValue();
+
+        if(result.GetError() != T())
+        {
+          indices.push_back(i);
+          errors.push_back(result.GetError());
+        }
+      }
+
+      return SparseErrorArray<T, P>(std::move(values), std::move(indices), std::move(errors));
+    }
+
+    /// Element-wise operation of a ValueWithError and a sparse array, with an error the result has errors everywhere
+    template<typename T, typename P, typename Op>
+    SparseErrorArray<T, P>
+    value_sparse_op(const ValueWithError<T, P>& lhs, const SparseErrorArray<T, P>& rhs, Op op)
+    {
+      typedef ValueWithError<T, P> VT;
+      typedef typename SparseErrorArray<T, P>::size_type size_type;
+
+      if(lhs.GetError() == T())
+      {
+        return scalar_sparse_op(lhs.GetValue(), rhs, op);
+      }
+
+      const std::vector<T>& rv = rhs.GetValues();
+      const std::vector<size_type>& ri = rhs.GetErrorIndices();
+      const std::vector<T>& re = rhs.GetErrors();
+
+      std::vector<T> values(rv.size());
+      std::vector<size_type> indices;
+      std::vector<T> errors;
+
+      for(size_type i = 0, k = 0; i < rv.size(); i++)
+      {
+        const T error = k < ri.size() && ri[k] == i ? re[k++] : T();
+        const VT result = op(lhs, VT(rv[i], error));
+        values[i] = result.GetValue();
+
+        if(result.GetError() != T())
+        {
+          indices.push_back(i);
+          errors.push_back(result.GetError());
+        }
+      }
+
+      return SparseErrorArray<T, P>(std::move(values), std::move(indices), std::move(errors));
+    }
+
+  } // namespace detail
+
+  /**@name Arithmetic operator definitions
+   *
+   * Element-wise, the error of every element is the same as for the corresponding ValueWithError operator. The
+   * scalar operand is a plain value of arithmetic type or T, or a ValueWithError<T, P>. A ValueWithError with
+   * non-zero error gives all elements of the result an error.
+   *@{
+   */
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator*(const SparseErrorArray<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::sparse_binary_op(lhs, rhs, detail::multiplies());
+  }
+
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_sparse_scalar<V, T, SparseErrorArray<T, P> >::type
+  operator*(const SparseErrorArray<T, P>& lhs, const V& rhs)
+  {
+    return detail::sparse_scalar_op(lhs, static_cast<T>(rhs), detail::multiplies());
+  }
+
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_sparse_scalar<U, T, SparseErrorArray<T, P> >::type
+  operator*(const U& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::scalar_sparse_op(static_cast<T>(lhs), rhs, detail::multiplies());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator*(const SparseErrorArray<T, P>& lhs, const ValueWithError<T, P>& rhs)
+  {
+    return detail::sparse_value_op(lhs, rhs, detail::multiplies());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator*(const ValueWithError<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::value_sparse_op(lhs, rhs, detail::multiplies());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator/(const SparseErrorArray<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::sparse_binary_op(lhs, rhs, detail::divides());
+  }
+
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_sparse_scalar<V, T, SparseErrorArray<T, P> >::type
+  operator/(const SparseErrorArray<T, P>& lhs, const V& rhs)
+  {
+    return detail::sparse_scalar_op(lhs, static_cast<T>(rhs), detail::divides());
+  }
+
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_sparse_scalar<U, T, SparseErrorArray<T, P> >::type
+  operator/(const U& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::scalar_sparse_op(static_cast<T>(lhs), rhs, detail::divides());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator/(const SparseErrorArray<T, P>& lhs, const ValueWithError<T, P>& rhs)
+  {
+    return detail::sparse_value_op(lhs, rhs, detail::divides());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator/(const ValueWithError<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::value_sparse_op(lhs, rhs, detail::divides());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator+(const SparseErrorArray<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::sparse_binary_op(lhs, rhs, detail::plus());
+  }
+
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_sparse_scalar<V, T, SparseErrorArray<T, P> >::type
+  operator+(const SparseErrorArray<T, P>& lhs, const V& rhs)
+  {
+    return detail::sparse_scalar_op(lhs, static_cast<T>(rhs), detail::plus());
+  }
+
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_sparse_scalar<U, T, SparseErrorArray<T, P> >::type
+  operator+(const U& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::scalar_sparse_op(static_cast<T>(lhs), rhs, detail::plus());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator+(const SparseErrorArray<T, P>& lhs, const ValueWithError<T, P>& rhs)
+  {
+    return detail::sparse_value_op(lhs, rhs, detail::plus());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator+(const ValueWithError<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::value_sparse_op(lhs, rhs, detail::plus());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator-(const SparseErrorArray<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::sparse_binary_op(lhs, rhs, detail::minus());
+  }
+
+  template<typename T, typename P, typename V>
+  typename detail::enable_if_sparse_scalar<V, T, SparseErrorArray<T, P> >::type
+  operator-(const SparseErrorArray<T, P>& lhs, const V& rhs)
+  {
+    return detail::sparse_scalar_op(lhs, static_cast<T>(rhs), detail::minus());
+  }
+
+  template<typename T, typename P, typename U>
+  typename detail::enable_if_sparse_scalar<U, T, SparseErrorArray<T, P> >::type
+  operator-(const U& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::scalar_sparse_op(static_cast<T>(lhs), rhs, detail::minus());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator-(const SparseErrorArray<T, P>& lhs, const ValueWithError<T, P>& rhs)
+  {
+    return detail::sparse_value_op(lhs, rhs, detail::minus());
+  }
+
+  template<typename T, typename P>
+  SparseErrorArray<T, P>
+  operator-(const ValueWithError<T, P>& lhs, const SparseErrorArray<T, P>& rhs)
+  {
+    return detail::value_sparse_op(lhs, rhs, detail::minus());
+  }
+  ///@}
+
+} // namespace error_propagation
+
+#endif // SPARSE_ERROR_ARRAY_HPP
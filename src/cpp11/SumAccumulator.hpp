@@ -0,0 +1,263 @@
+#ifndef SUM_ACCUMULATOR_HPP
+#define SUM_ACCUMULATOR_HPP
+
+#include "ValueWithError.hpp"
+#include "DetailSummation.hpp"
+
+namespace error_propagation {
+
+  /** @name Summation policies
+   *
+   * Rounding behaviour of the sums in SumAccumulator, both the sum of the values and the sum of the variances (or
+   * absolute errors with LinearCombinationPolicy).
+   *
+   * | Policy                | Error bound of n terms                | Order independent    | Relative cost, double |
+   * |-----------------------|---------------------------------------|----------------------|-----------------------|
+   * | PlainSummation        | n eps sum(abs(x))                     | no                   | 1                     |
+   * | CompensatedSummation  | 2 eps sum(abs(x))                     | no, within the bound | about 3               |
+   * | ReproducibleSummation | eps/2 abs(sum) + n 2^-148 max(abs(x)) | bitwise              | about 12              |
+   *
+   * ReproducibleSummation is limited to float and double, it is correctly rounded unless the sum cancels to below
+   * about n 2^-94 max(abs(x)). Its accumulator holds about 240 bytes, so it is best filled with operator+= per
+   * thread: std::accumulate copies the accumulator for every term and costs about 35 times PlainSummation. See
+   * Bench_SumAccumulator for the measurements.
+   *@{
+   */
+
+  /// Recursive summation, the default
+  class PlainSummation
+  {
+  public:
+    template<typename T>
+    struct accumulator
+    {
+      typedef detail::plain_sum<T> type;
+    };
+
+  private:
+    PlainSummation();
+    ~PlainSummation();
+  };
+
+  /// Kahan-Babuska-Neumaier compensated summation
+  class CompensatedSummation
+  {
+  public:
+    template<typename T>
+    struct accumulator
+    {
+      typedef detail::neumaier_sum<T> type;
+    };
+
+  private:
+    CompensatedSummation();
+    ~CompensatedSummation();
+  };
+
+  /// Summation in integer bins with fixed binary boundaries and a single rounding, the result is identical for any
+  /// order of the terms, thread count and grouping into partial sums
+  class ReproducibleSummation
+  {
+  public:
+    template<typename T>
+    struct accumulator
+    {
+      typedef detail::binned_sum<T> type;
+    };
+
+  private:
+    ReproducibleSummation();
+    ~ReproducibleSummation();
+  };
+  ///@}
+
+  namespace detail {
+
+    /// Error contributions of a sum under a combination policy, combined with Combine() for rules which are not sums
+    template<typename CombinationPolicy, typename Summation, typename T>
+    class error_sum
+    {
+    public:
+      void Add(const T& error)
+      {
+        m_error.Add(error);
+      }
+
+      void Merge(const error_sum& other)
+      {
+        m_error.Merge(other.m_error);
+      }
+
+      T Result() const
+      {
+        return m_error.Result();
+      }
+
+    private:
+      error_accumulator<CombinationPolicy, T> m_error;
+    };
+
+    /// Sum of the variances
+    template<typename Summation, typename T>
+    class error_sum<QuadratureCombinationPolicy, Summation, T>
+    {
+    public:
+      void Add(const T& error)
+      {
+        m_variance.Add(error * error);
+      }
+
+      void Merge(const error_sum& other)
+      {
+        m_variance.Merge(other.m_variance);
+      }
+
+      T Result() const
+      {
+        using std::sqrt;
+        return sqrt(m_variance.Result());
+      }
+
+    private:
+      typename Summation::template accumulator<T>::type m_variance;
+    };
+
+    /// Sum of the absolute errors
+    template<typename Summation, typename T>
+    class error_sum<LinearCombinationPolicy, Summation, T>
+    {
+    public:
+      void Add(const T& error)
+      {
+        using std::abs;
+        m_sum.Add(abs(error));
+      }
+
+      void Merge(const error_sum& other)
+      {
+        m_sum.Merge(other.m_sum);
+      }
+
+      T Result() const
+      {
+        return m_sum.Result();
+      }
+
+    private:
+      typename Summation::template accumulator<T>::type m_sum;
+    };
+
+  } // namespace detail
+
+  /** @brief Sum of ValueWithError terms for std::accumulate, std::reduce and std::transform_reduce
+   *
+   * Chained operator+ combines the error after every term, with QuadratureCombinationPolicy that is a hypot per
+   * term. SumAccumulator keeps the sum of the values and the error contributions in a form which adds up directly,
+   * the variance for QuadratureCombinationPolicy and the combined absolute errors for the other rules. The square
+   * root is taken once by Result().
+   *
+   * Adding two accumulators is associative and commutative up to rounding, so the terms may be grouped in any
+   * order, as the parallel execution policies of C++17 do. SumReduction is the matching binary operation. With
+   * ReproducibleSummation the result does not depend on the grouping at all.
+   *
+   * @code{cpp}
+     std::vector<ValueWithError<double> > x = ...;
+     ValueWithError<double> sum = std::reduce(std::execution::par_unseq, x.begin(), x.end(),
+                                              SumAccumulator<double>(), SumReduction<double>()).Result();
+     @endcode
+   *
+   * @tparam T  Arithmetic type, see ValueWithError
+   * @tparam P  Policy class, see ValueWithError
+   * @tparam S  Summation policy, PlainSummation (default), CompensatedSummation or ReproducibleSummation
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS, typename S = PlainSummation>
+  class SumAccumulator
+  {
+    public:
+    typedef T value_type;
+    typedef P policy_type;
+    typedef S summation_policy;
+    typedef ValueWithError<T, P> result_type;
+
+    /// Empty sum
+    SumAccumulator()
+    {
+    }
+
+    /// Sum of the single term v
+    explicit SumAccumulator(const result_type& v)
+    {
+      *this += v;
+    }
+
+    SumAccumulator& operator+=(const result_type& v)
+    {
+      m_value.Add(v.GetValue());
+      m_error.Add(v.GetError());
+      return *this;
+    }
+
+    SumAccumulator& operator+=(const SumAccumulator& other)
+    {
+      m_value.Merge(other.m_value);
+      m_error.Merge(other.m_error);
+      return *this;
+    }
+
+    friend SumAccumulator operator+(SumAccumulator lhs, const SumAccumulator& rhs)
+    {
+      return lhs += rhs;
+    }
+
+    /// Sum of the values
+    T GetValue() const
+    {
+      return m_value.Result();
+    }
+
+    /// Sum of the terms, the error combined according to the combination policy of P
+    result_type Result() const
+    {
+      return result_type(m_value.Result(), m_error.Result());
+    }
+
+    private:
+    typename S::template accumulator<T>::type m_value;
+    detail::error_sum<typename detail::combination_policy<P>::type, S, T> m_error;
+  };
+
+  /** @brief Binary operation for std::reduce and std::transform_reduce with SumAccumulator
+   *
+   * Accepts any combination of ValueWithError terms and partial sums, as required for the reductions with an
+   * execution policy, and returns the partial sum.
+   */
+  template<typename T, typename P = DEFAULT_POLICY_CLASS, typename S = PlainSummation>
+  struct SumReduction
+  {
+    typedef SumAccumulator<T, P, S> accumulator_type;
+    typedef ValueWithError<T, P> term_type;
+
+    accumulator_type operator()(const accumulator_type& lhs, const accumulator_type& rhs) const
+    {
+      return lhs + rhs;
+    }
+
+    accumulator_type operator()(accumulator_type lhs, const term_type& rhs) const
+    {
+      return lhs += rhs;
+    }
+
+    accumulator_type operator()(const term_type& lhs, accumulator_type rhs) const
+    {
+      return rhs += lhs;
+    }
+
+    accumulator_type operator()(const term_type& lhs, const term_type& rhs) const
+    {
+      return accumulator_type(lhs) += rhs;
+    }
+  };
+
+} // namespace error_propagation
+
+#endif // SUM_ACCUMULATOR_HPP
@@ -0,0 +1,421 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace error_propagation {
+
+  namespace detail {
+
+    /// Blocks owned by one participant of ThreadPool::ParallelFor, padded against false sharing with its neighbours
+    struct stealing_range
+    {
+      std::mutex mutex;
+      std::size_t begin;
+      std::size_t end;
+      char padding[64];
+    };
+
+    /** @brief Blocks [0, numBlocks) split evenly between the participants of ThreadPool::ParallelFor
+     *
+     * Every participant takes the blocks of its own range from the front. Once that is exhausted it steals the
+     * back half of the next non-empty range, so participants which got cheap blocks take over the remaining work of
+     * the others. At most one mutex is held at any time.
+     */
+    class stealing_ranges
+    {
+      public:
+      stealing_ranges(std::size_t numParticipants, std::size_t numBlocks)
+        :
+        m_ranges(numParticipants),
+        m_cancelled(false)
+      {
+        for(std::size_t p = 0; p < numParticipants; p++)
+        {
+          m_ranges[p].begin = p * numBlocks / numParticipants;
+          m_ranges[p].end = (p + 1) * numBlocks / numParticipants;
+        }
+      }
+
+      /// Next block of participant p, false if no blocks are left or the loop was cancelled
+      bool Next(std::size_t p, std::size_t& block)
+      {
+        if(m_cancelled)
+        {
+          return false;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(m_ranges[p].mutex);
+          if(m_ranges[p].begin < m_ranges[p].end)
+          {
+            block = m_ranges[p].begin++;
+            return true;
+          }
+        }
+
+        return Steal(p, block);
+      }
+
+      /// Hands out no further blocks, e.g. after a block has thrown
+      void Cancel()
+      {
+        m_cancelled = true;
+      }
+
+      private:
+      bool Steal(std::size_t p, std::size_t& block)
+      {
+        const std::size_t n = m_ranges.size();
+
+        for(std::size_t k = 1; k < n; k++)
+        {
+          stealing_range& victim = m_ranges[(p + k) % n];
+          std::size_t first, last;
+
+          {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if(victim.begin == victim.end)
+            {
+              continue;
+            }
+
+            last = victim.end;
+            first = last - (last - victim.begin + 1) / 2;
+            victim.end = first;
+          }
+
+          std::lock_guard<std::mutex> lock(m_ranges[p].mutex);
+          m_ranges[p].begin = first + 1;
+          m_ranges[p].end = last;
+          block = first;
+          return true;
+        }
+
+        return false;
+      }
+
+      std::vector<stealing_range> m_ranges;
+      std::atomic<bool> m_cancelled;
+    };
+
+  } // namespace detail
+
+  /** @brief Fixed number of worker threads with work stealing
+   *
+   * Used by the batch evaluation facilities for parallel execution. Every worker has its own task queue. Tasks
+   * submitted by a worker go to its own queue, other tasks are distributed round robin. Workers run the newest
+   * task of their own queue first and steal the oldest task of another queue when theirs is empty. The destructor
+   * finishes all queued tasks before joining the workers. Exceptions thrown by a task are rethrown by the future
+   * returned from Submit().
+   *
+   * @code{cpp}
+     ThreadPool pool;
+     pool.ParallelFor(data.size(), 1024, [&](std::size_t begin, std::size_t end)
+     {
+       for(std::size_t i = begin; i < end; i++)
+         result[i] = exp(data[i]);
+     });
+     @endcode
+   */
+  class ThreadPool
+  {
+    public:
+    typedef std::size_t size_type;
+
+    explicit ThreadPool(size_type numThreads = DefaultNumThreads())
+      :
+      m_pending(0),
+      m_next(0),
+      m_stop(false)
+    {
+      numThreads = std::max<size_type>(numThreads, 1);
+
+      // all queues must exist before the first worker steals from them
+      m_queues.reserve(numThreads);
+      for(size_type i = 0; i < numThreads; i++)
+      {
+        m_queues.emplace_back(new TaskQueue);
+      }
+
+      m_workers.reserve(numThreads);
+      for(size_type i = 0; i < numThreads; i++)
+      {
+        m_workers.emplace_back([this, i] { WorkerLoop(i); });
+      }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+
+      m_condition.notify_all();
+
+      for(std::thread& worker : m_workers)
+      {
+        worker.join();
+      }
+    }
+
+    /// Number of hardware threads, at least one
+    static size_type DefaultNumThreads()
+    {
+      return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+    }
+
+    /// Number of worker threads
+    size_type size() const
+    {
+      // m_workers is still growing while the first workers run
+      return m_queues.size();
+    }
+
+    /// Grain size giving each thread taking part in ParallelFor() about eight blocks of n elements
+    size_type DefaultGrain(size_type n) const
+    {
+      return std::max<size_type>(n / (8 * (size() + 1)), 1);
+    }
+
+    /// Queue f for execution, the future returns its result
+    template<typename F>
+    std::future<typename std::result_of<F()>::type>
+    Submit(F f)
+    {
+      typedef typename std::result_of<F()>::type R;
+
+      // std::function requires a copyable target
+      auto task = std::make_shared<std::packaged_task<R()> >(std::move(f));
+      std::future<R> result = task->get_future();
+
+      // counted before it becomes visible, so that m_pending never underflows
+      ++m_pending;
+
+      const size_type self = WorkerIndex();
+      TaskQueue& queue = *m_queues[self < size() ? self : m_next++ % size()];
+      {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back([task] { (*task)(); });
+      }
+
+      // a worker checks m_pending while holding m_mutex, locking it here avoids a lost wake-up
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+      }
+
+      m_condition.notify_one();
+      return result;
+    }
+
+    /** @brief Calls f(begin, end) for consecutive blocks of [0, n) and waits for all of them
+     *
+     * The calling thread and up to size() workers take part. Each of them starts with an equal share of the
+     * blocks and steals from the others when it runs out, so that elements with widely varying costs keep all
+     * threads busy. A small grain balances better, a large grain has less overhead per block. While waiting for
+     * the workers the calling thread runs queued tasks, so ParallelFor may also be called from a task.
+     *
+     * If f throws no further blocks are started and the first exception is rethrown.
+     *
+     * @param n     number of elements
+     * @param grain block size, all blocks except the last one have exactly this size
+     * @param f     callable taking the block boundaries, called concurrently
+     */
+    template<typename F>
+    void ParallelFor(size_type n, size_type grain, F f)
+    {
+      if(n == 0)
+      {
+        return;
+      }
+
+      grain = std::max<size_type>(grain, 1);
+      const size_type numBlocks = (n - 1) / grain + 1;
+      const size_type numParticipants = std::min(numBlocks, size() + 1);
+
+      detail::stealing_ranges ranges(numParticipants, numBlocks);
+
+      auto participate = [&](size_type p)
+      {
+        try
+        {
+          size_type block;
+          while(ranges.Next(p, block))
+          {
+            const size_type begin = block * grain;
+            f(begin, std::min(begin + grain, n));
+          }
+        }
+        catch(...)
+        {
+          ranges.Cancel();
+          throw;
+        }
+      };
+
+      std::vector<std::future<void> > futures;
+      futures.reserve(numParticipants - 1);
+
+      for(size_type p = 1; p < numParticipants; p++)
+      {
+        futures.push_back(Submit([&participate, p] { participate(p); }));
+      }
+
+      std::exception_ptr error;
+      try
+      {
+        participate(0);
+      }
+      catch(...)
+      {
+        error = std::current_exception();
+      }
+
+      // all participants must be finished before f goes out of scope, even if one of them throws
+      for(std::future<void>& future : futures)
+      {
+        while(future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+          if(!RunPendingTask())
+          {
+            std::this_thread::yield();
+          }
+        }
+      }
+
+      if(error)
+      {
+        std::rethrow_exception(error);
+      }
+
+      for(std::future<void>& future : futures)
+      {
+        future.get();
+      }
+    }
+
+  private:
+    struct TaskQueue
+    {
+      std::mutex mutex;
+      std::deque<std::function<void()> > tasks;
+    };
+
+    struct WorkerIdentity
+    {
+      const ThreadPool* pool;
+      size_type index;
+    };
+
+    static WorkerIdentity& CurrentWorker()
+    {
+      static thread_local WorkerIdentity identity = { nullptr, 0 };
+      return identity;
+    }
+
+    /// Index of the calling thread among the workers, size() for other threads
+    size_type WorkerIndex() const
+    {
+      const WorkerIdentity& identity = CurrentWorker();
+      return identity.pool == this ? identity.index : size();
+    }
+
+    /// Newest task of the own queue, otherwise the oldest task of another queue
+    bool TryPop(size_type self, std::function<void()>& task)
+    {
+      const size_type n = size();
+
+      if(self < n)
+      {
+        TaskQueue& queue = *m_queues[self];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(!queue.tasks.empty())
+        {
+          task = std::move(queue.tasks.back());
+          queue.tasks.pop_back();
+          return true;
+        }
+      }
+
+      for(size_type k = 1; k <= n; k++)
+      {
+        TaskQueue& queue = *m_queues[(self + k) % n];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(!queue.tasks.empty())
+        {
+          task = std::move(queue.tasks.front());
+          queue.tasks.pop_front();
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    /// Runs one queued task on the calling thread, false if all queues are empty
+    bool RunPendingTask()
+    {
+      std::function<void()> task;
+      if(!TryPop(WorkerIndex(), task))
+      {
+        return false;
+      }
+
+      --m_pending;
+      task();
+      return true;
+    }
+
+    void WorkerLoop(size_type index)
+    {
+      CurrentWorker() = WorkerIdentity{ this, index };
+
+      for(;;)
+      {
+        std::function<void()> task;
+        if(TryPop(index, task))
+        {
+          --m_pending;
+          task();
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] { return m_stop || m_pending > 0; });
+
+        if(m_pending == 0)
+        {
+          return;
+        }
+      }
+    }
+
+    std::vector<std::unique_ptr<TaskQueue> > m_queues;
+    std::vector<std::thread> m_workers;
+    std::atomic<size_type> m_pending;
+    std::atomic<size_type> m_next;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop;
+  };
+
+} // namespace error_propagation
+
+#endif // THREAD_POOL_HPP
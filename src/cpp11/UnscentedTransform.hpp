@@ -0,0 +1,239 @@
+#ifndef UNSCENTED_TRANSFORM_HPP
+#define UNSCENTED_TRANSFORM_HPP
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "ValueWithError.hpp"
+#include "DetailIndexSequence.hpp"
+#include "ThreadPool.hpp"
+
+namespace error_propagation {
+
+  /** @brief Error propagation with the scaled unscented transform
+   *
+   * Mid-cost method between the linear ValueWithError overloads and Monte Carlo for nonlinear functions of a
+   * few arguments. The callable is evaluated at 2N + 1 sigma points, the center and two points along each
+   * column of the matrix square root of the covariance, and the mean and error of the result are reconstructed
+   * from the weighted function values. Quadratic functions of normally distributed arguments are reproduced
+   * exactly with the default parameters alpha = 1, beta = 2 and kappa = 0.
+   *
+   * The arguments are either independent ValueWithError objects or values with a covariance matrix. With a
+   * ThreadPool the sigma points are evaluated in parallel, which pays off only for expensive callables.
+   *
+   * @code{cpp}
+     UnscentedTransform<double> transform;
+     auto y = transform.Propagate([](double a, double b) { return expensive_function(a, b); },
+                                  make_value(1.0, 0.2), make_value(2.0, 0.4));
+     @endcode
+   *
+   * @tparam T  Arithmetic type of the arguments and the result of the callable
+   */
+  template<typename T = double>
+  class UnscentedTransform
+  {
+    public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    /// @param pool optional thread pool for parallel evaluation, must outlive this object
+    explicit UnscentedTransform(ThreadPool* pool = nullptr)
+      :
+      m_pool(pool),
+      m_alpha(1),
+      m_beta(2),
+      m_kappa(0)
+    {}
+
+    ///@name Parameters
+    ///@{
+    /** @brief Set the parameters of the scaled unscented transform
+     *
+     * @param alpha spread of the sigma points around the mean, 0 < alpha <= 1
+     * @param beta  prior knowledge of the distribution, 2 is optimal for normal distributions
+     * @param kappa secondary scaling parameter, usually 0 or 3 - N
+     */
+    void SetParameters(const T& alpha, const T& beta, const T& kappa)
+    {
+      assert(alpha > T());
+      m_alpha = alpha;
+      m_beta = beta;
+      m_kappa = kappa;
+    }
+
+    const T& GetAlpha() const
+    {
+      return m_alpha;
+    }
+
+    const T& GetBeta() const
+    {
+      return m_beta;
+    }
+
+    const T& GetKappa() const
+    {
+      return m_kappa;
+    }
+    ///@}
+
+    /// Number of function evaluations for N arguments
+    static CONSTEXPR size_type NumSigmaPoints(size_type n)
+    {
+      return 2 * n + 1;
+    }
+
+    /// Propagate independent arguments through f, which is called with the values as N arguments of type T
+    template<typename F, typename P, typename... Args>
+    ValueWithError<T, P> Propagate(F f, const ValueWithError<T, P>& first, const Args&... rest)
+    {
+      const std::array<ValueWithError<T, P>, sizeof...(Args) + 1> args = {{ first, rest... }};
+      return Propagate(f, args);
+    }
+
+    /// Propagate independent arguments through f, which is called with the values as N arguments of type T
+    template<typename F, typename P, std::size_t N>
+    ValueWithError<T, P> Propagate(F f, const std::array<ValueWithError<T, P>, N>& args)
+    {
+      std::array<T, N> mean;
+      std::array<std::array<T, N>, N> root;
+
+      for(std::size_t i = 0; i < N; i++)
+      {
+        mean[i] = args[i].GetValue();
+        root[i].fill(T());
+        root[i][i] = args[i].GetError();
+      }
+
+      return Transform<P>(f, mean, root);
+    }
+
+    /** @brief Propagate correlated arguments through f
+     *
+     * @param mean       values of the arguments
+     * @param covariance symmetric positive semi-definite covariance matrix of the arguments
+     */
+    template<typename P = DEFAULT_POLICY_CLASS, typename F, std::size_t N>
+    ValueWithError<T, P> Propagate(F f, const std::array<T, N>& mean, const std::array<std::array<T, N>, N>& covariance)
+    {
+      return Transform<P>(f, mean, Cholesky(covariance));
+    }
+
+    private:
+    /// Lower triangular L with L L^T = covariance, columns without remaining variance stay zero
+    template<std::size_t N>
+    static std::array<std::array<T, N>, N> Cholesky(const std::array<std::array<T, N>, N>& covariance)
+    {
+      using std::sqrt;
+
+      std::array<std::array<T, N>, N> root;
+      for(std::size_t i = 0; i < N; i++)
+      {
+        root[i].fill(T());
+      }
+
+      for(std::size_t j = 0; j < N; j++)
+      {
+        T diagonal = covariance[j][j];
+        for(std::size_t k = 0; k < j; k++)
+        {
+          diagonal -= root[j][k] * root[j][k];
+        }
+
+        // rounding residue of a semi-definite matrix
+        if(!(diagonal > static_cast<T>(N) * std::numeric_limits<T>::epsilon() * covariance[j][j]))
+        {
+          continue;
+        }
+
+        root[j][j] = sqrt(diagonal);
+
+        for(std::size_t i = j + 1; i < N; i++)
+        {
+          T sum = covariance[i][j];
+          for(std::size_t k = 0; k < j; k++)
+          {
+            sum -= root[i][k] * root[j][k];
+          }
+
+          root[i][j] = sum / root[j][j];
+        }
+      }
+
+      return root;
+    }
+
+    /// Evaluate f at the sigma points mean and mean +- sqrt(N + lambda) times the columns of root
+    template<typename P, typename F, std::size_t N>
+    ValueWithError<T, P> Transform(F& f, const std::array<T, N>& mean, const std::array<std::array<T, N>, N>& root) const
+    {
+      using std::sqrt;
+
+      const T n = static_cast<T>(N);
+      const T lambda = m_alpha * m_alpha * (n + m_kappa) - n;
+      const T scale = sqrt(n + lambda);
+
+      std::array<T, 2 * N + 1> values;
+
+      auto evaluate = [&](std::size_t begin, std::size_t end)
+      {
+        for(std::size_t s = begin; s < end; s++)
+        {
+          std::array<T, N> point = mean;
+
+          if(s > 0)
+          {
+            const std::size_t column = (s - 1) / 2;
+            const T sign = (s % 2 == 1) ? T(1) : T(-1);
+
+            for(std::size_t i = 0; i < N; i++)
+            {
+              point[i] += sign * scale * root[i][column];
+            }
+          }
+
+          values[s] = detail::call_with_array(f, point, detail::make_index_sequence<N>());
+        }
+      };
+
+      if(m_pool)
+      {
+        m_pool->ParallelFor(values.size(), 1, evaluate);
+      }
+      else
+      {
+        evaluate(0, values.size());
+      }
+
+      const T meanWeight0 = lambda / (n + lambda);
+      const T covarianceWeight0 = meanWeight0 + T(1) - m_alpha * m_alpha + m_beta;
+      const T weight = T(1) / (T(2) * (n + lambda));
+
+      T resultMean = meanWeight0 * values[0];
+      for(std::size_t s = 1; s < values.size(); s++)
+      {
+        resultMean += weight * values[s];
+      }
+
+      T variance = covarianceWeight0 * (values[0] - resultMean) * (values[0] - resultMean);
+      for(std::size_t s = 1; s < values.size(); s++)
+      {
+        variance += weight * (values[s] - resultMean) * (values[s] - resultMean);
+      }
+
+      // negative center weights can give a slightly negative variance
+      return ValueWithError<T, P>(resultMean, variance > T() ? sqrt(variance) : T());
+    }
+
+    ThreadPool* m_pool;
+    T m_alpha;
+    T m_beta;
+    T m_kappa;
+  };
+
+} // namespace error_propagation
+
+#endif // UNSCENTED_TRANSFORM_HPP
@@ -1,8 +1,18 @@
 #ifndef VALUE_WITH_ERROR_HPP
 #define VALUE_WITH_ERROR_HPP
 
+#ifdef DISABLE_ERROR_PROPAGATION
+
+#include "../DisabledValueWithError.hpp"
+
+#else
+
+#include <iterator>
+
 #include "../DetailValueWithError.hpp"
 #include "../ValueWithErrorComparisonPolicy.hpp"
+#include "../ValueWithErrorCombinationPolicy.hpp"
+#include "ValueWithErrorDerivativePolicy.hpp"
 
 namespace error_propagation {
 
@@ -33,8 +43,12 @@ namespace error_propagation {
      #include "ValueWithError.hpp"
      @endcode
    *
+   * The errors of two arguments are combined in quadrature as written in the formulas below. A policy class with a
+   * nested typedef combination_policy selects another rule, e.g. the worst case bound LinearCombinationPolicy,
+   * see CombinedPolicy.
+   *
    * @tparam T  Arithmetic type, must support all basic arithmetic operations
-   * @tparam P  Policy class for comparing values and errors
+   * @tparam P  Policy class for comparing values and errors and optionally for combining errors
    */
   template<typename T, typename P>
   class ValueWithError
@@ -314,7 +328,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() * rhs.GetValue(),
-                                detail::hypot<R>(rhs.GetValue() * lhs.GetError(),lhs.GetValue() * rhs.GetError())
+                                detail::combine_errors<P, R>(rhs.GetValue() * lhs.GetError(),lhs.GetValue() * rhs.GetError())
                                );
   }
 
@@ -359,7 +373,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() / rhs.GetValue(),
-                                detail::hypot( lhs.GetError(), lhs.GetValue() / rhs.GetValue() * rhs.GetError()) / rhs.GetValue()
+                                detail::combine_errors<P>( lhs.GetError(), lhs.GetValue() / rhs.GetValue() * rhs.GetError()) / rhs.GetValue()
                                );
   }
 
@@ -404,7 +418,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() + rhs.GetValue(),
-                                detail::hypot(lhs.GetError(), rhs.GetError())
+                                detail::combine_errors<P>(lhs.GetError(), rhs.GetError())
                                );
   }
 
@@ -449,7 +463,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() - rhs.GetValue(),
-                                detail::hypot(lhs.GetError(), rhs.GetError())
+                                detail::combine_errors<P>(lhs.GetError(), rhs.GetError())
                                );
   }
 
@@ -692,7 +706,7 @@ namespace error_propagation {
 
   /**@name Mathematical function overloads
    *
-   *not overloaded: ceil, copysign, fma, fmax, fmin, fmod, frexp,
+   *not overloaded: ceil, copysign, fmax, fmin, fmod, frexp,
    *                ilogb, ldexp, llrint, llround, logb, lrint, lround,
    *                modf, nan, nanf, nanl, nearbyint, nextafter, nexttoward,
    *                remainder, remquo, rint, round, scalbln, scalbn, trunc,
@@ -779,7 +793,7 @@ namespace error_propagation {
     return ValueWithError<R, P>(
                                 atan2(y.GetValue(), x.GetValue()),
                                 1.0 / (y.GetValue() * y.GetValue() + x.GetValue() * x.GetValue()) *
-                                detail::hypot(y.GetValue() * x.GetError(), x.GetValue() * y.GetError())
+                                detail::combine_errors<P>(y.GetValue() * x.GetError(), x.GetValue() * y.GetError())
                                );
   }
 
@@ -871,9 +885,10 @@ namespace error_propagation {
   cbrt(const ValueWithError<T, P>& v)
   {
     using std::cbrt;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 cbrt(v.GetValue()),
-                                1.0/(3.0 * cbrt(v.GetValue() * v.GetValue())) * v.GetError()
+                                1.0/(3.0 * Derivative::Cbrt(T(v.GetValue() * v.GetValue()))) * v.GetError()
                                );
   }
 
@@ -886,10 +901,10 @@ namespace error_propagation {
   cos(const ValueWithError<T, P>& v)
   {
     using std::cos;
-    using std::sin;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 cos(v.GetValue()),
-                                sin(v.GetValue())*v.GetError()
+                                Derivative::Sin(v.GetValue())*v.GetError()
                                );
   }
 
@@ -902,10 +917,10 @@ namespace error_propagation {
   cosh(const ValueWithError<T, P>& v)
   {
     using std::cosh;
-    using std::sinh;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 cosh(v.GetValue()),
-                                sinh(v.GetValue()) * v.GetError()
+                                Derivative::Sinh(v.GetValue()) * v.GetError()
                                );
   }
 
@@ -914,15 +929,15 @@ namespace error_propagation {
    *  *Computation:* \f$ \textrm{erf}([v\pm e]) = [\textrm{erf}(v) \pm 2\exp(-v^2)e\left/\sqrt{\pi}\right.] \f$
    */
   template<typename T, typename P>
-  CONSTEXPR ValueWithError<T, P>
+  ValueWithError<T, P>
   erf(const ValueWithError<T, P>& v)
   {
-    using std::erf;
-    using std::exp;
-    using boost::math::constants::root_pi;
+    typedef typename detail::derivative_policy<P>::type Derivative;
+    T value, factor;
+    detail::special_function<Derivative>::template evaluate<detail::erf_function>(v.GetValue(), value, factor);
     return ValueWithError<T, P>(
-                                erf(v.GetValue()),
-                                2.0 / root_pi<T>() * exp(-v.GetValue() * v.GetValue()) * v.GetError()
+                                std::move(value),
+                                factor * v.GetError()
                                );
   }
 
@@ -931,15 +946,15 @@ namespace error_propagation {
    *  *Computation:* \f$ \textrm{erfc}([v\pm e]) = [\textrm{erfc}(v) \pm 2\exp(-v^2)e\left/\sqrt{\pi}\right.] \f$
    */
   template<typename T, typename P>
-  CONSTEXPR ValueWithError<T, P>
+  ValueWithError<T, P>
   erfc(const ValueWithError<T, P>& v)
   {
-    using std::erfc;
-    using std::exp;
-    using boost::math::constants::root_pi;
+    typedef typename detail::derivative_policy<P>::type Derivative;
+    T value, factor;
+    detail::special_function<Derivative>::template evaluate<detail::erfc_function>(v.GetValue(), value, factor);
     return ValueWithError<T, P>(
-                                erfc(v.GetValue()),
-                                2.0 / root_pi<T>() * exp(-v.GetValue() * v.GetValue()) * v.GetError()
+                                std::move(value),
+                                factor * v.GetError()
                                );
   }
 
@@ -953,9 +968,10 @@ namespace error_propagation {
   {
     using std::exp2;
     using boost::math::constants::ln_two;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 exp2(v.GetValue()),
-                                ln_two<T>() * exp2(v.GetValue()) * v.GetError()
+                                ln_two<T>() * Derivative::Exp2(v.GetValue()) * v.GetError()
                                );
   }
 
@@ -968,9 +984,10 @@ namespace error_propagation {
   exp(const ValueWithError<T, P>& v)
   {
     using std::exp;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 exp(v.GetValue()),
-                                exp(v.GetValue()) * v.GetError()
+                                Derivative::Exp(v.GetValue()) * v.GetError()
                                );
   }
 
@@ -983,10 +1000,10 @@ namespace error_propagation {
   expm1(const ValueWithError<T, P>& v)
   {
     using std::expm1;
-    using std::exp;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 expm1(v.GetValue()),
-                                exp(v.GetValue()) * v.GetError()
+                                Derivative::Exp(v.GetValue()) * v.GetError()
                                );
   }
 
@@ -1005,6 +1022,126 @@ namespace error_propagation {
                                );
   }
 
+  /// Fused multiply-add. Overload for three arguments of ValueWithError type.
+  /**
+   *  *Computation:* \f$ \textrm{fma}([v_x\pm e_x], [v_y\pm e_y], [v_z\pm e_z]) = [\textrm{fma}(v_x, v_y, v_z) \pm \sqrt{(v_ye_x)^2+(v_xe_y)^2+e_z^2}] \f$
+   *
+   *  The three contributions are combined in one pass with a single square root, instead of the two of x * y + z.
+   */
+  template<typename U, typename V, typename W, typename P>
+  ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const ValueWithError<V, P>& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    const R a = y.GetValue() * x.GetError();
+    const R b = x.GetValue() * y.GetError();
+    detail::error_accumulator<typename detail::combination_policy<P>::type, R> error(a);
+    error.Add(b);
+    error.Add(z.GetError());
+    return ValueWithError<R, P>(
+                                fma(x.GetValue(), y.GetValue(), z.GetValue()),
+                                error.InRange() ? error.Result()
+                                                : detail::combine_errors<P>(detail::combine_errors<P>(a, b), z.GetError())
+                               );
+  }
+
+  /// Fused multiply-add. Overload for ValueWithError factors and a general compatible summand.
+  /**
+   *  *Computation:* \f$ \textrm{fma}([v_x\pm e_x], [v_y\pm e_y], z) = [\textrm{fma}(v_x, v_y, z) \pm \sqrt{(v_ye_x)^2+(v_xe_y)^2}] \f$
+   */
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const ValueWithError<V, P>& y, const W& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(
+                                fma(x.GetValue(), y.GetValue(), z),
+                                detail::combine_errors<P>(y.GetValue() * x.GetError(), x.GetValue() * y.GetError())
+                               );
+  }
+
+  /// Fused multiply-add. Overload for a ValueWithError first factor and summand and a general compatible second factor.
+  /**
+   *  *Computation:* \f$ \textrm{fma}([v_x\pm e_x], y, [v_z\pm e_z]) = [\textrm{fma}(v_x, y, v_z) \pm \sqrt{(ye_x)^2+e_z^2}] \f$
+   */
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const V& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(
+                                fma(x.GetValue(), y, z.GetValue()),
+                                detail::combine_errors<P>(y * x.GetError(), z.GetError())
+                               );
+  }
+
+  /// Fused multiply-add. Overload for a general compatible first factor and a ValueWithError second factor and summand.
+  /**
+   *  *Computation:* \f$ \textrm{fma}(x, [v_y\pm e_y], [v_z\pm e_z]) = [\textrm{fma}(x, v_y, v_z) \pm \sqrt{(xe_y)^2+e_z^2}] \f$
+   */
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const U& x, const ValueWithError<V, P>& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(
+                                fma(x, y.GetValue(), z.GetValue()),
+                                detail::combine_errors<P>(x * y.GetError(), z.GetError())
+                               );
+  }
+
+  /// Fused multiply-add. Overload for a ValueWithError first factor, the other arguments are of general compatible type.
+  /**
+   *  *Computation:* \f$ \textrm{fma}([v_x\pm e_x], y, z) = [\textrm{fma}(v_x, y, z) \pm ye_x] \f$
+   */
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const ValueWithError<U, P>& x, const V& y, const W& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(
+                                fma(x.GetValue(), y, z),
+                                y * x.GetError()
+                               );
+  }
+
+  /// Fused multiply-add. Overload for a ValueWithError second factor, the other arguments are of general compatible type.
+  /**
+   *  *Computation:* \f$ \textrm{fma}(x, [v_y\pm e_y], z) = [\textrm{fma}(x, v_y, z) \pm xe_y] \f$
+   */
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const U& x, const ValueWithError<V, P>& y, const W& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(
+                                fma(x, y.GetValue(), z),
+                                x * y.GetError()
+                               );
+  }
+
+  /// Fused multiply-add. Overload for a ValueWithError summand, the factors are of general compatible type.
+  /**
+   *  *Computation:* \f$ \textrm{fma}(x, y, [v_z\pm e_z]) = [\textrm{fma}(x, y, v_z) \pm e_z] \f$
+   */
+  template<typename U, typename V, typename W, typename P>
+  CONSTEXPR ValueWithError<typename detail::promote_args<U, V, W>::type, P>
+  fma(const U& x, const V& y, const ValueWithError<W, P>& z)
+  {
+    using std::fma;
+    typedef typename detail::promote_args<U, V, W>::type R;
+    return ValueWithError<R, P>(
+                                fma(x, y, z.GetValue()),
+                                z.GetError()
+                               );
+  }
+
   /// Square root of the sum of squares of two numbers. Overload for two arguments of ValueWithError type.
   /**
    *  *Computation:* \f$ \textrm{hypot}([v_x\pm e_x], [v_y\pm e_y]) = [\textrm{hypot}(v_x, v_y) \pm \textrm{hypot}(v_xe_x, v_ye_y)\left/\left(v_x^2+v_y^2\right)\right.] \f$
@@ -1016,7 +1153,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 detail::hypot(x.GetValue(), y.GetValue()),
-                                detail::hypot(x.GetValue() * x.GetError(), y.GetValue() * y.GetError())
+                                detail::combine_errors<P>(x.GetValue() * x.GetError(), y.GetValue() * y.GetError())
                                 / (x.GetValue() * x.GetValue() + y.GetValue() * y.GetValue())
                                );
   }
@@ -1057,15 +1194,17 @@ namespace error_propagation {
    *  using the "digamma" function \f$ \Psi(x) = \textrm{d}\ln(\Gamma(x))/dx = \Gamma'(x)\left/\Gamma(x)\right. \f$.
    */
   template<typename T, typename P>
-  CONSTEXPR ValueWithError<T, P>
+  ValueWithError<T, P>
   lgamma(const ValueWithError<T, P>& v)
   {
     // lgamma(x) = ln(abs(Gamma(x)))
     // lgamma'(x) = (ln(abs(Gamma(x))))' = abs'(Gamma(x))/abs(Gamma(x)) = (sign(Gamma(x))*abs(Gamma'(x))) / abs(Gamma(x)) = sign(Gamma(x))*abs(DiGamma(x))
-    using std::lgamma;
+    typedef typename detail::derivative_policy<P>::type Derivative;
+    T value, factor;
+    detail::special_function<Derivative>::template evaluate<detail::lgamma_function>(v.GetValue(), value, factor);
     return ValueWithError<T, P>(
-                                lgamma(v.GetValue()),
-                                detail::digamma(v.GetValue()) * v.GetError()
+                                std::move(value),
+                                factor * v.GetError()
                                );
   }
 
@@ -1141,9 +1280,10 @@ namespace error_propagation {
   {
     using std::pow;
     typedef typename detail::promote_args<T, V>::type R;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<R, P>(
                                 pow(base.GetValue(), exponent),
-                                exponent*pow(base.GetValue(), exponent-1)*base.GetError()
+                                exponent*Derivative::Pow(base.GetValue(), exponent-1)*base.GetError()
                                );
   }
 
@@ -1156,11 +1296,11 @@ namespace error_propagation {
   pow(const V& base, const ValueWithError<T, P>& exponent)
   {
     using std::pow;
-    using std::log;
     typedef typename detail::promote_args<V, T>::type R;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<R, P>(
                                 pow(base, exponent.GetValue()),
-                                log(base) * pow(base, exponent.GetValue()) * exponent.GetError()
+                                Derivative::Log(base) * Derivative::Pow(base, exponent.GetValue()) * exponent.GetError()
                                );
   }
 
@@ -1173,18 +1313,57 @@ namespace error_propagation {
   pow(const ValueWithError<T, P>& base, const ValueWithError<V, P>& exponent)
   {
     using std::pow;
-    using std::log;
     typedef typename detail::promote_args<T, V>::type R;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<R, P>(
                                 pow(base.GetValue(), exponent.GetValue()),
-                                pow(base.GetValue(), exponent.GetValue())
-                                * detail::hypot<R,R>(
-                                                     exponent.GetValue() / base.GetValue() * base.GetError(),
-                                                     log(base.GetValue()) * exponent.GetError()
-                                                    )
+                                Derivative::Pow(base.GetValue(), exponent.GetValue())
+                                * detail::combine_errors<P,R,R>(
+                                                                exponent.GetValue() / base.GetValue() * base.GetError(),
+                                                                Derivative::Log(base.GetValue()) * exponent.GetError()
+                                                               )
                               );
   }
 
+  /// Raises a number to an integer power given at compile time, e.g. pow<2>(x).
+  /**
+   *  *Computation:* \f$ \textrm{pow}\langle N\rangle([v\pm e]) = [v^N \pm Nv^{N-1}e] \f$
+   *
+   *  Value and error are computed with repeated multiplications unrolled at compile time, without std::pow. The
+   *  result has the type of the argument. For N == 0 the error is zero.
+   */
+  template<int N, typename T, typename P>
+  ValueWithError<T, P>
+  pow(const ValueWithError<T, P>& base)
+  {
+    T error;
+    T value = detail::power_with_error<T, N>::apply(base.GetValue(), base.GetError(), error);
+    return ValueWithError<T, P>(
+                                std::move(value),
+                                std::move(error)
+                               );
+  }
+
+  /// Raises a number to an integer power. Overload for one argument of type ValueWithError and an int exponent.
+  /**
+   *  *Computation:* \f$ \textrm{pow}([v\pm e], n) = [v^n \pm nv^{n-1}e] \f$
+   *
+   *  Same result type as pow(const ValueWithError<T, P>&, const V&), but value and error are computed with
+   *  binary exponentiation instead of two calls of std::pow. For n == 0 the error is zero.
+   */
+  template<typename T, typename P>
+  ValueWithError<typename detail::promote_args<T, int>::type, P>
+  pow(const ValueWithError<T, P>& base, int exponent)
+  {
+    typedef typename detail::promote_args<T, int>::type R;
+    R error;
+    R value = detail::power_with_error_n<R>(base.GetValue(), exponent, base.GetError(), error);
+    return ValueWithError<R, P>(
+                                std::move(value),
+                                std::move(error)
+                               );
+  }
+
   /// Sine.
   /**
    *  *Computation:* \f$ \sin([v\pm e]) = [\sin(v) \pm \cos(v)e] \f$
@@ -1193,11 +1372,11 @@ namespace error_propagation {
   CONSTEXPR ValueWithError<T, P>
   sin(const ValueWithError<T, P>& v)
   {
-    using std::cos;
     using std::sin;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 sin(v.GetValue()),
-                                cos(v.GetValue()) * v.GetError()
+                                Derivative::Cos(v.GetValue()) * v.GetError()
                                );
   }
 
@@ -1209,11 +1388,11 @@ namespace error_propagation {
   CONSTEXPR ValueWithError<T, P>
   sinh(const ValueWithError<T, P>& v)
   {
-    using std::cosh;
     using std::sinh;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 sinh(v.GetValue()),
-                                cosh(v.GetValue()) * v.GetError()
+                                Derivative::Cosh(v.GetValue()) * v.GetError()
                                );
   }
 
@@ -1240,11 +1419,11 @@ namespace error_propagation {
   CONSTEXPR ValueWithError<T, P>
   tan(const ValueWithError<T, P>& v)
   {
-    using std::cos;
     using std::tan;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 tan(v.GetValue()),
-                                v.GetError() / (cos(v.GetValue()) * cos(v.GetValue()))
+                                v.GetError() / (Derivative::Cos(v.GetValue()) * Derivative::Cos(v.GetValue()))
                                );
   }
 
@@ -1256,11 +1435,11 @@ namespace error_propagation {
   CONSTEXPR ValueWithError<T, P>
   tanh(const ValueWithError<T, P>& v)
   {
-    using std::cosh;
     using std::tanh;
+    typedef typename detail::derivative_policy<P>::type Derivative;
     return ValueWithError<T, P>(
                                 tanh(v.GetValue()),
-                                v.GetError() / (cosh(v.GetValue()) * cosh(v.GetValue()))
+                                v.GetError() / (Derivative::Cosh(v.GetValue()) * Derivative::Cosh(v.GetValue()))
                                );
   }
 
@@ -1270,15 +1449,138 @@ namespace error_propagation {
    *  using the "digamma" function \f$ \Psi(x) = \textrm{d}\ln(\Gamma(x))/dx = \Gamma'(x)\left/\Gamma(x)\right. \f$.
    */
   template<typename T, typename P>
-  CONSTEXPR ValueWithError<T, P>
+  ValueWithError<T, P>
   tgamma(const ValueWithError<T, P>& v)
   {
-    using std::tgamma;
+    typedef typename detail::derivative_policy<P>::type Derivative;
+    T value, factor;
+    detail::special_function<Derivative>::template evaluate<detail::tgamma_function>(v.GetValue(), value, factor);
     return ValueWithError<T, P>(
-                                tgamma(v.GetValue()),
-                                detail::digamma(v.GetValue()) * tgamma(v.GetValue()) * v.GetError()
+                                std::move(value),
+                                factor * v.GetError()
                                );
+  }
+  ///@}
 
+  namespace detail {
+
+    template<typename T, typename P>
+    CONSTEXPR const T& value_of(const ValueWithError<T, P>& a)
+    {
+      return a.GetValue();
+    }
+
+    template<typename T>
+    CONSTEXPR T error_of(const T&)
+    {
+      return T();
+    }
+
+    template<typename T, typename P>
+    CONSTEXPR const T& error_of(const ValueWithError<T, P>& a)
+    {
+      return a.GetError();
+    }
+
+    /// Horner's scheme for the value, the derivative and the coefficient errors in a single loop, adds the error
+    /// contributions to error and returns the value
+    template<bool x_has_error, typename T, typename Iterator, typename Accumulator>
+    T horner(Iterator first, Iterator last, const T& x, const T& xError, Accumulator& error)
+    {
+      if(first == last)
+      {
+        return T();
+      }
+
+      --last;
+      T value = T(value_of(*last));
+      T derivative = T();
+      error.Add(T(error_of(*last)));
+
+      while(last != first)
+      {
+        --last;
+        if(x_has_error)
+        {
+          derivative = multiply_add(derivative, x, value);
+        }
+        value = multiply_add(value, x, T(value_of(*last)));
+        error.Scale(x);
+        error.Add(T(error_of(*last)));
+      }
+
+      if(x_has_error)
+      {
+        error.Add(derivative * xError);
+      }
+
+      return value;
+    }
+
+    /// Horner's scheme, repeated with the contributions combined one by one if the single pass left the safe range
+    template<typename P, bool x_has_error, typename T, typename Iterator>
+    ValueWithError<T, P> horner(Iterator first, Iterator last, const T& x, const T& xError)
+    {
+      typedef typename combination_policy<P>::type CombinationPolicy;
+
+      error_accumulator<CombinationPolicy, T> error;
+      const T value = horner<x_has_error>(first, last, x, xError, error);
+      if(error.InRange())
+      {
+        return ValueWithError<T, P>(value, error.Result());
+      }
+
+      combining_error_accumulator<CombinationPolicy, T> combined;
+      horner<x_has_error>(first, last, x, xError, combined);
+      return ValueWithError<T, P>(value, combined.Result());
+    }
+
+  } // namespace detail
+
+  /**@name Polynomial evaluation
+   *
+   * Evaluates \f$ p(x) = \sum_{k=0}^{n} c_kx^k \f$ with Horner's scheme for coefficients \f$ c_0,\ldots,c_n \f$
+   * given in ascending order by bidirectional iterators. The coefficients may be ValueWithError or of the
+   * underlying type, their errors are independent of each other and of the error of x.
+   *
+   * Value, derivative and error are accumulated in a single loop with fused multiply-adds where the target has fast
+   * ones (FP_FAST_FMA, e.g. with -mfma) and one square root at the end:
+   *
+   *  *Computation:* \f$ p([v\pm e]) = [p(v) \pm \sqrt{(p'(v)e)^2+\sum_k(v^ke_k)^2}] \f$
+   *
+   * The operator chain ((c_n * x + c_{n-1}) * x + ...) needs two square roots per coefficient and treats the
+   * partial sums as independent of x, which misses the correlation of the terms in the error of x.
+   *@{
+   */
+
+  /// Polynomial in x with an error.
+  template<typename Iterator, typename T, typename P>
+  ValueWithError<T, P>
+  evaluate_polynomial(Iterator first, Iterator last, const ValueWithError<T, P>& x)
+  {
+    return detail::horner<P, true>(first, last, x.GetValue(), x.GetError());
+  }
+
+  /// Polynomial with ValueWithError coefficients in an exact x.
+  template<typename Iterator>
+  typename std::iterator_traits<Iterator>::value_type
+  evaluate_polynomial(Iterator first, Iterator last, const typename std::iterator_traits<Iterator>::value_type::value_type& x)
+  {
+    typedef typename std::iterator_traits<Iterator>::value_type R;
+    return detail::horner<typename R::policy_type, false>(first, last, x, typename R::value_type());
+  }
+
+  /// Polynomial evaluated for each x in [xFirst, xLast), like std::transform. Returns the end of the results.
+  template<typename Iterator, typename InputIterator, typename OutputIterator>
+  OutputIterator
+  evaluate_polynomial(Iterator first, Iterator last, InputIterator xFirst, InputIterator xLast, OutputIterator result)
+  {
+    for(; xFirst != xLast; ++xFirst, ++result)
+    {
+      *result = evaluate_polynomial(first, last, *xFirst);
+    }
+
+    return result;
   }
   ///@}
 
@@ -1318,4 +1620,6 @@ namespace error_propagation {
 
 } // namespace error_propagation
 
+#endif // DISABLE_ERROR_PROPAGATION
+
 #endif // VALUE_WITH_ERROR_HPP
@@ -0,0 +1,743 @@
+#ifndef VALUE_WITH_ERROR_DERIVATIVEPOLICY_HPP
+#define VALUE_WITH_ERROR_DERIVATIVEPOLICY_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/mpl/has_xxx.hpp>
+
+#include "../DetailValueWithError.hpp"
+#include "../fwd.hpp"
+
+namespace error_propagation {
+  namespace detail {
+
+    // Bounded accuracy approximations for double, the bounds are verified by Test_DerivativePolicy. Arguments
+    // outside of the approximated range (non-finite, subnormal, poles, huge arguments of sin and cos) are passed to
+    // the full precision functions.
+
+    inline std::uint64_t bits_of(double x)
+    {
+      std::uint64_t bits;
+      std::memcpy(&bits, &x, sizeof(bits));
+      return bits;
+    }
+
+    inline double from_bits(std::uint64_t bits)
+    {
+      double x;
+      std::memcpy(&x, &bits, sizeof(x));
+      return x;
+    }
+
+    /// exp(x) with a relative error below 2e-8 for |x| < 708: x = k ln(2) + r with |r| <= ln(2)/2, Taylor polynomial
+    /// of degree 7 in Estrin's form
+    inline double fast_exp(double x)
+    {
+      if(!(std::abs(x) < 708.0))
+      {
+        return std::exp(x);
+      }
+
+      // adding 1.5 * 2^52 rounds to an integer which ends up in the low bits of the mantissa
+      const double shift = 6755399441055744.0;
+      const double shifted = x * 1.4426950408889634 + shift;
+      const double k = shifted - shift;
+
+      // ln(2) split into a high part with trailing zeros, so that k * high is exact
+      const double r = (x - k * 6.93147180369123816490e-01) - k * 1.90821492927058770002e-10;
+      const double r2 = r * r;
+      const double p = (1.0 + r) + r2 * ((1.0 / 2 + r * (1.0 / 6))
+                                         + r2 * ((1.0 / 24 + r * (1.0 / 120)) + r2 * (1.0 / 720 + r * (1.0 / 5040))));
+
+      return p * from_bits((bits_of(shifted) + 1023) << 52);
+    }
+
+    /// log(x) with a relative error below 5e-9: x = 2^k m with sqrt(1/2) <= m < sqrt(2), series of atanh((m-1)/(m+1))
+    inline double fast_log(double x)
+    {
+      if(!(x >= std::numeric_limits<double>::min()) || x > std::numeric_limits<double>::max())
+      {
+        return std::log(x);
+      }
+
+      const std::uint64_t bits = bits_of(x);
+      int k = static_cast<int>(bits >> 52) - 1023;
+      double m = from_bits((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+      if(m > 1.4142135623730951)
+      {
+        m *= 0.5;
+        ++k;
+      }
+
+      const double s = (m - 1.0) / (m + 1.0);
+      const double s2 = s * s;
+      return k * 0.6931471805599453
+             + 2.0 * s * (1.0 + s2 * (1.0 / 3 + s2 * (1.0 / 5 + s2 * (1.0 / 7 + s2 * (1.0 / 9)))));
+    }
+
+    /// x - k pi/2 with |x - k pi/2| <= pi/4 and the quadrant k mod 4, for |x| < 1e5, rounds like fast_exp
+    inline double reduce_half_pi(double x, int& quadrant)
+    {
+      const double shift = 6755399441055744.0;
+      const double shifted = x * 0.6366197723675814 + shift;
+      const double k = shifted - shift;
+      quadrant = static_cast<int>(bits_of(shifted) & 3);
+
+      // pi/2 split into a high part with trailing zeros, so that k * high is exact
+      return (x - k * 1.57079632673412561417e+00) - k * 6.07710050650619224932e-11;
+    }
+
+    /// Taylor polynomial of degree 9 for |r| <= pi/4, absolute error below 2e-9
+    inline double sin_polynomial(double r)
+    {
+      const double r2 = r * r;
+      return r + r * r2 * (-1.0 / 6 + r2 * (1.0 / 120 + r2 * (-1.0 / 5040 + r2 * (1.0 / 362880))));
+    }
+
+    /// Taylor polynomial of degree 10 for |r| <= pi/4, absolute error below 2e-10
+    inline double cos_polynomial(double r)
+    {
+      const double r2 = r * r;
+      return 1.0 + r2 * (-1.0 / 2 + r2 * (1.0 / 24 + r2 * (-1.0 / 720 + r2 * (1.0 / 40320 + r2 * (-1.0 / 3628800)))));
+    }
+
+    /// sin(x) with an absolute error below 5e-9 for |x| < 1e5
+    inline double fast_sin(double x)
+    {
+      if(!(std::abs(x) < 1e5))
+      {
+        return std::sin(x);
+      }
+
+      int quadrant;
+      const double r = reduce_half_pi(x, quadrant);
+      switch(quadrant)
+      {
+        case 0:
+          return sin_polynomial(r);
+        case 1:
+          return cos_polynomial(r);
+        case 2:
+          return -sin_polynomial(r);
+        default:
+          return -cos_polynomial(r);
+      }
+    }
+
+    /// cos(x) with an absolute error below 5e-9 for |x| < 1e5
+    inline double fast_cos(double x)
+    {
+      if(!(std::abs(x) < 1e5))
+      {
+        return std::cos(x);
+      }
+
+      int quadrant;
+      const double r = reduce_half_pi(x, quadrant);
+      switch(quadrant)
+      {
+        case 0:
+          return cos_polynomial(r);
+        case 1:
+          return -sin_polynomial(r);
+        case 2:
+          return -cos_polynomial(r);
+        default:
+          return sin_polynomial(r);
+      }
+    }
+
+    /// sinh(x) with a relative error below 5e-8, Taylor polynomial for |x| < 1/2 where exp(x) - exp(-x) cancels
+    inline double fast_sinh(double x)
+    {
+      const double a = std::abs(x);
+      if(a < 0.5)
+      {
+        const double x2 = x * x;
+        return x + x * x2 * (1.0 / 6 + x2 * (1.0 / 120 + x2 * (1.0 / 5040 + x2 * (1.0 / 362880))));
+      }
+
+      const double e = fast_exp(a);
+      const double s = 0.5 * (e - 1.0 / e);
+      return x < 0 ? -s : s;
+    }
+
+    /// cosh(x) with a relative error below 2e-8
+    inline double fast_cosh(double x)
+    {
+      const double e = fast_exp(std::abs(x));
+      return 0.5 * (e + 1.0 / e);
+    }
+
+    /// cbrt(x) with a relative error below 2e-6: bit pattern estimate and two Newton steps
+    inline double fast_cbrt(double x)
+    {
+      const double a = std::abs(x);
+      if(!(a >= std::numeric_limits<double>::min()) || a > std::numeric_limits<double>::max())
+      {
+        return std::cbrt(x);
+      }
+
+      // divides the biased exponent by three, the offset (1023 - 1023/3 - 0.033) * 2^20 reduces the initial error
+      const std::uint64_t high = (bits_of(a) >> 32) / 3 + 715094163;
+      double y = from_bits(high << 32);
+      y = (2.0 * y + a / (y * y)) * (1.0 / 3);
+      y = (2.0 * y + a / (y * y)) * (1.0 / 3);
+      return x < 0 ? -y : y;
+    }
+
+    /// pow(x, y) for x > 0 as exp(y log(x)), relative error below 2e-8 + 5e-9 |y log(x)|
+    inline double fast_pow(double x, double y)
+    {
+      if(!(x > 0) || x > std::numeric_limits<double>::max())
+      {
+        return std::pow(x, y);
+      }
+
+      return fast_exp(y * fast_log(x));
+    }
+
+    /// digamma(x) for x > 0 with an error below 1e-8 max(1, |digamma(x)|): recurrence to x >= 6 and asymptotic series
+    inline double fast_digamma(double x)
+    {
+      if(!(x > 0) || x > std::numeric_limits<double>::max())
+      {
+        return digamma(x);
+      }
+
+      double result = 0.0;
+      for(; x < 6.0; x += 1.0)
+      {
+        result -= 1.0 / x;
+      }
+
+      const double r = 1.0 / x;
+      const double r2 = r * r;
+      return result + fast_log(x) - 0.5 * r
+             - r2 * (1.0 / 12 - r2 * (1.0 / 120 - r2 * (1.0 / 252 - r2 * (1.0 / 240 - r2 * (1.0 / 132)))));
+    }
+
+    /// tgamma(x) for 0 < x < 171 with a relative error below 3e-6 (below 2e-7 for x < 10): recurrence to x >= 6
+    /// and Stirling series of lgamma
+    inline double fast_tgamma(double x)
+    {
+      if(!(x > 0) || !(x < 171.0))
+      {
+        return std::tgamma(x);
+      }
+
+      double scale = 1.0;
+      for(; x < 6.0; x += 1.0)
+      {
+        scale *= x;
+      }
+
+      const double r = 1.0 / x;
+      const double r2 = r * r;
+      const double lgamma = (x - 0.5) * fast_log(x) - x + 0.91893853320467274
+                            + r * (1.0 / 12 - r2 * (1.0 / 360 - r2 * (1.0 / 1260 - r2 * (1.0 / 1680))));
+      return fast_exp(lgamma) / scale;
+    }
+
+    // Value and derivative factor of the special functions which the derivative policies may evaluate as a whole,
+    // with the derivative functions of the policy D
+    struct erf_function
+    {
+      template<typename D, typename T>
+      static void evaluate(const T& x, T& value, T& factor)
+      {
+        using std::erf;
+        using boost::math::constants::root_pi;
+        value = erf(x);
+        factor = 2.0 / root_pi<T>() * D::Exp(T(-x * x));
+      }
+    };
+
+    struct erfc_function
+    {
+      template<typename D, typename T>
+      static void evaluate(const T& x, T& value, T& factor)
+      {
+        using std::erfc;
+        using boost::math::constants::root_pi;
+        value = erfc(x);
+        factor = 2.0 / root_pi<T>() * D::Exp(T(-x * x));
+      }
+    };
+
+    struct lgamma_function
+    {
+      template<typename D, typename T>
+      static void evaluate(const T& x, T& value, T& factor)
+      {
+        using std::lgamma;
+        value = lgamma(x);
+        factor = D::Digamma(x);
+      }
+    };
+
+    struct tgamma_function
+    {
+      template<typename D, typename T>
+      static void evaluate(const T& x, T& value, T& factor)
+      {
+        using std::tgamma;
+        value = tgamma(x);
+        factor = D::Digamma(x) * D::Tgamma(x);
+      }
+    };
+
+    /// Evaluates the special functions above for the derivative policy D, specialized by MemoizedDerivativePolicy
+    template<typename D>
+    struct special_function
+    {
+      template<typename Function, typename T>
+      static void evaluate(const T& x, T& value, T& factor)
+      {
+        Function::template evaluate<D>(x, value, factor);
+      }
+    };
+
+    // Arguments are the same if their bits are, i.e. 0.0 and -0.0 differ and NaN never matches
+    template<typename T>
+    bool same_argument(const T& a, const T& b)
+    {
+      return a == b;
+    }
+
+    template<typename T>
+    bool same_builtin_argument(T a, T b)
+    {
+      return a == b && std::signbit(a) == std::signbit(b);
+    }
+
+    inline bool same_argument(float a, float b)              { return same_builtin_argument(a, b); }
+    inline bool same_argument(double a, double b)            { return same_builtin_argument(a, b); }
+    inline bool same_argument(long double a, long double b)  { return same_builtin_argument(a, b); }
+
+    /** Set associative cache of the value and derivative factor of one function, thread-safe
+     *
+     * The set of four slots is selected by boost::hash of the argument, which supports the builtin types and
+     * boost::multiprecision. A new argument replaces the oldest one of its set. The sets are guarded by striped
+     * locks.
+     */
+    template<typename T, std::size_t Slots>
+    class function_cache
+    {
+      static_assert(Slots > 0 && (Slots < 4 || Slots % 4 == 0),
+                    "MemoizedDerivativePolicy requires 1, 2 or 3 slots or a multiple of 4");
+
+    public:
+      function_cache()
+        :
+        m_entries(Slots),
+        m_oldest(numSets, 0)
+      {}
+
+      /// Copies the cached value and factor of x, returns false if x is not cached
+      bool Find(const T& x, T& value, T& factor)
+      {
+        const std::size_t set = Set(x);
+        std::lock_guard<std::mutex> lock(Lock(set));
+
+        for(std::size_t slot = set * ways; slot < (set + 1) * ways; slot++)
+        {
+          const Entry& entry = m_entries[slot];
+          if(entry.valid && same_argument(entry.argument, x))
+          {
+            value = entry.value;
+            factor = entry.factor;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      void Insert(const T& x, const T& value, const T& factor)
+      {
+        const std::size_t set = Set(x);
+        std::lock_guard<std::mutex> lock(Lock(set));
+
+        Entry& entry = m_entries[set * ways + m_oldest[set]];
+        m_oldest[set] = (m_oldest[set] + 1) % ways;
+
+        entry.valid = true;
+        entry.argument = x;
+        entry.value = value;
+        entry.factor = factor;
+      }
+
+      void Clear()
+      {
+        for(std::size_t set = 0; set < numSets; set++)
+        {
+          std::lock_guard<std::mutex> lock(Lock(set));
+          for(std::size_t slot = set * ways; slot < (set + 1) * ways; slot++)
+          {
+            m_entries[slot].valid = false;
+          }
+          m_oldest[set] = 0;
+        }
+      }
+
+    private:
+      static const std::size_t ways = Slots < 4 ? Slots : 4;
+      static const std::size_t numSets = Slots / ways;
+      static const std::size_t numLocks = 16;
+
+      struct Entry
+      {
+        Entry() : valid(false), argument(), value(), factor() {}
+
+        bool valid;
+        T argument;
+        T value;
+        T factor;
+      };
+
+      // boost::hash of a double are its bits with mostly zero low bits, mixed with the splitmix64 finalizer
+      static std::size_t Set(const T& x)
+      {
+        std::uint64_t h = static_cast<std::uint64_t>(boost::hash<T>()(x));
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<std::size_t>(h ^ (h >> 31)) % numSets;
+      }
+
+      std::mutex& Lock(std::size_t set)
+      {
+        return m_locks[set % numLocks];
+      }
+
+      std::vector<Entry> m_entries;
+      std::vector<std::size_t> m_oldest;
+      std::mutex m_locks[numLocks];
+    };
+
+    /// One cache per policy, function and type
+    template<typename Policy, typename Function, typename T>
+    function_cache<T, Policy::slots>& memoization_cache()
+    {
+      static function_cache<T, Policy::slots> cache;
+      return cache;
+    }
+
+    /// Hits and misses of all functions of one policy and type
+    template<typename Policy, typename T>
+    struct memoization_counters
+    {
+      static std::atomic<std::size_t>& hits()
+      {
+        static std::atomic<std::size_t> counter(0);
+        return counter;
+      }
+
+      static std::atomic<std::size_t>& misses()
+      {
+        static std::atomic<std::size_t> counter(0);
+        return counter;
+      }
+    };
+
+  } // namespace detail
+
+  /** @name Derivative policies
+   *
+   * Functions evaluating the derivative factor in the error of the math functions of ValueWithError, e.g.
+   * @f$ \exp(-v^2) @f$ in the error of erf() or @f$ \Psi(v) @f$ in the error of lgamma(). The value is always
+   * computed with full precision. Selected with the nested typedef derivative_policy of the policy class P of
+   * ValueWithError, see CombinedPolicy. Policy classes without that typedef use ExactDerivativePolicy.
+   *
+   * The policy is applied by the C++11 math overloads of ValueWithError. Besides the derivatives a policy can
+   * evaluate erf, erfc, lgamma and tgamma as a whole by specializing detail::special_function, see
+   * MemoizedDerivativePolicy.
+   *@{
+   */
+
+  /// Full precision derivatives, the same functions as for the value
+  class ExactDerivativePolicy
+  {
+  public:
+    template<typename T>
+    static typename detail::promote_args<T>::type Exp(const T& x)
+    {
+      using std::exp;
+      return exp(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Exp2(const T& x)
+    {
+      using std::exp2;
+      return exp2(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Log(const T& x)
+    {
+      using std::log;
+      return log(x);
+    }
+
+    template<typename T, typename U>
+    static typename detail::promote_args<T, U>::type Pow(const T& x, const U& y)
+    {
+      using std::pow;
+      return pow(x, y);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Sin(const T& x)
+    {
+      using std::sin;
+      return sin(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Cos(const T& x)
+    {
+      using std::cos;
+      return cos(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Sinh(const T& x)
+    {
+      using std::sinh;
+      return sinh(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Cosh(const T& x)
+    {
+      using std::cosh;
+      return cosh(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Cbrt(const T& x)
+    {
+      using std::cbrt;
+      return cbrt(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Digamma(const T& x)
+    {
+      return detail::digamma(x);
+    }
+
+    template<typename T>
+    static typename detail::promote_args<T>::type Tgamma(const T& x)
+    {
+      using std::tgamma;
+      return tgamma(x);
+    }
+
+  protected:
+    ExactDerivativePolicy();
+    ~ExactDerivativePolicy();
+  };
+
+  /** @brief Bounded accuracy derivatives for float and double, full precision for other types
+   *
+   * The error only needs a few significant digits, so its derivative factor is evaluated with polynomial
+   * approximations instead of the full precision library functions. Bounds of the error of the derivative
+   * factor for double, relative unless noted otherwise; float is evaluated in double and rounded:
+   *
+   * | Function | Used by               | Bound                                            |
+   * |----------|-----------------------|--------------------------------------------------|
+   * | Exp      | exp, expm1, erf, erfc | 2e-8                                             |
+   * | Log      | pow                   | 5e-9                                             |
+   * | Pow      | pow                   | 2e-8 + 5e-9 \|y log(x)\|                         |
+   * | Sin, Cos | cos, sin, tan         | 5e-9 absolute for \|x\| < 1e5                    |
+   * | Sinh     | cosh                  | 5e-8                                             |
+   * | Cosh     | sinh, tanh            | 2e-8                                             |
+   * | Cbrt     | cbrt                  | 2e-6                                             |
+   * | Digamma  | lgamma, tgamma        | 1e-8, absolute where \|digamma(x)\| < 1, x > 0    |
+   * | Tgamma   | tgamma                | 3e-6, 2e-7 for x < 10                            |
+   *
+   * Exp2 is not approximated, as exp2 of the C library is already faster than Exp. Arguments outside of the
+   * approximated ranges, e.g. negative arguments of Digamma and Tgamma, use the full precision functions.
+   *
+   * @code{cpp}
+     typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, FastDerivativePolicy> Fast;
+     erf(ValueWithError<double, Fast>(0.5, 0.01)); // error 2/sqrt(pi) exp(-0.25) 0.01 with 8 significant digits
+     @endcode
+   */
+  class FastDerivativePolicy : public ExactDerivativePolicy
+  {
+  public:
+    using ExactDerivativePolicy::Exp;
+    using ExactDerivativePolicy::Log;
+    using ExactDerivativePolicy::Pow;
+    using ExactDerivativePolicy::Sin;
+    using ExactDerivativePolicy::Cos;
+    using ExactDerivativePolicy::Sinh;
+    using ExactDerivativePolicy::Cosh;
+    using ExactDerivativePolicy::Cbrt;
+    using ExactDerivativePolicy::Digamma;
+    using ExactDerivativePolicy::Tgamma;
+
+    static double Exp(double x)           { return detail::fast_exp(x); }
+    static double Log(double x)           { return detail::fast_log(x); }
+    static double Pow(double x, double y) { return detail::fast_pow(x, y); }
+    static double Sin(double x)           { return detail::fast_sin(x); }
+    static double Cos(double x)           { return detail::fast_cos(x); }
+    static double Sinh(double x)          { return detail::fast_sinh(x); }
+    static double Cosh(double x)          { return detail::fast_cosh(x); }
+    static double Cbrt(double x)          { return detail::fast_cbrt(x); }
+    static double Digamma(double x)       { return detail::fast_digamma(x); }
+    static double Tgamma(double x)        { return detail::fast_tgamma(x); }
+
+    static float Exp(float x)             { return static_cast<float>(detail::fast_exp(x)); }
+    static float Log(float x)             { return static_cast<float>(detail::fast_log(x)); }
+    static float Pow(float x, float y)    { return static_cast<float>(detail::fast_pow(x, y)); }
+    static float Sin(float x)             { return static_cast<float>(detail::fast_sin(x)); }
+    static float Cos(float x)             { return static_cast<float>(detail::fast_cos(x)); }
+    static float Sinh(float x)            { return static_cast<float>(detail::fast_sinh(x)); }
+    static float Cosh(float x)            { return static_cast<float>(detail::fast_cosh(x)); }
+    static float Cbrt(float x)            { return static_cast<float>(detail::fast_cbrt(x)); }
+    static float Digamma(float x)         { return static_cast<float>(detail::fast_digamma(x)); }
+    static float Tgamma(float x)          { return static_cast<float>(detail::fast_tgamma(x)); }
+
+  private:
+    FastDerivativePolicy();
+    ~FastDerivativePolicy();
+  };
+
+  /// Hits and misses of the cache of MemoizedDerivativePolicy
+  class MemoizationStatistics
+  {
+  public:
+    MemoizationStatistics(std::size_t hits, std::size_t misses)
+      :
+      m_hits(hits),
+      m_misses(misses)
+    {}
+
+    std::size_t GetHits() const   { return m_hits; }
+    std::size_t GetMisses() const { return m_misses; }
+
+    /// Fraction of the calls answered from the cache, zero without calls
+    double GetHitRate() const
+    {
+      const std::size_t calls = m_hits + m_misses;
+      return calls > 0 ? static_cast<double>(m_hits) / static_cast<double>(calls) : 0.0;
+    }
+
+  private:
+    std::size_t m_hits;
+    std::size_t m_misses;
+  };
+
+  /** @brief Caches erf, erfc, lgamma and tgamma, the other derivatives are those of Base
+   *
+   * Meant for expensive types like boost::multiprecision::cpp_dec_float_100, where each of these functions costs
+   * milliseconds, in workloads with few distinct arguments. Value and derivative factor of each function are
+   * stored in a bounded, four-way set associative cache with Slots entries per function and type, keyed on the
+   * argument value (on its bits for the builtin types) and shared by all threads. For the builtin types a
+   * lookup costs about as much as erf.
+   *
+   * The constants like root_pi<T>() used by the overloads need no extra table, boost::math computes them once
+   * per type.
+   *
+   * @code{cpp}
+     typedef MemoizedDerivativePolicy<> Memoized;
+     typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, Memoized> Policy;
+     tgamma(ValueWithError<cpp_dec_float_100, Policy>(2.5, 0.1)); // computed once, then taken from the cache
+     Memoized::Statistics<cpp_dec_float_100>().GetHitRate();
+     @endcode
+   *
+   * @tparam Base  ExactDerivativePolicy or FastDerivativePolicy
+   * @tparam Slots number of cached arguments per function and type, 1, 2, 3 or a multiple of 4
+   */
+  template<typename Base = ExactDerivativePolicy, std::size_t Slots = 256>
+  class MemoizedDerivativePolicy : public Base
+  {
+  public:
+    typedef Base base_policy;
+    static const std::size_t slots = Slots;
+
+    template<typename T>
+    static MemoizationStatistics Statistics()
+    {
+      typedef detail::memoization_counters<MemoizedDerivativePolicy, T> counters;
+      return MemoizationStatistics(counters::hits().load(), counters::misses().load());
+    }
+
+    /// Empties the caches of T and resets its statistics
+    template<typename T>
+    static void Clear()
+    {
+      typedef detail::memoization_counters<MemoizedDerivativePolicy, T> counters;
+      detail::memoization_cache<MemoizedDerivativePolicy, detail::erf_function, T>().Clear();
+      detail::memoization_cache<MemoizedDerivativePolicy, detail::erfc_function, T>().Clear();
+      detail::memoization_cache<MemoizedDerivativePolicy, detail::lgamma_function, T>().Clear();
+      detail::memoization_cache<MemoizedDerivativePolicy, detail::tgamma_function, T>().Clear();
+      counters::hits() = 0;
+      counters::misses() = 0;
+    }
+
+  private:
+    MemoizedDerivativePolicy();
+    ~MemoizedDerivativePolicy();
+  };
+
+  template<typename Base, std::size_t Slots>
+  const std::size_t MemoizedDerivativePolicy<Base, Slots>::slots;
+  ///@}
+
+  namespace detail {
+
+    BOOST_MPL_HAS_XXX_TRAIT_DEF(derivative_policy)
+
+    /// Derivative policy of the policy class P, ExactDerivativePolicy if P doesn't define one
+    template<typename P, bool has_policy = has_derivative_policy<P>::value>
+    struct derivative_policy
+    {
+      typedef ExactDerivativePolicy type;
+    };
+
+    template<typename P>
+    struct derivative_policy<P, true>
+    {
+      typedef typename P::derivative_policy type;
+    };
+
+    /// Takes value and factor from the cache, evaluates them with the derivatives of Base on a miss
+    template<typename Base, std::size_t Slots>
+    struct special_function<MemoizedDerivativePolicy<Base, Slots> >
+    {
+      template<typename Function, typename T>
+      static void evaluate(const T& x, T& value, T& factor)
+      {
+        typedef MemoizedDerivativePolicy<Base, Slots> Policy;
+        function_cache<T, Slots>& cache = memoization_cache<Policy, Function, T>();
+
+        if(cache.Find(x, value, factor))
+        {
+          memoization_counters<Policy, T>::hits().fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+
+        memoization_counters<Policy, T>::misses().fetch_add(1, std::memory_order_relaxed);
+        Function::template evaluate<Base>(x, value, factor);
+        cache.Insert(x, value, factor);
+      }
+    };
+
+  } // namespace detail
+
+} // namespace error_propagation
+
+#endif // VALUE_WITH_ERROR_DERIVATIVEPOLICY_HPP
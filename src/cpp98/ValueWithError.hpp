@@ -1,8 +1,15 @@
 #ifndef  VALUE_WITH_ERROR_HPP
 #define VALUE_WITH_ERROR_HPP
 
+#ifdef DISABLE_ERROR_PROPAGATION
+
+#include "../DisabledValueWithError.hpp"
+
+#else
+
 #include "../DetailValueWithError.hpp"
 #include "../ValueWithErrorComparisonPolicy.hpp"
+#include "../ValueWithErrorCombinationPolicy.hpp"
 
 /// All documentation is located in ../cpp11/ValueWithError.hpp which
 /// is a superset of the functionality implemented here.
@@ -182,7 +189,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() * rhs.GetValue(),
-                                detail::hypot<R>(rhs.GetValue() * lhs.GetError(),lhs.GetValue() * rhs.GetError())
+                                detail::combine_errors<P, R>(rhs.GetValue() * lhs.GetError(),lhs.GetValue() * rhs.GetError())
                                );
   }
 
@@ -216,7 +223,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() / rhs.GetValue(),
-                                detail::hypot( lhs.GetError(), lhs.GetValue() / rhs.GetValue() * rhs.GetError()) / rhs.GetValue()
+                                detail::combine_errors<P>( lhs.GetError(), lhs.GetValue() / rhs.GetValue() * rhs.GetError()) / rhs.GetValue()
                                );
   }
 
@@ -250,7 +257,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() + rhs.GetValue(),
-                                detail::hypot(lhs.GetError(), rhs.GetError())
+                                detail::combine_errors<P>(lhs.GetError(), rhs.GetError())
                                );
   }
 
@@ -284,7 +291,7 @@ namespace error_propagation {
     typedef typename detail::promote_args<U, V>::type R;
     return ValueWithError<R, P>(
                                 lhs.GetValue() - rhs.GetValue(),
-                                detail::hypot(lhs.GetError(), rhs.GetError())
+                                detail::combine_errors<P>(lhs.GetError(), rhs.GetError())
                                );
   }
 
@@ -575,7 +582,7 @@ namespace error_propagation {
     return ValueWithError<R, P>(
                                 atan2(y.GetValue(),
                                 x.GetValue()),1.0 / (y.GetValue() * y.GetValue() + x.GetValue() * x.GetValue())
-                                * detail::hypot(y.GetValue() * x.GetError(), x.GetValue() * y.GetError())
+                                * detail::combine_errors<P>(y.GetValue() * x.GetError(), x.GetValue() * y.GetError())
                                );
   }
 
@@ -708,10 +715,37 @@ namespace error_propagation {
     return ValueWithError<R, P>(
                                 pow(base.GetValue(), exponent.GetValue()),
                                 pow(base.GetValue(), exponent.GetValue())
-                                * detail::hypot<R,R>(
-                                                     exponent.GetValue() / base.GetValue() * base.GetError(),
-                                                     log(base.GetValue()) * exponent.GetError()
-                                                    )
+                                * detail::combine_errors<P,R,R>(
+                                                                exponent.GetValue() / base.GetValue() * base.GetError(),
+                                                                log(base.GetValue()) * exponent.GetError()
+                                                               )
+                               );
+  }
+
+  /// Integer power given at compile time, e.g. pow<2>(x), with multiplications only. Zero error for N == 0.
+  template<int N, typename T, typename P>
+  const ValueWithError<T, P>
+  pow(const ValueWithError<T, P>& base)
+  {
+    T error;
+    const T value = detail::power_with_error<T, N>::apply(base.GetValue(), base.GetError(), error);
+    return ValueWithError<T, P>(
+                                value,
+                                error
+                               );
+  }
+
+  /// Integer power with binary exponentiation instead of std::pow. Zero error for exponent == 0.
+  template<typename T, typename P>
+  const ValueWithError<typename detail::promote_args<T, int>::type, P>
+  pow(const ValueWithError<T, P>& base, int exponent)
+  {
+    typedef typename detail::promote_args<T, int>::type R;
+    R error;
+    const R value = detail::power_with_error_n<R>(base.GetValue(), exponent, base.GetError(), error);
+    return ValueWithError<R, P>(
+                                value,
+                                error
                                );
   }
 
@@ -804,4 +838,6 @@ namespace error_propagation {
 
 } // namespace error_propagation
 
+#endif // DISABLE_ERROR_PROPAGATION
+
 #endif // VALUE_WITH_ERROR_HPP
@@ -5,12 +5,31 @@
 #define DEFAULT_POLICY_CLASS ExactValueAndIgnoreErrorPolicy
 #endif // not DEFAULT_POLICY_CLASS
 
+// Define DISABLE_ERROR_PROPAGATION to get a ValueWithError which only stores and computes the value
+// With C++11 the disabled variant lives in its own inline namespace so that both variants can be linked into one program
+#if defined(DISABLE_ERROR_PROPAGATION) && __cplusplus >= 201103L
+#define BEGIN_VALUE_WITH_ERROR_NAMESPACE inline namespace disabled {
+#define END_VALUE_WITH_ERROR_NAMESPACE }
+#else
+#define BEGIN_VALUE_WITH_ERROR_NAMESPACE
+#define END_VALUE_WITH_ERROR_NAMESPACE
+#endif
+
 namespace error_propagation {
 
   class ExactValueAndIgnoreErrorPolicy;
   class CompareWithinErrorIntervalsPolicy;
+  class QuadratureCombinationPolicy;
+  class LinearCombinationPolicy;
+  class MaximumCombinationPolicy;
+  class ExactDerivativePolicy;
+  class FastDerivativePolicy;
+  template<typename ComparisonPolicy, typename CombinationPolicy, typename DerivativePolicy = ExactDerivativePolicy>
+  class CombinedPolicy;
+
+  BEGIN_VALUE_WITH_ERROR_NAMESPACE
   template<typename T, typename P = DEFAULT_POLICY_CLASS>
   class ValueWithError;
+  END_VALUE_WITH_ERROR_NAMESPACE
 
 } // namespace error_propagation
-
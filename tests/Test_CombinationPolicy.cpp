@@ -0,0 +1,129 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif // __GNUC__
+
+#include <boost/test/unit_test.hpp>
+
+#include <valarray>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, LinearCombinationPolicy>     LinearPolicy;
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, MaximumCombinationPolicy>    MaximumPolicy;
+  typedef CombinedPolicy<CompareWithinErrorIntervalsPolicy, LinearCombinationPolicy>  WorstCasePolicy;
+
+  typedef ValueWithError<double>                  VD;
+  typedef ValueWithError<double, LinearPolicy>    VL;
+  typedef ValueWithError<double, MaximumPolicy>   VM;
+  typedef ValueWithError<double, WorstCasePolicy> VW;
+
+  const double tolerance = 1e-12;
+
+  struct CombinationPolicyFixture{ };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_CombinationPolicy,CombinationPolicyFixture)
+
+BOOST_AUTO_TEST_CASE(combine)
+{
+  BOOST_CHECK_EQUAL(QuadratureCombinationPolicy::Combine(3.0, -4.0), 5.0);
+  BOOST_CHECK_EQUAL(LinearCombinationPolicy::Combine(3.0, -4.0), 7.0);
+  BOOST_CHECK_EQUAL(MaximumCombinationPolicy::Combine(3.0, -4.0), 4.0);
+  BOOST_CHECK_EQUAL(MaximumCombinationPolicy::Combine(-3.0f, 2.0), 3.0);
+
+  // element-wise for types without std::less
+  const double a[] = { -3.0, 1.0 };
+  const double b[] = { 2.0, -5.0 };
+  const std::valarray<double> result = MaximumCombinationPolicy::Combine(std::valarray<double>(a, 2), std::valarray<double>(b, 2));
+  BOOST_CHECK_EQUAL(result[0], 3.0);
+  BOOST_CHECK_EQUAL(result[1], 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(policy_selection)
+{
+  BOOST_CHECK((boost::is_same<detail::combination_policy<ExactValueAndIgnoreErrorPolicy>::type, QuadratureCombinationPolicy>::value));
+  BOOST_CHECK((boost::is_same<detail::combination_policy<CompareWithinErrorIntervalsPolicy>::type, QuadratureCombinationPolicy>::value));
+  BOOST_CHECK((boost::is_same<detail::combination_policy<LinearPolicy>::type, LinearCombinationPolicy>::value));
+  BOOST_CHECK((boost::is_same<detail::combination_policy<MaximumPolicy>::type, MaximumCombinationPolicy>::value));
+
+  // the default is unchanged
+  BOOST_CHECK_PV((VD(1.0, 3.0) + VD(2.0, 4.0)), 3.0, 5.0);
+
+  // the comparison policy is kept
+  BOOST_CHECK(VW(1.0, 0.5) == VW(1.4, 0.1));
+  BOOST_CHECK(!(VL(1.0, 0.5) == VL(1.4, 0.1)));
+}
+
+BOOST_AUTO_TEST_CASE(linear)
+{
+  const VL x(1.0, 0.1);
+  const VL y(-2.0, 0.2);
+
+  BOOST_CHECK_CLOSE((x * y).GetError(), 0.4, tolerance);
+  BOOST_CHECK_CLOSE((x / y).GetError(), 0.1, tolerance);
+  BOOST_CHECK_CLOSE((x + y).GetError(), 0.3, tolerance);
+  BOOST_CHECK_CLOSE((x - y).GetError(), 0.3, tolerance);
+  BOOST_CHECK_CLOSE(atan2(x, y).GetError(), 0.08, tolerance);
+
+  const VL base(2.0, 0.1);
+  const VL exponent(3.0, 0.2);
+  BOOST_CHECK_CLOSE(pow(base, exponent).GetError(), 8.0 * (1.5 * 0.1 + std::log(2.0) * 0.2), tolerance);
+
+  // scalars don't contribute
+  BOOST_CHECK_CLOSE((x * 3.0 + 1.0).GetError(), 0.3, tolerance);
+
+  // compound operators
+  VL z = x;
+  z += y;
+  z *= y;
+  BOOST_CHECK_CLOSE(z.GetError(), 2.0 * 0.3 + 1.0 * 0.2, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(maximum)
+{
+  const VM x(1.0, 0.1);
+  const VM y(-2.0, 0.3);
+
+  BOOST_CHECK_CLOSE((x * y).GetError(), 0.3, tolerance);
+  BOOST_CHECK_CLOSE((x / y).GetError(), 0.075, tolerance);
+  BOOST_CHECK_CLOSE((x + y).GetError(), 0.3, tolerance);
+  BOOST_CHECK_CLOSE((x - y).GetError(), 0.3, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(ordering)
+{
+  // maximum <= quadrature <= linear
+  const VD qx(1.5, 0.1), qy(0.7, 0.05);
+  const VL lx(1.5, 0.1), ly(0.7, 0.05);
+  const VM mx(1.5, 0.1), my(0.7, 0.05);
+
+  BOOST_CHECK_LE((mx * my / (mx - my)).GetError(), (qx * qy / (qx - qy)).GetError());
+  BOOST_CHECK_LE((qx * qy / (qx - qy)).GetError(), (lx * ly / (lx - ly)).GetError());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_CombinationPolicy
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif // __GNUC__
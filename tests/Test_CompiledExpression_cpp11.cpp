@@ -0,0 +1,154 @@
+#include "CompiledExpression.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>         VD;
+  typedef DeferredValueWithError<double> DD;
+  typedef CompiledExpression<double>     Expression;
+
+  const std::size_t numRows = 1000;
+
+  /// Formula used for recording and as reference
+  template<typename X>
+  X formula(const X& x, const X& y)
+  {
+    return exp(-1.0 * x * y) * sin(y) + pow(x, 2.0) / (1.0 + hypot(x, y)) - atan2(2.0, x);
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      x(tape.Input(0.0, 0.0)),
+      y(tape.Input(0.0, 0.0)),
+      f(formula(x, y)),
+      g(log(x) * y)
+    {
+      for(std::size_t i = 0; i < numRows; i++)
+      {
+        xv.push_back(0.5 + 1e-3 * static_cast<double>(i));
+        xe.push_back(0.01 + 1e-5 * static_cast<double>(i));
+        yv.push_back(2.0 - 1e-3 * static_cast<double>(i));
+        ye.push_back(0.02);
+      }
+
+      fv.resize(numRows);
+      fe.resize(numRows);
+      gv.resize(numRows);
+      ge.resize(numRows);
+    }
+
+    /// Compares the output columns with the direct evaluation
+    void CheckResults() const
+    {
+      for(std::size_t i = 0; i < numRows; i++)
+      {
+        const VD a(xv[i], xe[i]), b(yv[i], ye[i]);
+        const VD ref = formula(a, b);
+        const VD ref2 = log(a) * b;
+        BOOST_REQUIRE_EQUAL(fv[i], ref.GetValue());
+        BOOST_REQUIRE_EQUAL(fe[i], ref.GetError());
+        BOOST_REQUIRE_EQUAL(gv[i], ref2.GetValue());
+        BOOST_REQUIRE_EQUAL(ge[i], ref2.GetError());
+      }
+    }
+
+    DeferredTape<double> tape;
+    const DD x, y, f, g;
+    std::vector<double> xv, xe, yv, ye, fv, fe, gv, ge;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_CompiledExpression,Fixture)
+
+BOOST_AUTO_TEST_CASE(compile)
+{
+  Expression expr({ x, y }, { f, g });
+  BOOST_CHECK_EQUAL(expr.NumInputs(), 2u);
+  BOOST_CHECK_EQUAL(expr.NumOutputs(), 2u);
+  BOOST_CHECK_EQUAL(expr.GetInstructions().size(), tape.size() - 2);
+
+  // slots of intermediate results are reused
+  BOOST_CHECK_LT(expr.NumSlots(), tape.size());
+  BOOST_CHECK_EQUAL(expr.GetTileSize() % 8, 0u);
+  BOOST_CHECK_LE(2 * sizeof(double) * expr.NumSlots() * expr.GetTileSize(), Expression::l1CacheSize);
+}
+
+BOOST_AUTO_TEST_CASE(unused_nodes_are_skipped)
+{
+  Expression expr({ x, y }, { g });
+  BOOST_CHECK_EQUAL(expr.GetInstructions().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(single_tuple)
+{
+  Expression expr({ x, y }, { f, y });
+
+  const VD a(0.7, 0.1), b(1.3, 0.2);
+  const std::vector<VD> result = expr.Evaluate({ a, b });
+  BOOST_REQUIRE_EQUAL(result.size(), 2u);
+  BOOST_CHECK_PVS(result[0], formula(a, b));
+  BOOST_CHECK_PVS(result[1], b);
+}
+
+BOOST_AUTO_TEST_CASE(columns)
+{
+  Expression expr({ x, y }, { f, g });
+  expr.Evaluate(numRows, { xv.data(), yv.data() }, { xe.data(), ye.data() }, { fv.data(), gv.data() }, { fe.data(), ge.data() });
+  CheckResults();
+}
+
+BOOST_AUTO_TEST_CASE(tile_sizes)
+{
+  Expression expr({ x, y }, { f, g });
+
+  for(std::size_t tileSize : { 1, 3, 8, 999, 4096 })
+  {
+    expr.SetTileSize(tileSize);
+    BOOST_CHECK_EQUAL(expr.GetTileSize(), tileSize);
+    std::fill(fv.begin(), fv.end(), 0.0);
+    expr.Evaluate(numRows, { xv.data(), yv.data() }, { xe.data(), ye.data() }, { fv.data(), gv.data() }, { fe.data(), ge.data() });
+    CheckResults();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool)
+{
+  Expression expr({ x, y }, { f, g });
+  expr.SetTileSize(16);
+
+  ThreadPool pool(3);
+  expr.Evaluate(numRows, { xv.data(), yv.data() }, { xe.data(), ye.data() }, { fv.data(), gv.data() }, { fe.data(), ge.data() }, pool);
+  CheckResults();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_CompiledExpression
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
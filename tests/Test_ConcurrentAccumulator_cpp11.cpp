@@ -0,0 +1,230 @@
+#include "ConcurrentAccumulator.hpp"
+#include "precompiled.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef SumAccumulator<double> AD;
+  typedef ConcurrentAccumulator<double> CD;
+
+  const std::size_t numThreads = 8;
+  const std::size_t termsPerThread = 20000;
+
+  /// Term i of thread t, values and variances are small integers, so all sums are exact
+  VD term(std::size_t t, std::size_t i)
+  {
+    return VD(static_cast<double>(t + i % 7), static_cast<double>(1 + i % 3));
+  }
+
+  /// Runs f(t) on numThreads threads
+  template<typename F>
+  void run_threads(F f)
+  {
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < numThreads; t++)
+    {
+      threads.push_back(std::thread(f, t));
+    }
+
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Test_ConcurrentAccumulator)
+
+BOOST_AUTO_TEST_CASE(size)
+{
+  // a slot per thread which has written, kept after the thread finished
+  CD sum;
+  BOOST_CHECK_EQUAL(sum.size(), 0u);
+
+  sum += VD(1.0, 1.0);
+  sum += VD(1.0, 1.0);
+  BOOST_CHECK_EQUAL(sum.size(), 1u);
+
+  run_threads([&](std::size_t)
+  {
+    sum += VD(1.0, 1.0);
+  });
+  BOOST_CHECK_EQUAL(sum.size(), 1u + numThreads);
+  BOOST_CHECK_EQUAL(sum.Result().GetValue(), static_cast<double>(2 + numThreads));
+}
+
+BOOST_AUTO_TEST_CASE(single_thread)
+{
+  CD sum;
+  BOOST_CHECK_EQUAL(sum.Result().GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(sum.Result().GetError(), 0.0);
+
+  AD reference;
+  for(std::size_t i = 0; i < 100; i++)
+  {
+    sum += term(1, i);
+    reference += term(1, i);
+  }
+
+  BOOST_CHECK_EQUAL(sum.Result().GetValue(), reference.Result().GetValue());
+  BOOST_CHECK_EQUAL(sum.Result().GetError(), reference.Result().GetError());
+
+  sum += reference;
+  BOOST_CHECK_EQUAL(sum.Snapshot().GetValue(), 2.0 * reference.GetValue());
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_writers)
+{
+  AD reference;
+  for(std::size_t t = 0; t < numThreads; t++)
+  {
+    for(std::size_t i = 0; i < termsPerThread; i++)
+    {
+      reference += term(t, i);
+    }
+  }
+
+  CD sum;
+  run_threads([&](std::size_t t)
+  {
+    for(std::size_t i = 0; i < termsPerThread; i++)
+    {
+      sum += term(t, i);
+    }
+  });
+
+  BOOST_CHECK_EQUAL(sum.size(), numThreads);
+  BOOST_CHECK_EQUAL(sum.Result().GetValue(), reference.Result().GetValue());
+  BOOST_CHECK_EQUAL(sum.Result().GetError(), reference.Result().GetError());
+
+  // thread local sums merged once
+  CD merged;
+  run_threads([&](std::size_t t)
+  {
+    AD local;
+    for(std::size_t i = 0; i < termsPerThread; i++)
+    {
+      local += term(t, i);
+    }
+    merged += local;
+  });
+
+  BOOST_CHECK_EQUAL(merged.Result().GetValue(), reference.Result().GetValue());
+  BOOST_CHECK_EQUAL(merged.Result().GetError(), reference.Result().GetError());
+}
+
+BOOST_AUTO_TEST_CASE(alternating_accumulators)
+{
+  // the cached slot of a thread belongs to the other accumulator on every term
+  AD reference;
+  for(std::size_t i = 0; i < termsPerThread; i++)
+  {
+    reference += term(0, i);
+  }
+
+  CD first, second;
+  run_threads([&](std::size_t)
+  {
+    for(std::size_t i = 0; i < termsPerThread; i++)
+    {
+      first += term(0, i);
+      second += term(1, i);
+    }
+  });
+
+  BOOST_CHECK_EQUAL(first.size(), numThreads);
+  BOOST_CHECK_EQUAL(second.size(), numThreads);
+  BOOST_CHECK_EQUAL(first.Result().GetValue(), static_cast<double>(numThreads) * reference.Result().GetValue());
+  BOOST_CHECK_EQUAL(second.Result().GetValue(),
+                    first.Result().GetValue() + static_cast<double>(numThreads * termsPerThread));
+}
+
+BOOST_AUTO_TEST_CASE(consistent_snapshots)
+{
+  // every term adds 1 to the value and to the variance, so both are equal in a consistent snapshot
+  CD sum;
+  std::atomic<std::size_t> finished(0);
+  std::size_t numSnapshots = 0, numInconsistent = 0, numDecreasing = 0;
+
+  // the Boost.Test assertions are not thread safe, the reader only counts
+  std::thread reader([&]
+  {
+    double last = 0.0;
+    while(finished < numThreads)
+    {
+      const VD snapshot = sum.Result();
+      if(std::abs(snapshot.GetValue() - snapshot.GetError() * snapshot.GetError()) > 1e-6)
+      {
+        numInconsistent++;
+      }
+      if(snapshot.GetValue() < last)
+      {
+        numDecreasing++;
+      }
+      last = snapshot.GetValue();
+      numSnapshots++;
+    }
+  });
+
+  run_threads([&](std::size_t)
+  {
+    for(std::size_t i = 0; i < termsPerThread; i++)
+    {
+      sum += VD(1.0, 1.0);
+    }
+    finished++;
+  });
+  reader.join();
+
+  BOOST_CHECK_GT(numSnapshots, 0u);
+  BOOST_CHECK_EQUAL(numInconsistent, 0u);
+  BOOST_CHECK_EQUAL(numDecreasing, 0u);
+  BOOST_CHECK_EQUAL(sum.Result().GetValue(), static_cast<double>(numThreads * termsPerThread));
+}
+
+BOOST_AUTO_TEST_CASE(reproducible)
+{
+  // with ReproducibleSummation the result is independent of the shards the terms ended up in
+  typedef ConcurrentAccumulator<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> ReproducibleCD;
+
+  SumAccumulator<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> reference;
+  for(std::size_t t = 0; t < numThreads; t++)
+  {
+    for(std::size_t i = 0; i < 1000; i++)
+    {
+      reference += ValueWithError<double>(0.1 * static_cast<double>(t) + 1e-3 * static_cast<double>(i), 0.01);
+    }
+  }
+
+  ReproducibleCD sum;
+  run_threads([&](std::size_t t)
+  {
+    for(std::size_t i = 0; i < 1000; i++)
+    {
+      sum += ValueWithError<double>(0.1 * static_cast<double>(t) + 1e-3 * static_cast<double>(i), 0.01);
+    }
+  });
+
+  BOOST_CHECK_EQUAL(sum.Result().GetValue(), reference.Result().GetValue());
+  BOOST_CHECK_EQUAL(sum.Result().GetError(), reference.Result().GetError());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_ConcurrentAccumulator
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
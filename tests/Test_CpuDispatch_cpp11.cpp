@@ -0,0 +1,150 @@
+#include "CpuDispatch.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef ValueWithError<float>  VF;
+
+  const double tolerance = 1e-12;
+
+  const InstructionSet levels[] = { InstructionSet::Generic, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 };
+
+  struct Unary
+  {
+    template<typename V>
+    V operator()(const V& a) const
+    {
+      return exp(a) + a * a - sqrt(a);
+    }
+  };
+
+  struct Binary
+  {
+    template<typename V>
+    V operator()(const V& a, const V& b) const
+    {
+      return a * b + a / b - hypot(a, b);
+    }
+  };
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      // not a multiple of any lane count
+      for(std::size_t i = 0; i < 37; i++)
+      {
+        a.push_back(VD(0.5 + 0.1 * static_cast<double>(i), 0.01 * static_cast<double>(i % 5)));
+        b.push_back(VD(2.0 - 0.03 * static_cast<double>(i), 0.02));
+      }
+    }
+
+    std::vector<VD> a, b;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_CpuDispatch,Fixture)
+
+BOOST_AUTO_TEST_CASE(selection)
+{
+  BOOST_CHECK(active_instruction_set() <= detected_instruction_set());
+
+  BOOST_CHECK(detail::select_instruction_set(nullptr, InstructionSet::AVX2) == InstructionSet::AVX2);
+  BOOST_CHECK(detail::select_instruction_set("sse2", InstructionSet::AVX512) == InstructionSet::SSE2);
+  BOOST_CHECK(detail::select_instruction_set("generic", InstructionSet::SSE2) == InstructionSet::Generic);
+
+  // unsupported and unknown requests are ignored
+  BOOST_CHECK(detail::select_instruction_set("avx512", InstructionSet::AVX2) == InstructionSet::AVX2);
+  BOOST_CHECK(detail::select_instruction_set("AVX2", InstructionSet::AVX512) == InstructionSet::AVX512);
+  BOOST_CHECK(detail::select_instruction_set("", InstructionSet::SSE2) == InstructionSet::SSE2);
+
+  for(std::size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+  {
+    InstructionSet parsed;
+    BOOST_CHECK(detail::parse_instruction_set(instruction_set_name(levels[i]), parsed));
+    BOOST_CHECK(parsed == levels[i]);
+  }
+  BOOST_CHECK_EQUAL(std::string(instruction_set_name(InstructionSet::AVX512)), "avx512");
+}
+
+BOOST_AUTO_TEST_CASE(lanes)
+{
+  BOOST_CHECK_EQUAL((detail::lanes_per_register<double, 16>::value), 2u);
+  BOOST_CHECK_EQUAL((detail::lanes_per_register<double, 64>::value), 8u);
+  BOOST_CHECK_EQUAL((detail::lanes_per_register<float, 32>::value), 8u);
+  BOOST_CHECK_EQUAL((detail::lanes_per_register<long double, 8>::value), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(all_levels)
+{
+  for(std::size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++)
+  {
+    BOOST_TEST_CHECKPOINT(instruction_set_name(levels[l]));
+
+    std::vector<VD> unary(a.size()), binary(a.size());
+    batch_transform(levels[l], a.data(), a.data() + a.size(), unary.data(), Unary());
+    batch_transform(levels[l], a.data(), a.data() + a.size(), b.data(), binary.data(), Binary());
+
+    for(std::size_t i = 0; i < a.size(); i++)
+    {
+      const VD u = Unary()(a[i]);
+      const VD r = Binary()(a[i], b[i]);
+      BOOST_CHECK_CLOSE(unary[i].GetValue(), u.GetValue(), tolerance);
+      BOOST_CHECK_CLOSE(unary[i].GetError(), u.GetError(), tolerance);
+      BOOST_CHECK_CLOSE(binary[i].GetValue(), r.GetValue(), tolerance);
+      BOOST_CHECK_CLOSE(binary[i].GetError(), r.GetError(), tolerance);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(in_place_and_active_level)
+{
+  std::vector<VD> x = a;
+  batch_transform(x.data(), x.data() + x.size(), b.data(), x.data(), Binary());
+
+  for(std::size_t i = 0; i < a.size(); i++)
+  {
+    BOOST_CHECK_CLOSE(x[i].GetError(), Binary()(a[i], b[i]).GetError(), tolerance);
+  }
+
+  std::vector<VF> f(21, VF(1.5f, 0.25f)), g(21);
+  batch_transform(f.data(), f.data() + f.size(), g.data(), Unary());
+  BOOST_CHECK_CLOSE(g[20].GetError(), Unary()(f[20]).GetError(), 1e-4);
+
+  // empty ranges
+  batch_transform(a.data(), a.data(), x.data(), Unary());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_CpuDispatch
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
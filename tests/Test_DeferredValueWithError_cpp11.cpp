@@ -0,0 +1,207 @@
+#include "DeferredValueWithError.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>         VD;
+  typedef DeferredValueWithError<double> DD;
+  typedef DeferredTape<double>           Tape;
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      pvd(0.5, 0.1),
+      pvd2(1.5, 0.2),
+      dd(tape.Input(pvd)),
+      dd2(tape.Input(pvd2))
+    {}
+
+    const VD pvd, pvd2;
+    Tape tape;
+    const DD dd, dd2;
+  };
+
+} // anonymous namespace
+
+/// Compares the deferred result of EXPR with the eager one, the expression uses x and y
+#define TEST_DEFERRED(NAME, EXPR)                         \
+BOOST_AUTO_TEST_CASE(NAME)                                \
+{                                                         \
+  const VD eager = [](const VD& x, const VD& y) { return EXPR; }(pvd, pvd2);              \
+  const VD deferred = [](const DD& x, const DD& y) { return EXPR; }(dd, dd2).ToValueWithError(); \
+  BOOST_CHECK_PVS(deferred, eager);                       \
+}
+
+BOOST_FIXTURE_TEST_SUITE(Test_DeferredValueWithError,Fixture)
+
+BOOST_AUTO_TEST_CASE(input)
+{
+  BOOST_CHECK_EQUAL(tape.size(), 2u);
+  BOOST_CHECK_EQUAL(dd.GetIndex(), 0u);
+  BOOST_CHECK_EQUAL(&dd.GetTape(), &tape);
+  BOOST_CHECK_PV(dd,0.5,0.1);
+
+  const DD neg = tape.Input(1.0, -2.0);
+  BOOST_CHECK_PV(neg,1.0,2.0);
+}
+
+BOOST_AUTO_TEST_CASE(values_are_eager)
+{
+  const DD result = exp(dd) * dd2 + 1.0;
+  BOOST_CHECK_EQUAL(result.GetValue(), std::exp(0.5) * 1.5 + 1.0);
+  BOOST_CHECK_EQUAL(tape.size(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(clear_keeps_capacity)
+{
+  for(int i = 0; i < 100; i++)
+  {
+    tape.Input(pvd);
+  }
+
+  const std::size_t capacity = tape.capacity();
+  tape.Clear();
+  BOOST_CHECK_EQUAL(tape.size(), 0u);
+  BOOST_CHECK_EQUAL(tape.capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(memoization)
+{
+  const DD a = sin(dd) * dd2;
+  const DD b = a * a + a;
+
+  const double error = b.GetError();
+  BOOST_CHECK_EQUAL(error, b.GetError());
+  BOOST_CHECK_EQUAL(a.GetError(), (sin(pvd) * pvd2).GetError());
+}
+
+BOOST_AUTO_TEST_CASE(error_outlives_tape_growth)
+{
+  // materializing the errors of later nodes reallocates the errors of the tape
+  const DD a = sin(dd) * dd2;
+  const double& error = a.GetError();
+
+  DD b(a);
+  for(int i = 0; i < 1000; i++)
+  {
+    b = b * 1.0001;
+  }
+  b.GetError();
+
+  BOOST_CHECK_EQUAL(error, (sin(pvd) * pvd2).GetError());
+}
+
+BOOST_AUTO_TEST_CASE(combination_policy)
+{
+  // the replayed operations of ValueWithError combine the errors according to P
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, LinearCombinationPolicy> Linear;
+  DeferredTape<double, Linear> linearTape;
+  const DeferredValueWithError<double, Linear> a = linearTape.Input(1.0, 0.3), b = linearTape.Input(2.0, 0.4);
+
+  BOOST_CHECK_CLOSE((a + b).GetError(), 0.7, 1e-12);
+  BOOST_CHECK_CLOSE((dd + dd2).GetError(), (pvd + pvd2).GetError(), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(long_chain)
+{
+  VD eager(pvd);
+  DD deferred(dd);
+
+  for(int i = 0; i < 100000; i++)
+  {
+    eager = eager * 1.00001 + 1e-6;
+    deferred = deferred * 1.00001 + 1e-6;
+  }
+
+  BOOST_CHECK_PVS(deferred.ToValueWithError(), eager);
+}
+
+BOOST_AUTO_TEST_CASE(compound_assignment)
+{
+  VD eager(pvd);
+  eager *= pvd2;
+  eager += 2.0;
+
+  DD deferred(dd);
+  deferred *= dd2;
+  deferred += 2.0;
+
+  BOOST_CHECK_PVS(deferred.ToValueWithError(), eager);
+}
+
+TEST_DEFERRED(times, x * y)
+TEST_DEFERRED(times_scalar, x * 2.0 * y * 3)
+TEST_DEFERRED(div, x / y)
+TEST_DEFERRED(div_scalar, 2.0 / x / y / 3.0)
+TEST_DEFERRED(plus, x + y)
+TEST_DEFERRED(plus_scalar, x + 2.0 + (3 + y))
+TEST_DEFERRED(minus, x - y)
+TEST_DEFERRED(minus_scalar, 2.0 - x - y - 1.0)
+TEST_DEFERRED(mixed_expression, exp(x * y) / (1.0 + sqrt(y)) - log(y) * x)
+
+TEST_DEFERRED(_abs, abs(x))
+TEST_DEFERRED(_acos, acos(x))
+TEST_DEFERRED(_asin, asin(x))
+TEST_DEFERRED(_asinh, asinh(x))
+TEST_DEFERRED(_atan, atan(x))
+TEST_DEFERRED(_atanh, atanh(x))
+TEST_DEFERRED(_cbrt, cbrt(x))
+TEST_DEFERRED(_cos, cos(x))
+TEST_DEFERRED(_cosh, cosh(x))
+TEST_DEFERRED(_erf, erf(x))
+TEST_DEFERRED(_erfc, erfc(x))
+TEST_DEFERRED(_exp, exp(x))
+TEST_DEFERRED(_exp2, exp2(x))
+TEST_DEFERRED(_expm1, expm1(x))
+TEST_DEFERRED(_fabs, fabs(x))
+TEST_DEFERRED(_lgamma, lgamma(x))
+TEST_DEFERRED(_log, log(x))
+TEST_DEFERRED(_log10, log10(x))
+TEST_DEFERRED(_log1p, log1p(x))
+TEST_DEFERRED(_log2, log2(x))
+TEST_DEFERRED(_sin, sin(x))
+TEST_DEFERRED(_sinh, sinh(x))
+TEST_DEFERRED(_sqrt, sqrt(x))
+TEST_DEFERRED(_tan, tan(x))
+TEST_DEFERRED(_tanh, tanh(x))
+TEST_DEFERRED(_tgamma, tgamma(x))
+TEST_DEFERRED(_acosh, acosh(y))
+TEST_DEFERRED(_atan2, atan2(x, y))
+TEST_DEFERRED(_atan2_scalar_lhs, atan2(2.0, y))
+TEST_DEFERRED(_atan2_scalar_rhs, atan2(x, 2.0))
+TEST_DEFERRED(_hypot, hypot(x, y))
+TEST_DEFERRED(_hypot_scalar_lhs, hypot(2.0, y))
+TEST_DEFERRED(_hypot_scalar_rhs, hypot(x, 2.0))
+TEST_DEFERRED(_pow, pow(x, y))
+TEST_DEFERRED(_pow_scalar_lhs, pow(2.0, y))
+TEST_DEFERRED(_pow_scalar_rhs, pow(x, 2.0))
+
+BOOST_AUTO_TEST_SUITE_END() // Test_DeferredValueWithError
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,326 @@
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif // __GNUC__
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <boost/multiprecision/cpp_dec_float.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, FastDerivativePolicy> FastPolicy;
+
+  typedef ValueWithError<double>                   VD;
+  typedef ValueWithError<double, FastPolicy>       VFD;
+  typedef ValueWithError<long double>              VLD;
+  typedef ValueWithError<long double, FastPolicy>  VFLD;
+
+  typedef boost::multiprecision::cpp_dec_float_50 MPF;
+
+  typedef MemoizedDerivativePolicy<>                       Memoized;
+  typedef MemoizedDerivativePolicy<ExactDerivativePolicy, 1> SingleSlot;
+  typedef MemoizedDerivativePolicy<FastDerivativePolicy>   MemoizedFast;
+
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, Memoized>     MemoizedPolicy;
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, SingleSlot>   SingleSlotPolicy;
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, QuadratureCombinationPolicy, MemoizedFast> MemoizedFastPolicy;
+
+  typedef ValueWithError<MPF>                      VMPF;
+  typedef ValueWithError<MPF, MemoizedPolicy>      VMMPF;
+  typedef ValueWithError<double, MemoizedPolicy>   VMD;
+
+  /// Largest relative error of f against g on n points evenly spaced in [a, b]
+  template<typename F, typename G>
+  double max_relative_error(F f, G g, double a, double b, int n = 20001)
+  {
+    double result = 0.0;
+    for(int i = 0; i < n; i++)
+    {
+      const double x = a + (b - a) * i / (n - 1);
+      result = std::max(result, std::abs(f(x) / g(x) - 1.0));
+    }
+    return result;
+  }
+
+  /// Largest absolute error, relative where |g(x)| > 1
+  template<typename F, typename G>
+  double max_error(F f, G g, double a, double b, int n = 20001)
+  {
+    double result = 0.0;
+    for(int i = 0; i < n; i++)
+    {
+      const double x = a + (b - a) * i / (n - 1);
+      result = std::max(result, std::abs(f(x) - g(x)) / std::max(1.0, std::abs(g(x))));
+    }
+    return result;
+  }
+
+  struct DerivativePolicyFixture{ };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_DerivativePolicy,DerivativePolicyFixture)
+
+BOOST_AUTO_TEST_CASE(policy_selection)
+{
+  BOOST_CHECK((boost::is_same<detail::derivative_policy<ExactValueAndIgnoreErrorPolicy>::type, ExactDerivativePolicy>::value));
+  BOOST_CHECK((boost::is_same<detail::derivative_policy<CombinedPolicy<CompareWithinErrorIntervalsPolicy, LinearCombinationPolicy> >::type, ExactDerivativePolicy>::value));
+  BOOST_CHECK((boost::is_same<detail::derivative_policy<FastPolicy>::type, FastDerivativePolicy>::value));
+  BOOST_CHECK((boost::is_same<detail::combination_policy<FastPolicy>::type, QuadratureCombinationPolicy>::value));
+}
+
+BOOST_AUTO_TEST_CASE(bounds)
+{
+  const auto stdExp = [](double x) { return std::exp(x); };
+  BOOST_CHECK_LT(max_relative_error(detail::fast_exp, stdExp, -707.9, 708.9), 2e-8);
+  BOOST_CHECK_LT(max_relative_error(detail::fast_exp, stdExp, -1.0, 1.0), 2e-8);
+
+  const auto stdLog = [](double x) { return std::log(x); };
+  const auto fastLogExp = [](double x) { return detail::fast_log(std::exp(x)); };
+  const auto identity = [](double x) { return x; };
+  BOOST_CHECK_LT(max_relative_error(detail::fast_log, stdLog, 1.0001, 100.0), 5e-9);
+  BOOST_CHECK_LT(max_relative_error(detail::fast_log, stdLog, 1e-3, 0.9999), 5e-9);
+  BOOST_CHECK_LT(max_relative_error(fastLogExp, identity, -700.0, 700.0), 5e-9);
+
+  const auto stdSin = [](double x) { return std::sin(x); };
+  const auto stdCos = [](double x) { return std::cos(x); };
+  BOOST_CHECK_LT(max_error(detail::fast_sin, stdSin, -10.0, 10.0), 5e-9);
+  BOOST_CHECK_LT(max_error(detail::fast_cos, stdCos, -10.0, 10.0), 5e-9);
+  BOOST_CHECK_LT(max_error(detail::fast_sin, stdSin, -99999.0, 99999.0, 200001), 5e-9);
+  BOOST_CHECK_LT(max_error(detail::fast_cos, stdCos, -99999.0, 99999.0, 200001), 5e-9);
+
+  const auto stdSinh = [](double x) { return std::sinh(x); };
+  const auto stdCosh = [](double x) { return std::cosh(x); };
+  BOOST_CHECK_LT(max_relative_error(detail::fast_sinh, stdSinh, -700.0, 700.0, 20000), 5e-8);
+  BOOST_CHECK_LT(max_relative_error(detail::fast_sinh, stdSinh, -1.0, 1.0, 20000), 5e-8);
+  BOOST_CHECK_LT(max_relative_error(detail::fast_cosh, stdCosh, -700.0, 700.0), 2e-8);
+
+  const auto stdCbrt = [](double x) { return std::cbrt(x); };
+  const auto fastCbrtExp = [](double x) { return detail::fast_cbrt(std::exp(x)) / std::cbrt(std::exp(x)); };
+  const auto one = [](double) { return 1.0; };
+  BOOST_CHECK_LT(max_relative_error(detail::fast_cbrt, stdCbrt, -10.0, 10.0, 20000), 2e-6);
+  BOOST_CHECK_LT(max_relative_error(fastCbrtExp, one, -700.0, 700.0), 2e-6);
+
+  const auto fastPow = [](double y) { return detail::fast_pow(2.5, y); };
+  const auto stdPow = [](double y) { return std::pow(2.5, y); };
+  BOOST_CHECK_LT(max_relative_error(fastPow, stdPow, -10.0, 10.0), 2e-8 + 5e-9 * 10.0 * std::log(2.5));
+  BOOST_CHECK_LT(max_relative_error(fastPow, stdPow, -700.0, 700.0), 2e-8 + 5e-9 * 700.0 * std::log(2.5));
+
+  const auto digamma = [](double x) { return detail::digamma(x); };
+  BOOST_CHECK_LT(max_error(detail::fast_digamma, digamma, 1e-3, 20.0), 1e-8);
+  BOOST_CHECK_LT(max_error(detail::fast_digamma, digamma, 20.0, 1e6), 1e-8);
+
+  const auto stdTgamma = [](double x) { return std::tgamma(x); };
+  BOOST_CHECK_LT(max_relative_error(detail::fast_tgamma, stdTgamma, 1e-3, 10.0), 2e-7);
+  BOOST_CHECK_LT(max_relative_error(detail::fast_tgamma, stdTgamma, 10.0, 170.9), 3e-6);
+}
+
+BOOST_AUTO_TEST_CASE(full_precision_outside_of_range)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  BOOST_CHECK_EQUAL(detail::fast_exp(-inf), 0.0);
+  BOOST_CHECK_EQUAL(detail::fast_exp(-800.0), 0.0);
+  BOOST_CHECK_EQUAL(detail::fast_exp(800.0), inf);
+  BOOST_CHECK_EQUAL(detail::fast_exp(709.0), std::exp(709.0));
+  BOOST_CHECK(std::isnan(detail::fast_exp(std::numeric_limits<double>::quiet_NaN())));
+
+  BOOST_CHECK_EQUAL(detail::fast_log(0.0), -inf);
+  BOOST_CHECK_EQUAL(detail::fast_log(1e-310), std::log(1e-310));
+  BOOST_CHECK(std::isnan(detail::fast_log(-1.0)));
+
+  BOOST_CHECK_EQUAL(detail::fast_sin(1e6), std::sin(1e6));
+  BOOST_CHECK_EQUAL(detail::fast_cos(-1e6), std::cos(-1e6));
+  BOOST_CHECK_EQUAL(detail::fast_cbrt(0.0), 0.0);
+  BOOST_CHECK_EQUAL(detail::fast_pow(-2.0, 3.0), -8.0);
+  BOOST_CHECK_EQUAL(detail::fast_digamma(-0.5), detail::digamma(-0.5));
+  BOOST_CHECK_EQUAL(detail::fast_tgamma(-0.5), std::tgamma(-0.5));
+  BOOST_CHECK_EQUAL(detail::fast_tgamma(171.5), std::tgamma(171.5));
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  // the value is unchanged, the error agrees to the bound of the derivative factor
+  const double tolerance = 1e-4; // percent, i.e. 1e-6
+
+  const double values[] = { -2.5, -0.3, 0.7, 1.5, 4.0 };
+  for(std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+  {
+    const VD x(values[i], 0.01);
+    const VFD f(values[i], 0.01);
+
+#define CHECK_DERIVATIVE(function)                                                          \
+    BOOST_CHECK_EQUAL(function(f).GetValue(), function(x).GetValue());                      \
+    BOOST_CHECK_CLOSE(function(f).GetError(), function(x).GetError(), tolerance);
+
+    CHECK_DERIVATIVE(cbrt)
+    CHECK_DERIVATIVE(cos)
+    CHECK_DERIVATIVE(cosh)
+    CHECK_DERIVATIVE(erf)
+    CHECK_DERIVATIVE(erfc)
+    CHECK_DERIVATIVE(exp)
+    CHECK_DERIVATIVE(exp2)
+    CHECK_DERIVATIVE(expm1)
+    CHECK_DERIVATIVE(lgamma)
+    CHECK_DERIVATIVE(sin)
+    CHECK_DERIVATIVE(sinh)
+    CHECK_DERIVATIVE(tan)
+    CHECK_DERIVATIVE(tanh)
+    CHECK_DERIVATIVE(tgamma)
+#undef CHECK_DERIVATIVE
+
+    const VD y(1.3, 0.02);
+    const VFD g(1.3, 0.02);
+    BOOST_CHECK_CLOSE(pow(abs(f), g).GetError(), pow(abs(x), y).GetError(), tolerance);
+    BOOST_CHECK_CLOSE(pow(abs(f), 1.3).GetError(), pow(abs(x), 1.3).GetError(), tolerance);
+    BOOST_CHECK_CLOSE(pow(2.0, f).GetError(), pow(2.0, x).GetError(), tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(full_precision_for_other_types)
+{
+  const VLD x(0.7L, 0.01L);
+  const VFLD f(0.7L, 0.01L);
+
+  BOOST_CHECK_EQUAL(erf(f).GetError(), erf(x).GetError());
+  BOOST_CHECK_EQUAL(lgamma(f).GetError(), lgamma(x).GetError());
+  BOOST_CHECK_EQUAL(sin(f).GetError(), sin(x).GetError());
+  BOOST_CHECK_EQUAL(pow(2, f).GetError(), pow(2, x).GetError());
+}
+
+BOOST_AUTO_TEST_CASE(memoization)
+{
+  Memoized::Clear<MPF>();
+
+  const MPF values[] = { MPF("0.25"), MPF("1.5"), MPF("3.75") };
+  for(int repetition = 0; repetition < 4; repetition++)
+  {
+    for(std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+      const VMPF x(values[i], MPF("0.01"));
+      const VMMPF m(values[i], MPF("0.01"));
+
+      BOOST_CHECK_EQUAL(erf(m).GetValue(), erf(x).GetValue());
+      BOOST_CHECK_EQUAL(erf(m).GetError(), erf(x).GetError());
+      BOOST_CHECK_EQUAL(erfc(m).GetError(), erfc(x).GetError());
+      BOOST_CHECK_EQUAL(lgamma(m).GetValue(), lgamma(x).GetValue());
+      BOOST_CHECK_EQUAL(lgamma(m).GetError(), lgamma(x).GetError());
+      BOOST_CHECK_EQUAL(tgamma(m).GetValue(), tgamma(x).GetValue());
+      BOOST_CHECK_EQUAL(tgamma(m).GetError(), tgamma(x).GetError());
+    }
+  }
+
+  // 3 arguments of 4 functions, each overload called 2 times (erfc once) per repetition
+  const MemoizationStatistics statistics = Memoized::Statistics<MPF>();
+  BOOST_CHECK_EQUAL(statistics.GetMisses(), 12u);
+  BOOST_CHECK_EQUAL(statistics.GetHits(), 4u * 3u * 7u - 12u);
+  BOOST_CHECK_CLOSE(statistics.GetHitRate(), 72.0 / 84.0, 1e-12);
+
+  // the error scales with the error of the argument, also from the cache
+  BOOST_CHECK_EQUAL(tgamma(VMMPF(values[1], MPF("0.5"))).GetError(), tgamma(VMPF(values[1], MPF("0.5"))).GetError());
+
+  Memoized::Clear<MPF>();
+  BOOST_CHECK_EQUAL(Memoized::Statistics<MPF>().GetHits(), 0u);
+  BOOST_CHECK_EQUAL(Memoized::Statistics<MPF>().GetHitRate(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(memoization_keys)
+{
+  // caches and statistics are separate per type, +0.0 and -0.0 are different arguments
+  Memoized::Clear<double>();
+  BOOST_CHECK_EQUAL(lgamma(VMD(0.0, 1.0)).GetValue(), lgamma(VD(0.0, 1.0)).GetValue());
+  lgamma(VMD(-0.0, 1.0));
+  lgamma(VMD(-0.0, 1.0));
+  BOOST_CHECK_EQUAL(Memoized::Statistics<double>().GetMisses(), 2u);
+  BOOST_CHECK_EQUAL(Memoized::Statistics<double>().GetHits(), 1u);
+
+  // NaN is never found
+  lgamma(VMD(std::numeric_limits<double>::quiet_NaN(), 1.0));
+  lgamma(VMD(std::numeric_limits<double>::quiet_NaN(), 1.0));
+  BOOST_CHECK_EQUAL(Memoized::Statistics<double>().GetMisses(), 4u);
+
+  // a single slot is replaced by each new argument
+  typedef ValueWithError<double, SingleSlotPolicy> VS;
+  SingleSlot::Clear<double>();
+  for(int i = 0; i < 3; i++)
+  {
+    BOOST_CHECK_EQUAL(tgamma(VS(1.5, 0.1)).GetError(), tgamma(VD(1.5, 0.1)).GetError());
+    BOOST_CHECK_EQUAL(tgamma(VS(2.5, 0.1)).GetError(), tgamma(VD(2.5, 0.1)).GetError());
+  }
+  BOOST_CHECK_EQUAL(SingleSlot::Statistics<double>().GetHits(), 0u);
+
+  // memoizes the derivative of the base policy
+  typedef ValueWithError<double, MemoizedFastPolicy> VMF;
+  BOOST_CHECK_EQUAL(erf(VMF(0.5, 0.1)).GetError(), erf(VFD(0.5, 0.1)).GetError());
+  BOOST_CHECK_EQUAL(erf(VMF(0.5, 0.1)).GetError(), erf(VFD(0.5, 0.1)).GetError());
+  BOOST_CHECK_EQUAL(MemoizedFast::Statistics<double>().GetHits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(memoization_threads)
+{
+  Memoized::Clear<double>();
+
+  std::vector<double> reference;
+  for(int k = 0; k < 8; k++)
+  {
+    reference.push_back(tgamma(VD(0.5 + k, 0.1)).GetError());
+  }
+
+  std::vector<int> mismatches(4, 0);
+  std::vector<std::thread> threads;
+  for(std::size_t t = 0; t < mismatches.size(); t++)
+  {
+    threads.emplace_back([&mismatches, &reference, t]
+    {
+      for(int i = 0; i < 2000; i++)
+      {
+        const int k = (i + static_cast<int>(t)) % 8;
+        if(tgamma(VMD(0.5 + k, 0.1)).GetError() != reference[k])
+        {
+          mismatches[t]++;
+        }
+      }
+    });
+  }
+
+  for(std::size_t t = 0; t < threads.size(); t++)
+  {
+    threads[t].join();
+    BOOST_CHECK_EQUAL(mismatches[t], 0);
+  }
+
+  const MemoizationStatistics statistics = Memoized::Statistics<double>();
+  BOOST_CHECK_EQUAL(statistics.GetHits() + statistics.GetMisses(), 8000u);
+  BOOST_CHECK_GT(statistics.GetHitRate(), 0.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_DerivativePolicy
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif // __GNUC__
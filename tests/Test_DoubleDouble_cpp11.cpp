@@ -0,0 +1,315 @@
+#include "DoubleDouble.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef DoubleDouble                             DD;
+  typedef boost::multiprecision::cpp_dec_float_50  MPF;
+  typedef ValueWithError<DD>                       VDD;
+
+  MPF to_mpf(const DD& a)
+  {
+    return MPF(a.GetHigh()) + MPF(a.GetLow());
+  }
+
+  /// Relative difference to the reference, which is computed from the same double-double input
+  double relative_difference(const DD& result, const MPF& reference)
+  {
+    if(reference == 0)
+    {
+      return std::abs(result.GetHigh());
+    }
+
+    return static_cast<double>(boost::multiprecision::abs((to_mpf(result) - reference) / reference));
+  }
+
+  const double tolerance = 1e-29;
+
+#define CHECK_FUNC_ONE_ARG(func, arg)                                   \
+  {                                                                     \
+    const DD x = (arg);                                                 \
+    BOOST_CHECK_LT(relative_difference(func(x), func(to_mpf(x))), tolerance); \
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      third(DD(1.0) / 3.0),
+      seventh(DD(22.0) / 7.0)
+    {}
+
+    const DD third, seventh;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_DoubleDouble,Fixture)
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+  const DD a(2.5);
+  BOOST_CHECK_EQUAL(a.GetHigh(), 2.5);
+  BOOST_CHECK_EQUAL(a.GetLow(), 0.0);
+
+  // not representable as double
+  const long long big = (1LL << 60) + 1;
+  const DD b(big);
+  BOOST_CHECK_EQUAL(static_cast<long long>(b.GetHigh()) + static_cast<long long>(b.GetLow()), big);
+  BOOST_CHECK_EQUAL(static_cast<double>(b), std::ldexp(1.0, 60));
+}
+
+BOOST_AUTO_TEST_CASE(error_free_transformations)
+{
+  double s, e;
+  detail::two_sum(1.0, 1e-20, s, e);
+  BOOST_CHECK_EQUAL(s, 1.0);
+  BOOST_CHECK_EQUAL(e, 1e-20);
+
+  const double a = 1.0 + std::ldexp(1.0, -30);
+  detail::two_prod(a, a, s, e);
+  BOOST_CHECK_EQUAL(s, 1.0 + std::ldexp(1.0, -29));
+  BOOST_CHECK_EQUAL(e, std::ldexp(1.0, -60));
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+  const MPF t = to_mpf(third), s = to_mpf(seventh);
+
+  BOOST_CHECK_LT(relative_difference(third + seventh, t + s), tolerance);
+  BOOST_CHECK_LT(relative_difference(third - seventh, t - s), tolerance);
+  BOOST_CHECK_LT(relative_difference(third * seventh, t * s), tolerance);
+  BOOST_CHECK_LT(relative_difference(third / seventh, t / s), tolerance);
+
+  BOOST_CHECK_LT(relative_difference(third + 2.0, t + 2), tolerance);
+  BOOST_CHECK_LT(relative_difference(2.0 - third, 2 - t), tolerance);
+  BOOST_CHECK_LT(relative_difference(third * 3.0, t * 3), tolerance);
+  BOOST_CHECK_LT(relative_difference(third / 3.0, t / 3), tolerance);
+  BOOST_CHECK_LT(relative_difference(3.0 / seventh, 3 / s), tolerance);
+
+  BOOST_CHECK_EQUAL(-(-third), third);
+  BOOST_CHECK_EQUAL(+third, third);
+}
+
+BOOST_AUTO_TEST_CASE(no_cancellation)
+{
+  // lost completely in double arithmetic
+  DD sum = 1e16;
+  for(int i = 0; i < 1000; i++)
+  {
+    sum += 0.1;
+  }
+  sum -= 1e16;
+
+  BOOST_CHECK_CLOSE(sum.GetHigh(), 100.0, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(comparison)
+{
+  const DD a(1.0, 1e-20);
+  const DD b(1.0);
+
+  BOOST_CHECK(b < a);
+  BOOST_CHECK(b <= a);
+  BOOST_CHECK(a > b);
+  BOOST_CHECK(a >= b);
+  BOOST_CHECK(a != b);
+  BOOST_CHECK(a == a);
+  BOOST_CHECK(!(a < a));
+}
+
+BOOST_AUTO_TEST_CASE(rounding)
+{
+  BOOST_CHECK_EQUAL(floor(DD(2.5)), DD(2.0));
+  BOOST_CHECK_EQUAL(floor(DD(3.0, -1e-20)), DD(2.0));
+  BOOST_CHECK_EQUAL(ceil(DD(3.0, 1e-20)), DD(4.0));
+  BOOST_CHECK_EQUAL(ceil(DD(-2.5)), DD(-2.0));
+  BOOST_CHECK_EQUAL(abs(DD(-1.0, 1e-20)), DD(1.0, -1e-20));
+  BOOST_CHECK_EQUAL(ldexp(DD(1.5, 1e-20), 2), DD(6.0, 4e-20));
+
+  int exponent;
+  const DD mantissa = frexp(DD(6.0, 4e-20), &exponent);
+  BOOST_CHECK_EQUAL(exponent, 3);
+  BOOST_CHECK_EQUAL(mantissa, DD(0.75, 5e-21));
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  CHECK_FUNC_ONE_ARG(sqrt, seventh);
+  CHECK_FUNC_ONE_ARG(sqrt, third * 1e-100);
+  CHECK_FUNC_ONE_ARG(cbrt, seventh);
+  CHECK_FUNC_ONE_ARG(cbrt, -third);
+  CHECK_FUNC_ONE_ARG(exp, seventh);
+  CHECK_FUNC_ONE_ARG(exp, -100.0 * seventh);
+  CHECK_FUNC_ONE_ARG(exp, third * 1e-10);
+  CHECK_FUNC_ONE_ARG(expm1, third * 1e-10);
+  CHECK_FUNC_ONE_ARG(expm1, -third);
+  CHECK_FUNC_ONE_ARG(expm1, seventh);
+  CHECK_FUNC_ONE_ARG(log, seventh);
+  CHECK_FUNC_ONE_ARG(log, third * 1e-100);
+  CHECK_FUNC_ONE_ARG(log1p, third * 1e-10);
+  CHECK_FUNC_ONE_ARG(log1p, seventh);
+  CHECK_FUNC_ONE_ARG(log10, seventh);
+  CHECK_FUNC_ONE_ARG(sin, third);
+  CHECK_FUNC_ONE_ARG(sin, 100.0 * seventh);
+  CHECK_FUNC_ONE_ARG(sin, -seventh);
+  CHECK_FUNC_ONE_ARG(cos, third);
+  CHECK_FUNC_ONE_ARG(cos, 100.0 * seventh);
+  CHECK_FUNC_ONE_ARG(cos, -2.0 * seventh);
+  CHECK_FUNC_ONE_ARG(tan, third);
+  CHECK_FUNC_ONE_ARG(tan, seventh);
+  CHECK_FUNC_ONE_ARG(asin, third);
+  CHECK_FUNC_ONE_ARG(asin, -0.9 * third);
+  CHECK_FUNC_ONE_ARG(acos, third);
+  CHECK_FUNC_ONE_ARG(acos, -third);
+  CHECK_FUNC_ONE_ARG(atan, third);
+  CHECK_FUNC_ONE_ARG(atan, -100.0 * seventh);
+  CHECK_FUNC_ONE_ARG(sinh, third * 1e-10);
+  CHECK_FUNC_ONE_ARG(sinh, -third);
+  CHECK_FUNC_ONE_ARG(sinh, seventh);
+  CHECK_FUNC_ONE_ARG(cosh, third);
+  CHECK_FUNC_ONE_ARG(cosh, -seventh);
+  CHECK_FUNC_ONE_ARG(tanh, third * 1e-10);
+  CHECK_FUNC_ONE_ARG(tanh, -seventh);
+  CHECK_FUNC_ONE_ARG(asinh, third);
+  CHECK_FUNC_ONE_ARG(asinh, -100.0 * seventh);
+  CHECK_FUNC_ONE_ARG(acosh, seventh);
+  CHECK_FUNC_ONE_ARG(atanh, third);
+  CHECK_FUNC_ONE_ARG(atanh, -third * 1e-10);
+
+  BOOST_CHECK_LT(relative_difference(atan2(-third, -seventh), atan2(to_mpf(-third), to_mpf(-seventh))), tolerance);
+  BOOST_CHECK_LT(relative_difference(pow(seventh, third), pow(to_mpf(seventh), to_mpf(third))), tolerance);
+  BOOST_CHECK_LT(relative_difference(pow(-seventh, DD(-5.0)), pow(to_mpf(-seventh), -5)), tolerance);
+  BOOST_CHECK_LT(relative_difference(hypot(third, seventh), sqrt(to_mpf(third) * to_mpf(third) + to_mpf(seventh) * to_mpf(seventh))), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(exp_range)
+{
+  // full precision up to log(DBL_MAX)
+  CHECK_FUNC_ONE_ARG(exp, DD(709.0));
+  CHECK_FUNC_ONE_ARG(exp, DD(709.5));
+  CHECK_FUNC_ONE_ARG(exp, DD(709.78));
+  BOOST_CHECK_CLOSE(exp(DD(709.0)).GetHigh(), 8.218407461554972e307, 1e-13);
+  BOOST_CHECK_CLOSE(exp(DD(709.5)).GetHigh(), std::exp(709.5), 1e-13);
+  BOOST_CHECK(std::isinf(exp(DD(709.79)).GetHigh()));
+
+  // subnormal results with the precision of double
+  BOOST_CHECK_CLOSE(exp(DD(-709.5)).GetHigh(), std::exp(-709.5), 1e-12);
+  BOOST_CHECK_CLOSE(exp(DD(-740.0)).GetHigh(), std::exp(-740.0), 1e-6);
+  BOOST_CHECK_EQUAL(exp(DD(-745.0)).GetHigh(), std::exp(-745.0));
+  BOOST_CHECK_EQUAL(exp(DD(-746.0)).GetHigh(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(double_accuracy_functions)
+{
+  BOOST_CHECK_CLOSE(erf(seventh).GetHigh(), std::erf(seventh.GetHigh()), 1e-13);
+  BOOST_CHECK_CLOSE(erfc(seventh).GetHigh(), std::erfc(seventh.GetHigh()), 1e-13);
+  BOOST_CHECK_CLOSE(lgamma(seventh).GetHigh(), std::lgamma(seventh.GetHigh()), 1e-13);
+  BOOST_CHECK_CLOSE(tgamma(seventh).GetHigh(), std::tgamma(seventh.GetHigh()), 1e-13);
+}
+
+BOOST_AUTO_TEST_CASE(numeric_limits)
+{
+  typedef std::numeric_limits<DD> limits;
+
+  BOOST_CHECK(limits::is_specialized);
+  BOOST_CHECK(limits::digits == 106);
+  BOOST_CHECK_EQUAL(DD(1.0) + limits::epsilon() > DD(1.0), true);
+  BOOST_CHECK(std::isinf(limits::infinity().GetHigh()));
+  BOOST_CHECK(std::isnan(limits::quiet_NaN().GetHigh()));
+  BOOST_CHECK_EQUAL(limits::lowest(), -limits::max());
+}
+
+BOOST_AUTO_TEST_CASE(stream_roundtrip)
+{
+  std::stringstream sstr;
+  sstr.precision(std::numeric_limits<DD>::max_digits10);
+  sstr << seventh;
+
+  BOOST_CHECK_EQUAL(sstr.str().substr(0, 20), "3.142857142857142857");
+
+  DD read;
+  sstr >> read;
+  BOOST_REQUIRE(!sstr.fail());
+  BOOST_CHECK_LT(relative_difference(read, to_mpf(seventh)), tolerance);
+
+  std::stringstream plain;
+  plain << DD(2.5);
+  BOOST_CHECK_EQUAL(plain.str(), "2.5");
+
+  std::istringstream invalid("1.2.3");
+  invalid >> read;
+  BOOST_CHECK(invalid.fail());
+}
+
+BOOST_AUTO_TEST_CASE(value_with_error)
+{
+  const VDD a(seventh, 0.1);
+  const VDD b(third, 0.2);
+
+  const VDD sum = a + b;
+  BOOST_CHECK_EQUAL(sum.GetValue(), seventh + third);
+  BOOST_CHECK_LT(relative_difference(sum.GetError(), sqrt(MPF(0.1) * MPF(0.1) + MPF(0.2) * MPF(0.2))), tolerance);
+
+  const VDD product = a * b;
+  BOOST_CHECK_EQUAL(product.GetValue(), seventh * third);
+
+  const VDD mixed = 2.0 * a - 1.0;
+  BOOST_CHECK_EQUAL(mixed.GetValue(), 2.0 * seventh - 1.0);
+  BOOST_CHECK_EQUAL(mixed.GetError(), DD(0.2));
+
+  const VDD e = exp(b);
+  BOOST_CHECK_EQUAL(e.GetValue(), exp(third));
+  BOOST_CHECK_EQUAL(e.GetError(), exp(third) * 0.2);
+
+  const VDD s = sin(a);
+  BOOST_CHECK_EQUAL(s.GetValue(), sin(seventh));
+  BOOST_CHECK_EQUAL(s.GetError(), abs(cos(seventh) * 0.1));
+
+  const VDD l = log(a);
+  BOOST_CHECK_EQUAL(l.GetValue(), log(seventh));
+
+  const VDD h = hypot(a, b);
+  BOOST_CHECK_EQUAL(h.GetValue(), hypot(seventh, third));
+
+  const VDD p = pow(a, b);
+  BOOST_CHECK_EQUAL(p.GetValue(), pow(seventh, third));
+
+  BOOST_CHECK(sqrt(a).GetError() > DD());
+  BOOST_CHECK(atan2(a, b).GetError() > DD());
+  BOOST_CHECK(tanh(b).GetError() > DD());
+  BOOST_CHECK(erf(b).GetError() > DD());
+  BOOST_CHECK(lgamma(a).GetError() > DD());
+  BOOST_CHECK(tgamma(a).GetError() > DD());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_DoubleDouble
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,319 @@
+#include "Dual.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef ValueWithError<float>  VF;
+  typedef Dual<double, 2>        D2;
+
+  struct Square
+  {
+    template<typename T>
+    T operator()(const T& x) const
+    {
+      return x * x;
+    }
+  };
+
+  struct Difference
+  {
+    template<typename T>
+    T operator()(const T& x) const
+    {
+      return x - x;
+    }
+  };
+
+  /// Formula with a constant argument which is passed through
+  struct Scaled
+  {
+    template<typename T>
+    T operator()(const T& x, double scale, const T& y) const
+    {
+      return scale * x / y;
+    }
+  };
+
+  struct Sum
+  {
+    template<typename T>
+    T operator()(const std::array<T, 3>& x) const
+    {
+      return x[0] + 2.0 * x[1] - x[2];
+    }
+  };
+
+  /// Function object calling F unqualified
+#define DEFINE_FUNC_ONE_ARG(F)  \
+  struct Func_##F               \
+  {                             \
+    template<typename T>        \
+    T operator()(const T& a) const \
+    {                           \
+      return F(a);              \
+    }                           \
+  };
+
+  DEFINE_FUNC_ONE_ARG(abs)
+  DEFINE_FUNC_ONE_ARG(acos)
+  DEFINE_FUNC_ONE_ARG(acosh)
+  DEFINE_FUNC_ONE_ARG(asin)
+  DEFINE_FUNC_ONE_ARG(asinh)
+  DEFINE_FUNC_ONE_ARG(atan)
+  DEFINE_FUNC_ONE_ARG(atanh)
+  DEFINE_FUNC_ONE_ARG(cbrt)
+  DEFINE_FUNC_ONE_ARG(cos)
+  DEFINE_FUNC_ONE_ARG(cosh)
+  DEFINE_FUNC_ONE_ARG(erf)
+  DEFINE_FUNC_ONE_ARG(erfc)
+  DEFINE_FUNC_ONE_ARG(exp)
+  DEFINE_FUNC_ONE_ARG(exp2)
+  DEFINE_FUNC_ONE_ARG(expm1)
+  DEFINE_FUNC_ONE_ARG(fabs)
+  DEFINE_FUNC_ONE_ARG(lgamma)
+  DEFINE_FUNC_ONE_ARG(log)
+  DEFINE_FUNC_ONE_ARG(log10)
+  DEFINE_FUNC_ONE_ARG(log1p)
+  DEFINE_FUNC_ONE_ARG(log2)
+  DEFINE_FUNC_ONE_ARG(sin)
+  DEFINE_FUNC_ONE_ARG(sinh)
+  DEFINE_FUNC_ONE_ARG(sqrt)
+  DEFINE_FUNC_ONE_ARG(tan)
+  DEFINE_FUNC_ONE_ARG(tanh)
+  DEFINE_FUNC_ONE_ARG(tgamma)
+
+  struct Func_atan2
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return atan2(a, b);
+    }
+  };
+
+  struct Func_pow
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return pow(a, b);
+    }
+  };
+
+  struct Mixed
+  {
+    template<typename T>
+    T operator()(const T& a, const T& b) const
+    {
+      return a * b + a / b - b;
+    }
+  };
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      pvd(0.5, 0.01),
+      pvd2(1.5, 0.02),
+      x(D2::Variable(3.0, 0)),
+      y(D2::Variable(4.0, 1))
+    {}
+
+    const VD pvd, pvd2;
+    const D2 x, y;
+  };
+
+} // anonymous namespace
+
+/// Compares propagate() of a single function with its ValueWithError overload
+#define TEST_DUAL_ONE_ARG(F, V)                                      \
+  {                                                                  \
+    const VD result = propagate(Func_##F(), V);                      \
+    const VD reference = F(V);                                       \
+    BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());      \
+    BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), 1e-10); \
+  }
+
+BOOST_FIXTURE_TEST_SUITE(Test_Dual,Fixture)
+
+BOOST_AUTO_TEST_CASE(ctor)
+{
+  BOOST_CHECK_EQUAL(D2().GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(D2(1.5).GetValue(), 1.5);
+  BOOST_CHECK_EQUAL(D2(1.5).GetDerivative(0), 0.0);
+  BOOST_CHECK_EQUAL(D2(1.5).GetDerivative(1), 0.0);
+
+  BOOST_CHECK_EQUAL(x.GetValue(), 3.0);
+  BOOST_CHECK_EQUAL(x.GetDerivative(0), 1.0);
+  BOOST_CHECK_EQUAL(x.GetDerivative(1), 0.0);
+  BOOST_CHECK_EQUAL(y.GetDerivative(1), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+  const D2 product = x * y;
+  BOOST_CHECK_EQUAL(product.GetValue(), 12.0);
+  BOOST_CHECK_EQUAL(product.GetDerivative(0), 4.0);
+  BOOST_CHECK_EQUAL(product.GetDerivative(1), 3.0);
+
+  const D2 quotient = x / y;
+  BOOST_CHECK_EQUAL(quotient.GetValue(), 0.75);
+  BOOST_CHECK_EQUAL(quotient.GetDerivative(0), 0.25);
+  BOOST_CHECK_EQUAL(quotient.GetDerivative(1), -3.0 / 16.0);
+
+  const D2 mixed = 2.0 - x * 3 + y / 2.0f;
+  BOOST_CHECK_EQUAL(mixed.GetValue(), -5.0);
+  BOOST_CHECK_EQUAL(mixed.GetDerivative(0), -3.0);
+  BOOST_CHECK_EQUAL(mixed.GetDerivative(1), 0.5);
+
+  const D2 negated = -x;
+  BOOST_CHECK_EQUAL(negated.GetValue(), -3.0);
+  BOOST_CHECK_EQUAL(negated.GetDerivative(0), -1.0);
+
+  D2 compound(x);
+  compound *= y;
+  compound += 1.0;
+  BOOST_CHECK_EQUAL(compound.GetValue(), 13.0);
+  BOOST_CHECK_EQUAL(compound.GetDerivative(0), 4.0);
+  BOOST_CHECK_EQUAL(compound.GetDerivative(1), 3.0);
+}
+
+BOOST_AUTO_TEST_CASE(comparison)
+{
+  BOOST_CHECK(x < y);
+  BOOST_CHECK(x == 3.0);
+  BOOST_CHECK(4 <= y);
+  BOOST_CHECK(!(x != D2(3.0, y.GetGradient())));
+  BOOST_CHECK(!(x > y));
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  const D2 h = hypot(x, y);
+  BOOST_CHECK_EQUAL(h.GetValue(), 5.0);
+  BOOST_CHECK_CLOSE(h.GetDerivative(0), 0.6, 1e-12);
+  BOOST_CHECK_CLOSE(h.GetDerivative(1), 0.8, 1e-12);
+
+  const D2 p = pow(x, 2);
+  BOOST_CHECK_EQUAL(p.GetValue(), 9.0);
+  BOOST_CHECK_EQUAL(p.GetDerivative(0), 6.0);
+
+  const D2 c = cos(x);
+  BOOST_CHECK_EQUAL(c.GetDerivative(0), -std::sin(3.0));
+}
+
+BOOST_AUTO_TEST_CASE(same_as_overloads_one_arg)
+{
+  const VD pvacosh(1.5, 0.01);
+
+  TEST_DUAL_ONE_ARG(abs, pvd)
+  TEST_DUAL_ONE_ARG(acos, pvd)
+  TEST_DUAL_ONE_ARG(acosh, pvacosh)
+  TEST_DUAL_ONE_ARG(asin, pvd)
+  TEST_DUAL_ONE_ARG(asinh, pvd)
+  TEST_DUAL_ONE_ARG(atan, pvd)
+  TEST_DUAL_ONE_ARG(atanh, pvd)
+  TEST_DUAL_ONE_ARG(cbrt, pvd)
+  TEST_DUAL_ONE_ARG(cos, pvd)
+  TEST_DUAL_ONE_ARG(cosh, pvd)
+  TEST_DUAL_ONE_ARG(erf, pvd)
+  TEST_DUAL_ONE_ARG(erfc, pvd)
+  TEST_DUAL_ONE_ARG(exp, pvd)
+  TEST_DUAL_ONE_ARG(exp2, pvd)
+  TEST_DUAL_ONE_ARG(expm1, pvd)
+  TEST_DUAL_ONE_ARG(fabs, pvd)
+  TEST_DUAL_ONE_ARG(lgamma, pvd)
+  TEST_DUAL_ONE_ARG(log, pvd)
+  TEST_DUAL_ONE_ARG(log10, pvd)
+  TEST_DUAL_ONE_ARG(log1p, pvd)
+  TEST_DUAL_ONE_ARG(log2, pvd)
+  TEST_DUAL_ONE_ARG(sin, pvd)
+  TEST_DUAL_ONE_ARG(sinh, pvd)
+  TEST_DUAL_ONE_ARG(sqrt, pvd)
+  TEST_DUAL_ONE_ARG(tan, pvd)
+  TEST_DUAL_ONE_ARG(tanh, pvd)
+  TEST_DUAL_ONE_ARG(tgamma, pvd)
+}
+
+BOOST_AUTO_TEST_CASE(same_as_overloads_two_args)
+{
+  VD result = propagate(Func_atan2(), pvd, pvd2);
+  VD reference = atan2(pvd, pvd2);
+  BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), 1e-10);
+
+  result = propagate(Func_pow(), pvd, pvd2);
+  reference = pow(pvd, pvd2);
+  BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), 1e-10);
+
+  // every argument is used only once per term, but twice overall
+  result = propagate(Mixed(), pvd, pvd2);
+  const double dx = pvd2.GetValue() + 1.0 / pvd2.GetValue();
+  const double dy = pvd.GetValue() - pvd.GetValue() / (pvd2.GetValue() * pvd2.GetValue()) - 1.0;
+  BOOST_CHECK_EQUAL(result.GetValue(), (pvd * pvd2 + pvd / pvd2 - pvd2).GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), std::hypot(dx * pvd.GetError(), dy * pvd2.GetError()), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(correlated_arguments)
+{
+  VD result = propagate(Square(), pvd);
+  BOOST_CHECK_PV(result, 0.25, 2.0 * 0.5 * 0.01);
+
+  result = propagate(Difference(), pvd);
+  BOOST_CHECK_PV(result, 0.0, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(constant_arguments)
+{
+  const VD result = propagate(Scaled(), pvd, 3.0, pvd2);
+  const VD reference = 3.0 * pvd / pvd2;
+  BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(array_arguments)
+{
+  const std::array<VD, 3> args = {{ VD(1.0, 0.2), VD(2.0, 0.2), VD(3.0, 0.4) }};
+  const VD result = propagate(Sum(), args);
+  BOOST_CHECK_EQUAL(result.GetValue(), 2.0);
+  BOOST_CHECK_CLOSE(result.GetError(), 0.6, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(result_type)
+{
+  bool success = std::is_same<decltype(propagate(Square(), VF(1.0f, 0.1f))), VF>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(exp(x * 2)), D2>::value;
+  BOOST_CHECK(success);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_Dual
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
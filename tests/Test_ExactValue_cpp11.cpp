@@ -0,0 +1,146 @@
+#include "ExactValue.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef ExactValue<double>     ED;
+  typedef ExactValue<float>      EF;
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      pvd(2.0, 0.5),
+      exact(4.0),
+      zeroError(4.0, 0.0)
+    {}
+
+    const VD pvd;
+    const ED exact;
+    const VD zeroError;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_ExactValue,Fixture)
+
+BOOST_AUTO_TEST_CASE(ctor)
+{
+  BOOST_CHECK_EQUAL(ED().GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(ED(1.5).GetValue(), 1.5);
+  BOOST_CHECK_EQUAL(ED(1.5).GetError(), 0.0);
+
+  bool success = std::is_same<decltype(make_exact(1.0f)), EF>::value;
+  BOOST_CHECK(success);
+
+  const double d = exact;
+  BOOST_CHECK_EQUAL(d, 4.0);
+
+  VD pv(exact);
+  BOOST_CHECK_PV(pv,4.0,0.0);
+}
+
+BOOST_AUTO_TEST_CASE(result_types)
+{
+  bool success = std::is_same<decltype(pvd * exact), VD>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(exact / pvd), VD>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(exact + exact), ED>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(exact - 1.0), ED>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(1.0f * EF(1.0f)), EF>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(EF(1.0f) * exact), ED>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(sqrt(exact * 2.0)), ED>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(pow(pvd, exact)), VD>::value;
+  BOOST_CHECK(success);
+  success = std::is_same<decltype(atan2(exact, 1.0)), ED>::value;
+  BOOST_CHECK(success);
+}
+
+BOOST_AUTO_TEST_CASE(same_as_zero_error)
+{
+  BOOST_CHECK_PVS((pvd * exact), (pvd * zeroError));
+  BOOST_CHECK_PVS((exact * pvd), (zeroError * pvd));
+  BOOST_CHECK_PVS((pvd / exact), (pvd / zeroError));
+  BOOST_CHECK_PVS((exact / pvd), (zeroError / pvd));
+  BOOST_CHECK_PVS((pvd + exact), (pvd + zeroError));
+  BOOST_CHECK_PVS((exact + pvd), (zeroError + pvd));
+  BOOST_CHECK_PVS((pvd - exact), (pvd - zeroError));
+  BOOST_CHECK_PVS((exact - pvd), (zeroError - pvd));
+
+  BOOST_CHECK_PVS(atan2(pvd, exact), atan2(pvd, zeroError));
+  BOOST_CHECK_PVS(atan2(exact, pvd), atan2(zeroError, pvd));
+  BOOST_CHECK_PVS(hypot(pvd, exact), hypot(pvd, zeroError));
+  BOOST_CHECK_PVS(hypot(exact, pvd), hypot(zeroError, pvd));
+  BOOST_CHECK_PVS(pow(pvd, exact), pow(pvd, zeroError));
+  BOOST_CHECK_CLOSE(pow(exact, pvd).GetValue(), pow(zeroError, pvd).GetValue(), 1e-12);
+  BOOST_CHECK_CLOSE(pow(exact, pvd).GetError(), pow(zeroError, pvd).GetError(), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(compound_assignment)
+{
+  VD pv(pvd);
+  pv *= exact;
+  pv += exact;
+  BOOST_CHECK_PV(pv,12.0,2.0);
+}
+
+BOOST_AUTO_TEST_CASE(exact_chain)
+{
+  const ED result = exp(log(exact) * 0.5) + ED(1.0) / 2.0;
+  BOOST_CHECK_CLOSE(result.GetValue(), 2.5, 1e-12);
+  BOOST_CHECK_EQUAL(result.GetError(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(comparison)
+{
+  BOOST_CHECK(exact == ED(4.0));
+  BOOST_CHECK(exact != 1.0);
+  BOOST_CHECK(1.0 < exact);
+  BOOST_CHECK(pvd < exact);
+  BOOST_CHECK(exact >= pvd);
+  BOOST_CHECK(!(exact <= pvd));
+  BOOST_CHECK(VD(4.0, 1.0) == exact);
+}
+
+BOOST_AUTO_TEST_CASE(output)
+{
+  std::stringstream sstr;
+  sstr << exact;
+  BOOST_CHECK_EQUAL(sstr.str(), "4");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_ExactValue
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,223 @@
+#include "FiniteDifferencePropagator.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <future>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>             VD;
+  typedef FiniteDifferencePropagator<double> Propagator;
+
+  /// Only accepts double, as a function from a third-party library
+  double black_box(double a, double b)
+  {
+    return std::exp(-a) * std::sin(b) / (1.0 + a * a);
+  }
+
+  /// Same function for ValueWithError, every argument appears only once in each factor
+  VD reference(const VD& a, const VD& b)
+  {
+    const double da = -black_box(a.GetValue(), b.GetValue())
+                      * (1.0 + 2.0 * a.GetValue() / (1.0 + a.GetValue() * a.GetValue()));
+    const double db = std::exp(-a.GetValue()) * std::cos(b.GetValue()) / (1.0 + a.GetValue() * a.GetValue());
+    return VD(black_box(a.GetValue(), b.GetValue()), std::hypot(da * a.GetError(), db * b.GetError()));
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      a(0.7, 0.05),
+      b(1.2, 0.1)
+    {}
+
+    const VD a, b;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_FiniteDifferencePropagator,Fixture)
+
+BOOST_AUTO_TEST_CASE(settings)
+{
+  Propagator propagator;
+  BOOST_CHECK_EQUAL(propagator.GetInitialStep(), Propagator::DefaultInitialStep());
+  BOOST_CHECK_EQUAL(propagator.GetTolerance(), Propagator::DefaultTolerance());
+  BOOST_CHECK(!propagator.GetStepCaching());
+  BOOST_CHECK_EQUAL(propagator.GetNumEvaluations(), 0u);
+
+  propagator.SetInitialStep(1e-2);
+  propagator.SetTolerance(1e-6);
+  propagator.SetMaxRefinements(3);
+  propagator.SetStepCaching(true);
+  BOOST_CHECK_EQUAL(propagator.GetInitialStep(), 1e-2);
+  BOOST_CHECK_EQUAL(propagator.GetTolerance(), 1e-6);
+  BOOST_CHECK_EQUAL(propagator.GetMaxRefinements(), 3u);
+  BOOST_CHECK(propagator.GetStepCaching());
+}
+
+BOOST_AUTO_TEST_CASE(same_as_analytic)
+{
+  Propagator propagator;
+  const VD result = propagator.Propagate(black_box, a, b);
+  const VD expected = reference(a, b);
+
+  BOOST_CHECK_EQUAL(result.GetValue(), expected.GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), expected.GetError(), 1e-6);
+
+  const VD product = propagator.Propagate([](double x, double y) { return x * y; }, a, b);
+  BOOST_CHECK_EQUAL(product.GetValue(), (a * b).GetValue());
+  BOOST_CHECK_CLOSE(product.GetError(), (a * b).GetError(), 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(single_argument)
+{
+  Propagator propagator;
+  const VD result = propagator.Propagate([](double x) { return std::log(x); }, b);
+  BOOST_CHECK_EQUAL(result.GetValue(), log(b).GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), log(b).GetError(), 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(number_of_evaluations)
+{
+  Propagator propagator;
+
+  // linear functions are accepted after the first extrapolation, one evaluation for the value and four per argument
+  propagator.Propagate([](double x, double y, double z) { return x + 2.0 * y - z; }, a, b, a);
+  BOOST_CHECK_EQUAL(propagator.GetNumEvaluations(), 13u);
+
+  propagator.ResetNumEvaluations();
+  BOOST_CHECK_EQUAL(propagator.GetNumEvaluations(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(step_caching)
+{
+  Propagator propagator;
+  propagator.SetInitialStep(0.1);
+  propagator.SetStepCaching(true);
+
+  const VD first = propagator.Propagate(black_box, a, b);
+  const std::size_t firstEvaluations = propagator.GetNumEvaluations();
+
+  propagator.ResetNumEvaluations();
+  const VD second = propagator.Propagate(black_box, a, b);
+
+  BOOST_CHECK_LT(propagator.GetNumEvaluations(), firstEvaluations);
+  BOOST_CHECK_EQUAL(propagator.GetNumEvaluations(), 9u);
+  BOOST_CHECK_CLOSE(second.GetError(), first.GetError(), 1e-6);
+
+  propagator.ClearStepCache();
+  propagator.ResetNumEvaluations();
+  propagator.Propagate(black_box, a, b);
+  BOOST_CHECK_EQUAL(propagator.GetNumEvaluations(), firstEvaluations);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_same_as_serial)
+{
+  ThreadPool pool(2);
+  Propagator serial, parallel(&pool);
+
+  const VD expected = serial.Propagate(black_box, a, b);
+  const VD result = parallel.Propagate(black_box, a, b);
+
+  BOOST_CHECK_PVS(result, expected);
+  BOOST_CHECK_EQUAL(parallel.GetNumEvaluations(), serial.GetNumEvaluations());
+}
+
+BOOST_AUTO_TEST_CASE(nested_in_pool_task)
+{
+  // more tasks than workers, each of them waits for the partial derivatives on the same pool
+  ThreadPool pool(2);
+  const VD expected = Propagator().Propagate(black_box, a, b);
+
+  std::vector<std::future<VD> > futures;
+  for(std::size_t i = 0; i < 4; i++)
+  {
+    futures.push_back(pool.Submit([&] { return Propagator(&pool).Propagate(black_box, a, b); }));
+  }
+
+  for(std::future<VD>& future : futures)
+  {
+    const VD result = future.get();
+    BOOST_CHECK_PVS(result, expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  std::vector<std::array<VD, 2> > batch;
+  for(std::size_t i = 0; i < 50; i++)
+  {
+    const std::array<VD, 2> args = {{ VD(0.1 * static_cast<double>(i), 0.05), b }};
+    batch.push_back(args);
+  }
+
+  ThreadPool pool(3);
+  Propagator serial, parallel(&pool);
+
+  const std::vector<VD> results = parallel.PropagateBatch(black_box, batch);
+  BOOST_REQUIRE_EQUAL(results.size(), batch.size());
+
+  for(std::size_t i = 0; i < batch.size(); i++)
+  {
+    const VD expected = serial.Propagate(black_box, batch[i]);
+    BOOST_CHECK_PVS(results[i], expected);
+  }
+
+  BOOST_CHECK_EQUAL(parallel.GetNumEvaluations(), serial.GetNumEvaluations());
+  BOOST_CHECK(parallel.PropagateBatch(black_box, std::vector<std::array<VD, 2> >()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(batch_with_step_caching)
+{
+  std::vector<std::array<VD, 2> > batch(20);
+  for(std::size_t i = 0; i < batch.size(); i++)
+  {
+    batch[i][0] = VD(0.7 + 1e-3 * static_cast<double>(i), 0.05);
+    batch[i][1] = b;
+  }
+
+  Propagator propagator;
+  propagator.SetInitialStep(0.1);
+  propagator.PropagateBatch(black_box, batch);
+  const std::size_t uncached = propagator.GetNumEvaluations();
+
+  propagator.SetStepCaching(true);
+  propagator.ResetNumEvaluations();
+  const std::vector<VD> results = propagator.PropagateBatch(black_box, batch);
+
+  BOOST_CHECK_LT(propagator.GetNumEvaluations(), uncached);
+  for(std::size_t i = 0; i < batch.size(); i++)
+  {
+    BOOST_CHECK_CLOSE(results[i].GetError(), reference(batch[i][0], batch[i][1]).GetError(), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_FiniteDifferencePropagator
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,226 @@
+#include "MixedPrecisionValueWithError.hpp"
+#include "DoubleDouble.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef boost::multiprecision::cpp_dec_float_50     MPF;
+  typedef ValueWithError<double>                      VD;
+  typedef MixedPrecisionValueWithError<double, float> MDF;
+  typedef MixedPrecisionValueWithError<float, float>  MFF;
+  typedef MixedPrecisionValueWithError<double, double> MDD;
+
+  /// Relative accuracy of the float errors
+  const double tolerance = 1e-4;
+
+#define CHECK_FUNC_ONE_ARG(func, arg)                                                         \
+  {                                                                                           \
+    const MDF result = func(MDF(arg.GetValue(), static_cast<float>(arg.GetError())));         \
+    const VD reference = func(arg);                                                           \
+    BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());                               \
+    BOOST_CHECK_CLOSE(static_cast<double>(result.GetError()), reference.GetError(), tolerance); \
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      a(0.4, 0.02),
+      b(1.7, 0.05),
+      ma(0.4, 0.02f),
+      mb(1.7, 0.05f)
+    {}
+
+    const VD a, b;
+    const MDF ma, mb;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_MixedPrecisionValueWithError,Fixture)
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+  const MDF x(2.5, -0.5f);
+  BOOST_CHECK_EQUAL(x.GetValue(), 2.5);
+  BOOST_CHECK_EQUAL(x.GetError(), 0.5f);
+
+  const MDF y;
+  BOOST_CHECK_EQUAL(y.GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(y.GetError(), 0.0f);
+
+  const MDF z(VD(1.0, 0.1));
+  BOOST_CHECK_EQUAL(z.GetError(), 0.1f);
+
+  const MDD w(z);
+  BOOST_CHECK_EQUAL(w.GetError(), static_cast<double>(0.1f));
+
+  const VD v = x.ToValueWithError();
+  BOOST_CHECK_EQUAL(v.GetValue(), 2.5);
+  BOOST_CHECK_EQUAL(v.GetError(), 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(promotion)
+{
+  const MFF f(1.0f, 0.1f);
+  const MDD d(1.0, 0.1);
+
+  BOOST_CHECK((std::is_same<decltype(ma + mb), MDF>::value));
+  BOOST_CHECK((std::is_same<decltype(f * ma), MDF>::value));
+  BOOST_CHECK((std::is_same<decltype(ma / d), MDD>::value));
+  BOOST_CHECK((std::is_same<decltype(pow(f, d)), MDD>::value));
+  BOOST_CHECK((std::is_same<decltype(2 * ma), MDF>::value));
+  BOOST_CHECK((std::is_same<decltype(f - 2.0), MFF>::value));
+  BOOST_CHECK((std::is_same<decltype(hypot(f, 1.0)), MFF>::value));
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_operators)
+{
+  const MDF product = ma * mb;
+  BOOST_CHECK_EQUAL(product.GetValue(), (a * b).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(product.GetError()), (a * b).GetError(), tolerance);
+
+  const MDF quotient = ma / mb;
+  BOOST_CHECK_EQUAL(quotient.GetValue(), (a / b).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(quotient.GetError()), (a / b).GetError(), tolerance);
+
+  const MDF sum = ma + mb;
+  BOOST_CHECK_EQUAL(sum.GetValue(), (a + b).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(sum.GetError()), (a + b).GetError(), tolerance);
+
+  const MDF difference = ma - mb;
+  BOOST_CHECK_EQUAL(difference.GetValue(), (a - b).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(difference.GetError()), (a - b).GetError(), tolerance);
+
+  const MDF scaled = 3.0 * ma - 1.0;
+  BOOST_CHECK_EQUAL(scaled.GetValue(), 3.0 * 0.4 - 1.0);
+  BOOST_CHECK_CLOSE(static_cast<double>(scaled.GetError()), 0.06, tolerance);
+
+  const MDF inverse = 2.0 / mb;
+  BOOST_CHECK_EQUAL(inverse.GetValue(), (2.0 / b).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(inverse.GetError()), (2.0 / b).GetError(), tolerance);
+
+  MDF compound = ma;
+  compound *= mb;
+  compound += 1.0;
+  compound -= ma;
+  compound /= 2;
+  const VD reference = (a * b + 1.0 - a) / 2.0;
+  BOOST_CHECK_EQUAL(compound.GetValue(), reference.GetValue());
+  BOOST_CHECK_GT(compound.GetError(), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  const VD small(0.4, 0.02);
+  const VD large(1.7, 0.05);
+
+  CHECK_FUNC_ONE_ARG(abs, small);
+  CHECK_FUNC_ONE_ARG(acos, small);
+  CHECK_FUNC_ONE_ARG(acosh, large);
+  CHECK_FUNC_ONE_ARG(asin, small);
+  CHECK_FUNC_ONE_ARG(asinh, large);
+  CHECK_FUNC_ONE_ARG(atan, large);
+  CHECK_FUNC_ONE_ARG(atanh, small);
+  CHECK_FUNC_ONE_ARG(cbrt, large);
+  CHECK_FUNC_ONE_ARG(cos, large);
+  CHECK_FUNC_ONE_ARG(cosh, large);
+  CHECK_FUNC_ONE_ARG(erf, small);
+  CHECK_FUNC_ONE_ARG(erfc, small);
+  CHECK_FUNC_ONE_ARG(exp, large);
+  CHECK_FUNC_ONE_ARG(exp2, large);
+  CHECK_FUNC_ONE_ARG(expm1, small);
+  CHECK_FUNC_ONE_ARG(fabs, small);
+  CHECK_FUNC_ONE_ARG(lgamma, large);
+  CHECK_FUNC_ONE_ARG(log, large);
+  CHECK_FUNC_ONE_ARG(log10, large);
+  CHECK_FUNC_ONE_ARG(log1p, small);
+  CHECK_FUNC_ONE_ARG(log2, large);
+  CHECK_FUNC_ONE_ARG(sin, large);
+  CHECK_FUNC_ONE_ARG(sinh, large);
+  CHECK_FUNC_ONE_ARG(sqrt, large);
+  CHECK_FUNC_ONE_ARG(tan, small);
+  CHECK_FUNC_ONE_ARG(tanh, large);
+  CHECK_FUNC_ONE_ARG(tgamma, large);
+
+  BOOST_CHECK_EQUAL(atan2(ma, mb).GetValue(), atan2(a, b).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(atan2(ma, mb).GetError()), atan2(a, b).GetError(), tolerance);
+  BOOST_CHECK_EQUAL(pow(mb, ma).GetValue(), pow(b, a).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(pow(mb, ma).GetError()), pow(b, a).GetError(), tolerance);
+  BOOST_CHECK_EQUAL(pow(mb, 2.0).GetValue(), pow(b, 2.0).GetValue());
+  BOOST_CHECK_CLOSE(static_cast<double>(pow(mb, 2.0).GetError()), pow(b, 2.0).GetError(), tolerance);
+  BOOST_CHECK_CLOSE(hypot(3.0, mb).GetValue(), std::hypot(3.0, 1.7), 1e-13);
+}
+
+BOOST_AUTO_TEST_CASE(multiprecision_value)
+{
+  typedef MixedPrecisionValueWithError<MPF, double> MMP;
+  typedef ValueWithError<MPF>                       VMP;
+
+  const MMP x(MPF(1) / 3, 0.01);
+  const MMP y(MPF(2) / 7, 0.02);
+  const VMP vx(MPF(1) / 3, MPF(0.01));
+  const VMP vy(MPF(2) / 7, MPF(0.02));
+
+  const MMP result = exp(x) * sqrt(y) + x / y;
+  const VMP reference = exp(vx) * sqrt(vy) + vx / vy;
+
+  BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());
+  BOOST_CHECK_CLOSE(result.GetError(), static_cast<double>(reference.GetError()), 1e-12);
+
+  // plain values of the value type
+  const MMP scaled = x * MPF(3);
+  BOOST_CHECK_EQUAL(scaled.GetValue(), x.GetValue() * 3);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_value)
+{
+  typedef MixedPrecisionValueWithError<DoubleDouble, double> MDDD;
+
+  const MDDD x(DoubleDouble(1.0) / 3.0, 0.01);
+  const MDDD result = sin(x) / x;
+
+  BOOST_CHECK_EQUAL(result.GetValue(), sin(x.GetValue()) / x.GetValue());
+  // both operands are treated as uncorrelated
+  const double t = 1.0 / 3.0;
+  BOOST_CHECK_CLOSE(result.GetError(), std::hypot(std::cos(t) * 0.01 / t, std::sin(t) / (t * t) * 0.01), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(output)
+{
+  std::stringstream sstr, reference;
+  sstr << MDF(1.5, 0.25f);
+  reference << VD(1.5, 0.25);
+  BOOST_CHECK_EQUAL(sstr.str(), reference.str());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_MixedPrecisionValueWithError
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
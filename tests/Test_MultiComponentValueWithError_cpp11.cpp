@@ -0,0 +1,192 @@
+#include "MultiComponentValueWithError.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>                  VD;
+  typedef MultiComponentValueWithError<double, 3> MD;
+
+  const double tolerance = 1e-12;
+
+  /// Every component of result must match the same computation with a separate ValueWithError
+#define CHECK_COMPONENTS(result, expr)                                                 \
+  for(std::size_t i = 0; i < MD::NumComponents(); i++)                                 \
+  {                                                                                    \
+    const VD a = ma.GetComponent(i);                                                   \
+    const VD b = mb.GetComponent(i);                                                   \
+    const VD reference = expr;                                                         \
+    BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());                        \
+    BOOST_CHECK_CLOSE(result.GetError(i), reference.GetError(), tolerance);            \
+    static_cast<void>(a);                                                              \
+    static_cast<void>(b);                                                              \
+  }
+
+#define CHECK_FUNC_ONE_ARG(func, arg)                                                  \
+  {                                                                                    \
+    const MD result = func(arg);                                                       \
+    for(std::size_t i = 0; i < MD::NumComponents(); i++)                               \
+    {                                                                                  \
+      const VD reference = func(arg.GetComponent(i));                                  \
+      BOOST_CHECK_EQUAL(result.GetValue(), reference.GetValue());                      \
+      BOOST_CHECK_CLOSE(result.GetError(i), reference.GetError(), tolerance);          \
+    }                                                                                  \
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      ma(0.4, {{0.02, 0.01, 0.0}}),
+      mb(1.7, {{0.05, 0.0, 0.03}})
+    {}
+
+    const MD ma, mb;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_MultiComponentValueWithError,Fixture)
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+  const MD x(2.5, {{-0.3, 0.4, 0.0}});
+  BOOST_CHECK_EQUAL(x.GetValue(), 2.5);
+  BOOST_CHECK_EQUAL(x.GetError(0), 0.3);
+  BOOST_CHECK_EQUAL(x.GetError(1), 0.4);
+  BOOST_CHECK_EQUAL(x.GetError(2), 0.0);
+  BOOST_CHECK_CLOSE(x.GetTotalError(), 0.5, tolerance);
+
+  BOOST_CHECK_CLOSE(x.ToValueWithError().GetError(), 0.5, tolerance);
+  BOOST_CHECK_EQUAL(x.GetComponent(1).GetValue(), 2.5);
+  BOOST_CHECK_EQUAL(x.GetComponent(1).GetError(), 0.4);
+
+  const MD exact(1.0);
+  BOOST_CHECK_EQUAL(exact.GetTotalError(), 0.0);
+
+  const MD y;
+  BOOST_CHECK_EQUAL(y.GetValue(), 0.0);
+
+  const MultiComponentValueWithError<float, 3> f(x);
+  BOOST_CHECK_EQUAL(f.GetError(1), 0.4f);
+
+  // the total error follows the combination policy
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, LinearCombinationPolicy> LinearPolicy;
+  const MultiComponentValueWithError<double, 3, LinearPolicy> linear(2.5, {{-0.3, 0.4, 0.0}});
+  BOOST_CHECK_CLOSE(linear.GetTotalError(), 0.7, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_operators)
+{
+  CHECK_COMPONENTS((ma * mb), (a * b));
+  CHECK_COMPONENTS((ma / mb), (a / b));
+  CHECK_COMPONENTS((ma + mb), (a + b));
+  CHECK_COMPONENTS((ma - mb), (a - b));
+
+  CHECK_COMPONENTS((ma * 3.0), (a * 3.0));
+  CHECK_COMPONENTS((3 * ma), (3.0 * a));
+  CHECK_COMPONENTS((ma / -2.0), (a / -2.0));
+  CHECK_COMPONENTS((2.0 / mb), (2.0 / b));
+  CHECK_COMPONENTS((ma + 1.0), (a + 1.0));
+  CHECK_COMPONENTS((1.0 - mb), (1.0 - b));
+
+  MD compound = ma;
+  compound *= mb;
+  compound += 1.0;
+  compound -= ma;
+  compound /= 2;
+  CHECK_COMPONENTS(compound, ((a * b + 1.0 - a) / 2.0));
+
+  BOOST_CHECK((std::is_same<decltype(MultiComponentValueWithError<float, 3>(ma) * mb), MD>::value));
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  const MD small(0.4, {{0.02, 0.01, 0.0}});
+  const MD large(1.7, {{0.05, 0.0, 0.03}});
+
+  CHECK_FUNC_ONE_ARG(abs, small);
+  CHECK_FUNC_ONE_ARG(acos, small);
+  CHECK_FUNC_ONE_ARG(acosh, large);
+  CHECK_FUNC_ONE_ARG(asin, small);
+  CHECK_FUNC_ONE_ARG(asinh, large);
+  CHECK_FUNC_ONE_ARG(atan, large);
+  CHECK_FUNC_ONE_ARG(atanh, small);
+  CHECK_FUNC_ONE_ARG(cbrt, large);
+  CHECK_FUNC_ONE_ARG(cos, large);
+  CHECK_FUNC_ONE_ARG(cosh, large);
+  CHECK_FUNC_ONE_ARG(erf, small);
+  CHECK_FUNC_ONE_ARG(erfc, small);
+  CHECK_FUNC_ONE_ARG(exp, large);
+  CHECK_FUNC_ONE_ARG(exp2, large);
+  CHECK_FUNC_ONE_ARG(expm1, small);
+  CHECK_FUNC_ONE_ARG(fabs, small);
+  CHECK_FUNC_ONE_ARG(lgamma, large);
+  CHECK_FUNC_ONE_ARG(log, large);
+  CHECK_FUNC_ONE_ARG(log10, large);
+  CHECK_FUNC_ONE_ARG(log1p, small);
+  CHECK_FUNC_ONE_ARG(log2, large);
+  CHECK_FUNC_ONE_ARG(sin, large);
+  CHECK_FUNC_ONE_ARG(sinh, large);
+  CHECK_FUNC_ONE_ARG(sqrt, large);
+  CHECK_FUNC_ONE_ARG(tan, small);
+  CHECK_FUNC_ONE_ARG(tanh, large);
+  CHECK_FUNC_ONE_ARG(tgamma, large);
+
+  CHECK_COMPONENTS(atan2(ma, mb), atan2(a, b));
+  CHECK_COMPONENTS(pow(mb, ma), pow(b, a));
+  CHECK_COMPONENTS(pow(mb, 2.0), pow(b, 2.0));
+  CHECK_COMPONENTS(pow(2.0, ma), pow(2.0, a));
+  CHECK_COMPONENTS(atan2(ma, 2.0), atan2(a, 2.0));
+}
+
+BOOST_AUTO_TEST_CASE(extreme_components)
+{
+  // the squares of these components over- and underflow
+  const MD x(1.0, {{1e200, 1e-200, 0.0}});
+  const MD y(2.0, {{3e200, 4e-200, 0.0}});
+
+  const MD sum = x + y;
+  BOOST_CHECK_CLOSE(sum.GetError(0), std::hypot(1e200, 3e200), tolerance);
+  BOOST_CHECK_CLOSE(sum.GetError(1), std::hypot(1e-200, 4e-200), tolerance);
+  BOOST_CHECK_EQUAL(sum.GetError(2), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(output)
+{
+  std::stringstream sstr, reference;
+  const MD x(1.5, {{0.3, 0.4, 0.0}});
+  sstr << x;
+  reference << VD(1.5, x.GetTotalError());
+  BOOST_CHECK_EQUAL(sstr.str(), reference.str());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_MultiComponentValueWithError
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,165 @@
+#include "ParallelTransform.hpp"
+#include "precompiled.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#include <atomic>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+
+  std::vector<VD> make_values(std::size_t n)
+  {
+    std::vector<VD> result;
+    for(std::size_t i = 0; i < n; i++)
+    {
+      result.push_back(VD(0.5 + 0.01 * static_cast<double>(i), 0.001 * static_cast<double>(i % 7 + 1)));
+    }
+    return result;
+  }
+
+  struct Tgamma
+  {
+    VD operator()(const VD& v) const { return tgamma(v); }
+  };
+
+  struct Pow
+  {
+    VD operator()(const VD& a, const VD& b) const { return pow(a, b); }
+  };
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Test_ParallelTransform)
+
+BOOST_AUTO_TEST_CASE(transform_unary)
+{
+  ThreadPool pool(3);
+
+  for(std::size_t n : { 0, 1, 5, 1000 })
+  {
+    const std::vector<VD> x = make_values(n);
+    std::vector<VD> y(n);
+
+    for(std::size_t grain : { 0, 1, 3, 64 })
+    {
+      parallel_transform(pool, x.data(), x.data() + n, y.data(), Tgamma(), grain);
+
+      for(std::size_t i = 0; i < n; i++)
+      {
+        BOOST_REQUIRE_EQUAL(y[i].GetValue(), tgamma(x[i]).GetValue());
+        BOOST_REQUIRE_EQUAL(y[i].GetError(), tgamma(x[i]).GetError());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(transform_binary_in_place)
+{
+  ThreadPool pool(2);
+  const std::size_t n = 777;
+  std::vector<VD> a = make_values(n);
+  const std::vector<VD> b = make_values(n);
+  const std::vector<VD> original = a;
+
+  parallel_transform(pool, a.data(), a.data() + n, b.data(), a.data(), Pow(), 10);
+
+  for(std::size_t i = 0; i < n; i++)
+  {
+    BOOST_REQUIRE_EQUAL(a[i].GetValue(), pow(original[i], b[i]).GetValue());
+    BOOST_REQUIRE_EQUAL(a[i].GetError(), pow(original[i], b[i]).GetError());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(for_each)
+{
+  ThreadPool pool(4);
+  const std::size_t n = 500;
+  std::vector<VD> x = make_values(n);
+
+  parallel_for_each(pool, x.data(), x.data() + n, [](VD& v) { v *= 2.0; }, 16);
+
+  const std::vector<VD> reference = make_values(n);
+  for(std::size_t i = 0; i < n; i++)
+  {
+    BOOST_REQUIRE_EQUAL(x[i].GetValue(), 2.0 * reference[i].GetValue());
+    BOOST_REQUIRE_EQUAL(x[i].GetError(), 2.0 * reference[i].GetError());
+  }
+
+  std::atomic<int> count(0);
+  const std::vector<VD>& constant = x;
+  parallel_for_each(pool, constant.data(), constant.data() + n, [&count](const VD&) { count++; });
+  BOOST_CHECK_EQUAL(count.load(), static_cast<int>(n));
+}
+
+BOOST_AUTO_TEST_CASE(span)
+{
+  std::vector<double> values = { 1.0, 2.0, 3.0 };
+  std::vector<double> errors = { 0.1, 0.2, 0.3 };
+
+  const ValueWithErrorSpan<double> s(values.data(), errors.data(), values.size());
+  BOOST_CHECK_EQUAL(s.size(), 3u);
+  BOOST_CHECK_EQUAL(s.Get(1).GetValue(), 2.0);
+  BOOST_CHECK_EQUAL(s.Get(1).GetError(), 0.2);
+
+  s.Set(2, VD(4.0, 0.4));
+  BOOST_CHECK_EQUAL(values[2], 4.0);
+  BOOST_CHECK_EQUAL(errors[2], 0.4);
+
+  const ValueWithErrorSpan<const double> readOnly = s;
+  BOOST_CHECK_EQUAL(readOnly.GetValues(), values.data());
+  BOOST_CHECK_EQUAL(readOnly.Get(0).GetError(), 0.1);
+}
+
+BOOST_AUTO_TEST_CASE(transform_span)
+{
+  ThreadPool pool(3);
+  const std::size_t n = 1000;
+  const std::vector<VD> x = make_values(n);
+  const std::vector<VD> b = make_values(n);
+
+  std::vector<double> xv(n), xe(n), bv(n), be(n), yv(n), ye(n);
+  for(std::size_t i = 0; i < n; i++)
+  {
+    xv[i] = x[i].GetValue();
+    xe[i] = x[i].GetError();
+    bv[i] = b[i].GetValue();
+    be[i] = b[i].GetError();
+  }
+
+  const ValueWithErrorSpan<const double> input(xv.data(), xe.data(), n);
+  const ValueWithErrorSpan<double> exponent(bv.data(), be.data(), n);
+  const ValueWithErrorSpan<double> result(yv.data(), ye.data(), n);
+
+  parallel_transform(pool, input, result, Tgamma(), 32);
+  for(std::size_t i = 0; i < n; i++)
+  {
+    BOOST_REQUIRE_EQUAL(yv[i], tgamma(x[i]).GetValue());
+    BOOST_REQUIRE_EQUAL(ye[i], tgamma(x[i]).GetError());
+  }
+
+  parallel_transform(pool, input, exponent, result, Pow());
+  for(std::size_t i = 0; i < n; i++)
+  {
+    BOOST_REQUIRE_EQUAL(yv[i], pow(x[i], b[i]).GetValue());
+    BOOST_REQUIRE_EQUAL(ye[i], pow(x[i], b[i]).GetError());
+  }
+
+  std::atomic<int> count(0);
+  parallel_for_each(pool, input, [&count](const VD& v) { if(v.GetValue() > 0.0) count++; }, 7);
+  BOOST_CHECK_EQUAL(count.load(), static_cast<int>(n));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_ParallelTransform
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
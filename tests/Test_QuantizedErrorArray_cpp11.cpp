@@ -0,0 +1,239 @@
+#include "QuantizedErrorArray.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<float>  VF;
+  typedef ValueWithError<double> VD;
+
+  /// Largest relative deviation of the decoded errors from errors
+  template<typename Array, typename T>
+  double max_relative_deviation(const Array& array, const std::vector<T>& errors)
+  {
+    const std::vector<ValueWithError<T> > dense = array.ToDense();
+
+    double deviation = 0.0;
+    for(std::size_t i = 0; i < errors.size(); i++)
+    {
+      deviation = std::max(deviation, std::abs(static_cast<double>(dense[i].GetError()) / errors[i] - 1.0));
+    }
+
+    return deviation;
+  }
+
+  struct Fixture
+  {
+    Fixture()
+    {
+      std::mt19937 engine(42);
+      std::uniform_real_distribution<double> value(-100.0, 100.0);
+      std::uniform_real_distribution<double> relative(-6.0, 0.0);
+
+      for(std::size_t i = 0; i < 1000; i++)
+      {
+        values.push_back(value(engine));
+        errors.push_back(std::abs(values.back()) * std::pow(10.0, relative(engine)));
+      }
+
+      // a few elements where the errors are beyond the range of half precision
+      errors[0] = 1e-9;
+      values[1] = 1e6;
+      errors[1] = 1e5;
+    }
+
+    std::vector<double> values, errors;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_QuantizedErrorArray,Fixture)
+
+BOOST_AUTO_TEST_CASE(half_conversion)
+{
+  BOOST_CHECK_EQUAL(detail::float_to_half(1.0f), 0x3c00);
+  BOOST_CHECK_EQUAL(detail::float_to_half(-2.0f), 0xc000);
+  BOOST_CHECK_EQUAL(detail::float_to_half(65504.0f), 0x7bff);
+  BOOST_CHECK_EQUAL(detail::float_to_half(65520.0f), 0x7c00);
+  BOOST_CHECK_EQUAL(detail::float_to_half(std::ldexp(1.0f, -24)), 0x0001);
+  BOOST_CHECK_EQUAL(detail::float_to_half(std::ldexp(1.0f, -26)), 0x0000);
+
+  // ties to even
+  BOOST_CHECK_EQUAL(detail::float_to_half(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+  BOOST_CHECK_EQUAL(detail::float_to_half(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3c02);
+
+  BOOST_CHECK_EQUAL(detail::half_to_float(0x3555), 0.333251953125f);
+  BOOST_CHECK_EQUAL(detail::half_to_float(0x0001), std::ldexp(1.0f, -24));
+  BOOST_CHECK(std::isinf(detail::half_to_float(0x7c00)));
+  BOOST_CHECK(std::isnan(detail::half_to_float(0x7e00)));
+
+  // every finite half survives the round trip
+  for(std::uint32_t h = 0; h < 0x10000; h++)
+  {
+    if((h & 0x7c00u) != 0x7c00u)
+    {
+      BOOST_REQUIRE_EQUAL(detail::float_to_half(detail::half_to_float(static_cast<std::uint16_t>(h))), h);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(bfloat16_conversion)
+{
+  BOOST_CHECK_EQUAL(detail::float_to_bfloat16(1.0f), 0x3f80);
+  BOOST_CHECK_EQUAL(detail::float_to_bfloat16(1.0f + std::ldexp(1.0f, -8)), 0x3f80);
+  BOOST_CHECK_EQUAL(detail::float_to_bfloat16(1.0f + 3.0f * std::ldexp(1.0f, -8)), 0x3f82);
+  BOOST_CHECK_EQUAL(detail::bfloat16_to_float(0x3f81), 1.0f + std::ldexp(1.0f, -7));
+  BOOST_CHECK(std::isnan(detail::bfloat16_to_float(detail::float_to_bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+BOOST_AUTO_TEST_CASE(log_quantized_encoding)
+{
+  typedef LogQuantized8ErrorEncoding E8;
+
+  BOOST_CHECK_EQUAL(E8::Encode(2.0, 0.0), 0);
+  BOOST_CHECK_EQUAL(E8::Encode(2.0, 2.0 * std::ldexp(1.0, -24)), 1);
+  BOOST_CHECK_EQUAL(E8::Encode(2.0, 2.0 * std::ldexp(1.0, -23)), 9);
+  BOOST_CHECK_EQUAL(E8::Encode(2.0, 1e-20), 1);
+  BOOST_CHECK_EQUAL(E8::Encode(2.0, 1e3), 255);
+  BOOST_CHECK_EQUAL(E8::Encode(0.0, 1.0), 255);
+
+  const double decodeValues[] = { -4.0, 4.0, 0.0, 3.0 };
+  const std::uint8_t codes[] = { 9, 0, 100, 1 };
+  double decoded[4];
+  E8::Decode(decodeValues, codes, decoded, 4);
+
+  BOOST_CHECK_EQUAL(decoded[0], 4.0 * std::ldexp(1.0, -23));
+  BOOST_CHECK_EQUAL(decoded[1], 0.0);
+  BOOST_CHECK_EQUAL(decoded[2], 0.0);
+  BOOST_CHECK_EQUAL(decoded[3], 3.0 * std::ldexp(1.0, -24));
+}
+
+BOOST_AUTO_TEST_CASE(precision)
+{
+  const std::vector<double> inRange(errors.begin() + 2, errors.end());
+  const std::vector<double> inRangeValues(values.begin() + 2, values.end());
+
+  // normal range of half precision only
+  std::vector<double> halfRange, halfRangeValues;
+  for(std::size_t i = 0; i < inRange.size(); i++)
+  {
+    if(inRange[i] >= 6.1e-5)
+    {
+      halfRange.push_back(inRange[i]);
+      halfRangeValues.push_back(inRangeValues[i]);
+    }
+  }
+
+  BOOST_CHECK_LE(max_relative_deviation(QuantizedErrorArray<double, HalfErrorEncoding>(halfRangeValues, halfRange), halfRange), std::ldexp(1.0, -11));
+  BOOST_CHECK_LE(max_relative_deviation(QuantizedErrorArray<double, BFloat16ErrorEncoding>(inRangeValues, inRange), inRange), std::ldexp(1.0, -8));
+  BOOST_CHECK_LE(max_relative_deviation(QuantizedErrorArray<double, LogQuantized8ErrorEncoding>(inRangeValues, inRange), inRange), 0.0443);
+  BOOST_CHECK_LE(max_relative_deviation(QuantizedErrorArray<double, LogQuantized16ErrorEncoding>(inRangeValues, inRange), inRange), 0.00034);
+
+  // out of the range of half precision
+  const QuantizedErrorArray<double, HalfErrorEncoding> half(values, errors);
+  BOOST_CHECK_EQUAL(half[0].GetError(), 0.0);
+  BOOST_CHECK(std::isinf(half[1].GetError()));
+
+  // no problem relative to the value
+  const QuantizedErrorArray<double, LogQuantized16ErrorEncoding> log16(values, errors);
+  BOOST_CHECK_CLOSE(log16[0].GetError(), 1e-9, 0.034);
+  BOOST_CHECK_CLOSE(log16[1].GetError(), 1e5, 0.034);
+}
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+  typedef QuantizedErrorArray<float, HalfErrorEncoding> Array;
+
+  const std::vector<VF> dense = { VF(1.0f, 0.5f), VF(2.0f, 0.25f), VF(-3.0f) };
+  const Array a(dense);
+
+  BOOST_CHECK_EQUAL(a.size(), 3u);
+  BOOST_CHECK_EQUAL(Array::BytesPerElement(), 6u);
+  BOOST_CHECK_EQUAL(a.GetCodes()[0], 0x3800);
+
+  const std::vector<VF> back = a.ToDense();
+  BOOST_REQUIRE_EQUAL(back.size(), dense.size());
+  for(std::size_t i = 0; i < dense.size(); i++)
+  {
+    BOOST_CHECK_EQUAL(back[i].GetValue(), dense[i].GetValue());
+    BOOST_CHECK_EQUAL(back[i].GetError(), dense[i].GetError());
+  }
+
+  const Array b = Array::FromCodes(a.GetValues(), a.GetCodes());
+  BOOST_CHECK_EQUAL(b[1].GetError(), 0.25f);
+
+  // negative errors are stored as their absolute value
+  const Array c(std::vector<float>{ 1.0f }, std::vector<float>{ -0.5f });
+  BOOST_CHECK_EQUAL(c[0].GetError(), 0.5f);
+
+  VF range[2];
+  a.Decode(1, 3, range);
+  BOOST_CHECK_EQUAL(range[0].GetValue(), 2.0f);
+  BOOST_CHECK_EQUAL(range[1].GetError(), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_operators)
+{
+  typedef QuantizedErrorArray<double, LogQuantized16ErrorEncoding> Array;
+
+  std::vector<double> otherValues(values.rbegin(), values.rend());
+  std::vector<double> otherErrors(errors.rbegin(), errors.rend());
+
+  const Array a(values, errors);
+  const Array b(otherValues, otherErrors);
+
+  const Array result = (a * b + 2.0) / (3.0 - a) * 0.5;
+  BOOST_REQUIRE_EQUAL(result.size(), values.size());
+
+  Array compound = a;
+  compound *= b;
+  compound += 2.0;
+  compound -= b;
+  compound /= 2.0;
+
+  const std::vector<VD> da = a.ToDense();
+  const std::vector<VD> db = b.ToDense();
+
+  for(std::size_t i = 0; i < values.size(); i++)
+  {
+    const VD reference = (da[i] * db[i] + 2.0) / (3.0 - da[i]) * 0.5;
+
+    // one quantization per operation
+    BOOST_CHECK_EQUAL(result[i].GetValue(), reference.GetValue());
+    BOOST_CHECK_CLOSE(result[i].GetError(), reference.GetError(), 5 * 0.034);
+
+    const VD compoundReference = (da[i] * db[i] + 2.0 - db[i]) / 2.0;
+    BOOST_CHECK_EQUAL(compound[i].GetValue(), compoundReference.GetValue());
+    BOOST_CHECK_CLOSE(compound[i].GetError(), compoundReference.GetError(), 4 * 0.034);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_QuantizedErrorArray
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
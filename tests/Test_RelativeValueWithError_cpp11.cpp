@@ -0,0 +1,204 @@
+#include "RelativeValueWithError.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>         VD;
+  typedef RelativeValueWithError<double> RD;
+  typedef RelativeValueWithError<float>  RF;
+
+  /// Relative accuracy of the errors
+  const double tolerance = 1e-12;
+
+#define CHECK_SAME(result, reference)                                        \
+  {                                                                          \
+    BOOST_CHECK_CLOSE(result.GetValue(), reference.GetValue(), tolerance);   \
+    BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), tolerance);   \
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      a(0.4, 0.02),
+      b(-1.7, 0.05),
+      ra(a),
+      rb(b)
+    {}
+
+    const VD a, b;
+    const RD ra, rb;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_RelativeValueWithError,Fixture)
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+  const RD x(2.0, -0.5);
+  BOOST_CHECK_EQUAL(x.GetValue(), 2.0);
+  BOOST_CHECK_EQUAL(x.GetError(), 0.5);
+  BOOST_CHECK_EQUAL(x.GetRelativeError(), 0.25);
+
+  const RD y = RD::FromRelativeError(-4.0, 0.25);
+  BOOST_CHECK_EQUAL(y.GetError(), 1.0);
+
+  const RD z;
+  BOOST_CHECK_EQUAL(z.GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(z.GetRelativeError(), 0.0);
+
+  // exact values stay exact, also for value zero
+  const RD exact(VD(0.0, 0.0));
+  BOOST_CHECK_EQUAL(exact.GetRelativeError(), 0.0);
+  BOOST_CHECK_EQUAL(exact.GetError(), 0.0);
+
+  const RD zero(VD(0.0, 1.0));
+  BOOST_CHECK(std::isinf(zero.GetRelativeError()));
+
+  const RF f(rb);
+  BOOST_CHECK_EQUAL(f.GetValue(), -1.7f);
+}
+
+BOOST_AUTO_TEST_CASE(conversion)
+{
+  CHECK_SAME(ra.ToValueWithError(), a);
+  CHECK_SAME(rb.ToValueWithError(), b);
+
+  // round trip, exact up to the rounding of the division and the multiplication
+  for(double value = -100.0; value < 100.0; value += 0.37)
+  {
+    const VD v(value, 1e-3 * value * value + 1e-9);
+    const VD back = RD(v).ToValueWithError();
+    BOOST_CHECK_EQUAL(back.GetValue(), v.GetValue());
+    BOOST_CHECK_CLOSE(back.GetError(), v.GetError(), 1e-13);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_operators)
+{
+  CHECK_SAME((ra * rb), (a * b));
+  CHECK_SAME((ra / rb), (a / b));
+  CHECK_SAME((ra + rb), (a + b));
+  CHECK_SAME((ra - rb), (a - b));
+
+  CHECK_SAME((ra * 3.0), (a * 3.0));
+  CHECK_SAME((3 * ra), (3.0 * a));
+  CHECK_SAME((ra / -2.0), (a / -2.0));
+  CHECK_SAME((2.0 / rb), (2.0 / b));
+  CHECK_SAME((ra + 1.0), (a + 1.0));
+  CHECK_SAME((1.0 + rb), (1.0 + b));
+  CHECK_SAME((ra - 1.0), (a - 1.0));
+  CHECK_SAME((1.0 - rb), (1.0 - b));
+
+  // a scale doesn't change the relative error
+  BOOST_CHECK_EQUAL((ra * 7.0).GetRelativeError(), ra.GetRelativeError());
+
+  RD compound = ra;
+  compound *= rb;
+  compound += 1.0;
+  compound -= ra;
+  compound /= 2;
+  CHECK_SAME(compound, ((a * b + 1.0 - a) / 2.0));
+
+  BOOST_CHECK((std::is_same<decltype(RF(ra) * rb), RD>::value));
+}
+
+BOOST_AUTO_TEST_CASE(cancellation)
+{
+  // the relative error of a zero value is infinite, the absolute error is kept instead
+  const VD p(1.0, 0.1), m(-1.0, 0.1);
+  const RD zero = RD(p) + RD(m);
+  BOOST_CHECK_EQUAL(zero.GetValue(), 0.0);
+  BOOST_CHECK(std::isinf(zero.GetRelativeError()));
+  CHECK_SAME(zero, (p + m));
+  CHECK_SAME((RD(p) - RD(p)), (p - p));
+  CHECK_SAME((RD(p) - 1.0), (p - 1.0));
+
+  // operations with the zero operand
+  const VD factor(2.0, 0.2);
+  CHECK_SAME((zero * RD(factor)), ((p + m) * factor));
+  CHECK_SAME((RD(factor) * zero), (factor * (p + m)));
+  CHECK_SAME((zero / RD(factor)), ((p + m) / factor));
+  CHECK_SAME((zero * 3.0), ((p + m) * 3.0));
+  CHECK_SAME((zero + 1.0), ((p + m) + 1.0));
+  CHECK_SAME((zero + RD(factor)), ((p + m) + factor));
+  CHECK_SAME(abs(zero), abs(p + m));
+  CHECK_SAME(exp(zero), exp(p + m));
+  CHECK_SAME(pow(zero, 2), pow(p + m, 2.0));
+  BOOST_CHECK(std::isfinite((zero + 1.0).GetRelativeError()));
+}
+
+BOOST_AUTO_TEST_CASE(product_chain)
+{
+  VD reference(1.0, 0.0);
+  RD result(reference);
+
+  for(int i = 1; i < 20; i++)
+  {
+    const VD factor(1.0 + 0.1 * i, 0.01 * i);
+    reference = i % 2 ? reference * factor : reference / factor;
+    result = i % 2 ? result * RD(factor) : result / RD(factor);
+  }
+
+  CHECK_SAME(result, reference);
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  const VD positive(1.7, 0.05);
+  const RD rpositive(positive);
+
+  CHECK_SAME(abs(rb), abs(b));
+  CHECK_SAME(fabs(rb), fabs(b));
+  CHECK_SAME(sqrt(rpositive), sqrt(positive));
+  CHECK_SAME(cbrt(rb), cbrt(b));
+  CHECK_SAME(exp(rb), exp(b));
+  CHECK_SAME(log(rpositive), log(positive));
+  CHECK_SAME(pow(rb, 3), pow(b, 3.0));
+  CHECK_SAME(pow(rpositive, -0.5), pow(positive, -0.5));
+  CHECK_SAME(pow(2.0, rb), pow(2.0, b));
+  CHECK_SAME(pow(rpositive, ra), pow(positive, a));
+
+  // log(1) is exact
+  BOOST_CHECK_EQUAL(log(RD(1.0, 0.0)).GetError(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(output)
+{
+  std::stringstream sstr, reference;
+  sstr << RD(1.5, 0.25);
+  reference << VD(1.5, 0.25);
+  BOOST_CHECK_EQUAL(sstr.str(), reference.str());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_RelativeValueWithError
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
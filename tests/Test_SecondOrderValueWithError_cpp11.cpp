@@ -0,0 +1,234 @@
+#include "SecondOrderValueWithError.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>            VD;
+  typedef SecondOrderValueWithError<double> SD;
+
+  /// Compares the second derivative with a central difference of the first derivative
+  template<detail::Opcode op>
+  void check_second_derivative(double v)
+  {
+    const double h = 1e-5;
+    const double numeric = (detail::derivative<op>::first(v + h) - detail::derivative<op>::first(v - h)) / (2.0 * h);
+    BOOST_CHECK_SMALL(detail::derivative<op>::second(v) - numeric, 1e-6 * std::max(std::abs(numeric), 1.0));
+  }
+
+  template<detail::Opcode op>
+  void check_second_derivatives(double l, double r)
+  {
+    const double h = 1e-5;
+    double dl1, dr1, dl2, dr2, dll, drr, dlr;
+
+    detail::derivative<op>::second(l, r, dll, drr, dlr);
+
+    detail::derivative<op>::first(l + h, r, dl1, dr1);
+    detail::derivative<op>::first(l - h, r, dl2, dr2);
+    BOOST_CHECK_SMALL(dll - (dl1 - dl2) / (2.0 * h), 1e-6);
+    BOOST_CHECK_SMALL(dlr - (dr1 - dr2) / (2.0 * h), 1e-6);
+
+    detail::derivative<op>::first(l, r + h, dl1, dr1);
+    detail::derivative<op>::first(l, r - h, dl2, dr2);
+    BOOST_CHECK_SMALL(drr - (dr1 - dr2) / (2.0 * h), 1e-6);
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      x(2.0, 0.5),
+      y(3.0, 0.25)
+    {}
+
+    const SD x, y;
+  };
+
+} // anonymous namespace
+
+/// With tiny errors the second order terms vanish and the result equals the first order one
+#define TEST_SAME_AS_FIRST_ORDER(F, V)                                                 \
+  {                                                                                    \
+    const SD result = F(SD(V, 1e-7));                                                  \
+    const VD reference = F(VD(V, 1e-7));                                               \
+    BOOST_CHECK_CLOSE(result.GetValue(), reference.GetValue(), 1e-9);                 \
+    BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), 1e-5);                 \
+  }
+
+BOOST_FIXTURE_TEST_SUITE(Test_SecondOrderValueWithError,Fixture)
+
+BOOST_AUTO_TEST_CASE(ctor)
+{
+  BOOST_CHECK_EQUAL(SD().GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(SD().GetError(), 0.0);
+
+  BOOST_CHECK_PV(x, 2.0, 0.5);
+  BOOST_CHECK_EQUAL(x.GetVariance(), 0.25);
+
+  const SD fromMoments = SD::FromMoments(1.0, 4.0);
+  BOOST_CHECK_PV(fromMoments, 1.0, 2.0);
+
+  const SD fromValue(VD(1.5, 0.5));
+  BOOST_CHECK_PV(fromValue, 1.5, 0.5);
+
+  const VD converted = x.ToValueWithError();
+  BOOST_CHECK_PV(converted, 2.0, 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(exact_for_sum_and_product)
+{
+  const SD sum = x + y;
+  BOOST_CHECK_EQUAL(sum.GetValue(), 5.0);
+  BOOST_CHECK_EQUAL(sum.GetVariance(), 0.25 + 0.0625);
+
+  const SD difference = x - y;
+  BOOST_CHECK_EQUAL(difference.GetValue(), -1.0);
+  BOOST_CHECK_EQUAL(difference.GetVariance(), 0.25 + 0.0625);
+
+  // Var[xy] = y^2 Var[x] + x^2 Var[y] + Var[x] Var[y]
+  const SD product = x * y;
+  BOOST_CHECK_EQUAL(product.GetValue(), 6.0);
+  BOOST_CHECK_EQUAL(product.GetVariance(), 9.0 * 0.25 + 4.0 * 0.0625 + 0.25 * 0.0625);
+
+  const SD scaled = 3.0 * x + 1;
+  BOOST_CHECK_EQUAL(scaled.GetValue(), 7.0);
+  BOOST_CHECK_EQUAL(scaled.GetVariance(), 9.0 * 0.25);
+}
+
+BOOST_AUTO_TEST_CASE(bias_correction)
+{
+  // E[exp(x)] = exp(v) (1 + e^2 / 2), Var[exp(x)] = exp(2v) (e^2 + e^4 / 2)
+  const SD e = exp(x);
+  BOOST_CHECK_CLOSE(e.GetValue(), std::exp(2.0) * 1.125, 1e-12);
+  BOOST_CHECK_CLOSE(e.GetVariance(), std::exp(4.0) * (0.25 + 0.03125), 1e-12);
+
+  // E[1/y] = 1/v + e^2/v^3
+  const SD inverse = 1.0 / y;
+  BOOST_CHECK_CLOSE(inverse.GetValue(), 1.0 / 3.0 + 0.0625 / 27.0, 1e-12);
+
+  const SD l = log(x);
+  BOOST_CHECK_CLOSE(l.GetValue(), std::log(2.0) - 0.25 / 8.0, 1e-12);
+
+  const SD s = pow(x, 2);
+  BOOST_CHECK_CLOSE(s.GetValue(), 4.0 + 0.25, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(compound_assignment)
+{
+  SD a(x);
+  a *= y;
+  a += 1.0;
+  BOOST_CHECK_EQUAL(a.GetValue(), 7.0);
+  BOOST_CHECK_EQUAL(a.GetVariance(), (x * y).GetVariance());
+}
+
+BOOST_AUTO_TEST_CASE(same_as_first_order_for_small_errors)
+{
+  TEST_SAME_AS_FIRST_ORDER(abs, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(acos, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(acosh, 1.5)
+  TEST_SAME_AS_FIRST_ORDER(asin, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(asinh, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(atan, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(atanh, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(cbrt, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(cos, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(cosh, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(erf, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(erfc, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(exp, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(exp2, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(expm1, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(fabs, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(lgamma, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(log, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(log10, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(log1p, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(log2, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(sin, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(sinh, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(sqrt, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(tan, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(tanh, 0.5)
+  TEST_SAME_AS_FIRST_ORDER(tgamma, 0.5)
+
+  const SD a(0.5, 1e-7), b(1.5, 1e-7);
+  const VD va(0.5, 1e-7), vb(1.5, 1e-7);
+  BOOST_CHECK_CLOSE(atan2(a, b).GetError(), atan2(va, vb).GetError(), 1e-5);
+  BOOST_CHECK_CLOSE(pow(a, b).GetError(), pow(va, vb).GetError(), 1e-5);
+  BOOST_CHECK_CLOSE((a / b).GetError(), (va / vb).GetError(), 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(second_derivatives)
+{
+  using detail::Opcode;
+
+  check_second_derivative<Opcode::Acos>(0.5);
+  check_second_derivative<Opcode::Acosh>(1.5);
+  check_second_derivative<Opcode::Asin>(0.5);
+  check_second_derivative<Opcode::Asinh>(0.5);
+  check_second_derivative<Opcode::Atan>(0.5);
+  check_second_derivative<Opcode::Atanh>(0.5);
+  check_second_derivative<Opcode::Cbrt>(0.5);
+  check_second_derivative<Opcode::Cbrt>(-0.5);
+  check_second_derivative<Opcode::Cos>(0.5);
+  check_second_derivative<Opcode::Cosh>(0.5);
+  check_second_derivative<Opcode::Erf>(0.5);
+  check_second_derivative<Opcode::Erfc>(0.5);
+  check_second_derivative<Opcode::Exp>(0.5);
+  check_second_derivative<Opcode::Exp2>(0.5);
+  check_second_derivative<Opcode::Expm1>(0.5);
+  check_second_derivative<Opcode::Lgamma>(0.5);
+  check_second_derivative<Opcode::Log>(0.5);
+  check_second_derivative<Opcode::Log10>(0.5);
+  check_second_derivative<Opcode::Log1p>(0.5);
+  check_second_derivative<Opcode::Log2>(0.5);
+  check_second_derivative<Opcode::Sin>(0.5);
+  check_second_derivative<Opcode::Sinh>(0.5);
+  check_second_derivative<Opcode::Sqrt>(0.5);
+  check_second_derivative<Opcode::Tan>(0.5);
+  check_second_derivative<Opcode::Tanh>(0.5);
+  check_second_derivative<Opcode::Tgamma>(0.5);
+
+  check_second_derivatives<Opcode::Multiply>(0.5, 1.5);
+  check_second_derivatives<Opcode::Divide>(0.5, 1.5);
+  check_second_derivatives<Opcode::Atan2>(0.5, 1.5);
+  check_second_derivatives<Opcode::Hypot>(0.5, 1.5);
+  check_second_derivatives<Opcode::Pow>(0.5, 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(output)
+{
+  std::stringstream sstr;
+  sstr << x;
+  BOOST_CHECK_EQUAL(sstr.str(), "(2+-0.5)");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_SecondOrderValueWithError
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,250 @@
+#include "SimdPack.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef SimdPack<double, 4>    S;
+  typedef ValueWithError<double> VD;
+  typedef ValueWithError<S>      VS;
+
+  const double tolerance = 1e-12;
+
+  /// Every lane of result must match the same computation with ValueWithError<double>
+#define CHECK_LANES(result, expr)                                                      \
+  for(std::size_t i = 0; i < S::Width(); i++)                                          \
+  {                                                                                    \
+    const VD a = get_lane(va, i);                                                      \
+    const VD b = get_lane(vb, i);                                                      \
+    const VD reference = expr;                                                         \
+    BOOST_CHECK_CLOSE(get_lane(result, i).GetValue(), reference.GetValue(), tolerance); \
+    BOOST_CHECK_CLOSE(get_lane(result, i).GetError(), reference.GetError(), tolerance); \
+    static_cast<void>(a);                                                              \
+    static_cast<void>(b);                                                              \
+  }
+
+#define CHECK_FUNC_ONE_ARG(func, arg)                                                  \
+  {                                                                                    \
+    const VS result = func(arg);                                                       \
+    for(std::size_t i = 0; i < S::Width(); i++)                                        \
+    {                                                                                  \
+      const VD reference = func(get_lane(arg, i));                                     \
+      BOOST_CHECK_CLOSE(get_lane(result, i).GetValue(), reference.GetValue(), tolerance); \
+      BOOST_CHECK_CLOSE(get_lane(result, i).GetError(), reference.GetError(), tolerance); \
+    }                                                                                  \
+  }
+
+  S lanes(double a, double b, double c, double d)
+  {
+    const std::array<double, 4> values = {{a, b, c, d}};
+    return S(values);
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      va(lanes(0.1, 0.4, -0.3, 0.7), lanes(0.01, 0.02, 0.0, 0.05)),
+      vb(lanes(1.7, 2.5, 1.2, 3.1), lanes(0.05, 0.0, 0.03, 0.1))
+    {}
+
+    const VS va, vb;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_SimdPack,Fixture)
+
+BOOST_AUTO_TEST_CASE(pack)
+{
+  const S a = lanes(1.0, -2.0, 3.0, -4.0);
+  BOOST_CHECK_EQUAL(S::Width(), 4u);
+  BOOST_CHECK_EQUAL(a[1], -2.0);
+  BOOST_CHECK_EQUAL(S(2.5)[3], 2.5);
+  BOOST_CHECK_EQUAL(S()[0], 0.0);
+
+  const S b = 2.0 * a - a / 2 + 1.0;
+  const S c = abs(-a);
+  for(std::size_t i = 0; i < S::Width(); i++)
+  {
+    BOOST_CHECK_EQUAL(b[i], 1.5 * a[i] + 1.0);
+    BOOST_CHECK_EQUAL(c[i], std::abs(a[i]));
+    BOOST_CHECK_EQUAL(exp(a)[i], std::exp(a[i]));
+    BOOST_CHECK_EQUAL(pow(a, 2.0)[i], std::pow(a[i], 2.0));
+  }
+
+  S d = a;
+  d *= a;
+  d -= 1.0;
+  BOOST_CHECK_EQUAL(d[3], 15.0);
+
+  std::stringstream sstr;
+  sstr << a;
+  BOOST_CHECK_EQUAL(sstr.str(), "[1 -2 3 -4]");
+
+  BOOST_CHECK_EQUAL(std::numeric_limits<S>::digits, std::numeric_limits<double>::digits);
+  BOOST_CHECK_EQUAL(std::numeric_limits<S>::max()[2], std::numeric_limits<double>::max());
+}
+
+BOOST_AUTO_TEST_CASE(hypot_lanes)
+{
+  // the squares of these lanes over- and underflow, the others take the fast path
+  const S a = lanes(3.0, 1e200, 1e-200, 0.0);
+  const S b = lanes(4.0, 3e200, 4e-200, 0.0);
+  const S h = hypot(a, b);
+  for(std::size_t i = 0; i < S::Width(); i++)
+  {
+    BOOST_CHECK_CLOSE(h[i], std::hypot(a[i], b[i]), tolerance);
+  }
+
+  const S fast = hypot(lanes(3.0, 5.0, 0.0, 1.0), 4.0);
+  BOOST_CHECK_EQUAL(fast[0], 5.0);
+  BOOST_CHECK_EQUAL(fast[2], 4.0);
+  BOOST_CHECK_CLOSE(fast[3], std::sqrt(17.0), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_operators)
+{
+  CHECK_LANES((va * vb), (a * b));
+  CHECK_LANES((va / vb), (a / b));
+  CHECK_LANES((va + vb), (a + b));
+  CHECK_LANES((va - vb), (a - b));
+
+  CHECK_LANES((va * 3.0), (a * 3.0));
+  CHECK_LANES((3.0 * va), (3.0 * a));
+  CHECK_LANES((va / -2.0), (a / -2.0));
+  CHECK_LANES((2.0 / vb), (2.0 / b));
+  CHECK_LANES((va + 1.0), (a + 1.0));
+  CHECK_LANES((1.0 - vb), (1.0 - b));
+
+  VS compound = va;
+  compound *= vb;
+  compound += 1.0;
+  compound -= va;
+  compound /= 2.0;
+  CHECK_LANES(compound, ((a * b + 1.0 - a) / 2.0));
+}
+
+BOOST_AUTO_TEST_CASE(math_functions)
+{
+  const VS small(lanes(0.1, 0.4, -0.3, 0.7), lanes(0.01, 0.02, 0.0, 0.05));
+  const VS large(lanes(1.7, 2.5, 1.2, 3.1), lanes(0.05, 0.0, 0.03, 0.1));
+
+  CHECK_FUNC_ONE_ARG(abs, small);
+  CHECK_FUNC_ONE_ARG(acos, small);
+  CHECK_FUNC_ONE_ARG(acosh, large);
+  CHECK_FUNC_ONE_ARG(asin, small);
+  CHECK_FUNC_ONE_ARG(asinh, large);
+  CHECK_FUNC_ONE_ARG(atan, large);
+  CHECK_FUNC_ONE_ARG(atanh, small);
+  CHECK_FUNC_ONE_ARG(cbrt, large);
+  CHECK_FUNC_ONE_ARG(cos, large);
+  CHECK_FUNC_ONE_ARG(cosh, large);
+  CHECK_FUNC_ONE_ARG(erf, small);
+  CHECK_FUNC_ONE_ARG(erfc, small);
+  CHECK_FUNC_ONE_ARG(exp, large);
+  CHECK_FUNC_ONE_ARG(exp2, large);
+  CHECK_FUNC_ONE_ARG(expm1, small);
+  CHECK_FUNC_ONE_ARG(fabs, small);
+  CHECK_FUNC_ONE_ARG(lgamma, large);
+  CHECK_FUNC_ONE_ARG(log, large);
+  CHECK_FUNC_ONE_ARG(log10, large);
+  CHECK_FUNC_ONE_ARG(log1p, small);
+  CHECK_FUNC_ONE_ARG(log2, large);
+  CHECK_FUNC_ONE_ARG(sin, large);
+  CHECK_FUNC_ONE_ARG(sinh, large);
+  CHECK_FUNC_ONE_ARG(sqrt, large);
+  CHECK_FUNC_ONE_ARG(tan, small);
+  CHECK_FUNC_ONE_ARG(tanh, large);
+  CHECK_FUNC_ONE_ARG(tgamma, large);
+
+  CHECK_LANES(atan2(va, vb), atan2(a, b));
+  CHECK_LANES(hypot(va, vb), hypot(a, b));
+  CHECK_LANES(pow(vb, va), pow(b, a));
+  CHECK_LANES(pow(vb, 2.0), pow(b, 2.0));
+  CHECK_LANES(pow(2.0, va), pow(2.0, a));
+  CHECK_LANES(atan2(va, 2.0), atan2(a, 2.0));
+  CHECK_LANES(hypot(va, 2.0), hypot(a, 2.0));
+}
+
+BOOST_AUTO_TEST_CASE(combination_policy)
+{
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, MaximumCombinationPolicy> MaximumPolicy;
+  typedef ValueWithError<S, MaximumPolicy> VM;
+
+  const VM x(lanes(1.0, 2.0, 3.0, 4.0), lanes(0.1, 0.5, 0.0, 0.2));
+  const VM y(lanes(1.0, 2.0, 3.0, 4.0), lanes(0.3, 0.1, 0.0, 0.2));
+  const VM sum = x + y;
+
+  BOOST_CHECK_EQUAL(sum.GetError()[0], 0.3);
+  BOOST_CHECK_EQUAL(sum.GetError()[1], 0.5);
+  BOOST_CHECK_EQUAL(sum.GetError()[2], 0.0);
+  BOOST_CHECK_EQUAL(sum.GetError()[3], 0.2);
+}
+
+BOOST_AUTO_TEST_CASE(pack_and_unpack)
+{
+  std::vector<VD> values;
+  for(std::size_t i = 0; i < 10; i++)
+  {
+    values.push_back(VD(1.0 + static_cast<double>(i), 0.1 * static_cast<double>(i)));
+  }
+
+  const std::vector<VS> packs = pack_lanes<4>(values);
+  BOOST_REQUIRE_EQUAL(packs.size(), 3u);
+  BOOST_CHECK_EQUAL(packs[1].GetValue()[2], 7.0);
+  BOOST_CHECK_EQUAL(packs[1].GetError()[2], values[6].GetError());
+
+  // the unused lanes repeat the last value
+  BOOST_CHECK_EQUAL(packs[2].GetValue()[1], 10.0);
+  BOOST_CHECK_EQUAL(packs[2].GetValue()[3], 10.0);
+
+  std::vector<VS> results;
+  for(std::size_t i = 0; i < packs.size(); i++)
+  {
+    results.push_back(log(packs[i]) * packs[i]);
+  }
+
+  const std::vector<VD> unpacked = unpack_lanes(results, values.size());
+  BOOST_REQUIRE_EQUAL(unpacked.size(), values.size());
+  for(std::size_t i = 0; i < values.size(); i++)
+  {
+    const VD reference = log(values[i]) * values[i];
+    BOOST_CHECK_CLOSE(unpacked[i].GetValue(), reference.GetValue(), tolerance);
+    BOOST_CHECK_CLOSE(unpacked[i].GetError(), reference.GetError(), tolerance);
+  }
+
+  BOOST_CHECK(pack_lanes<8>(std::vector<VD>()).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_SimdPack
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,167 @@
+#include "SparseErrorArray.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>   VD;
+  typedef SparseErrorArray<double> SA;
+  typedef std::vector<VD>          DenseArray;
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      denseA { { 1.0, 0.5 }, { 2.0 }, { 3.0 }, { -4.0, 1.0 }, { 5.0 } },
+      denseB { { 2.0 }, { 3.0, 0.25 }, { 4.0 }, { 0.5, 2.0 }, { 1.5 } },
+      a(denseA),
+      b(denseB)
+    {}
+
+    const DenseArray denseA, denseB;
+    const SA a, b;
+  };
+
+  /// Checks that the sparse result matches the element-wise dense computation
+  template<typename Op>
+  void CheckElementWise(const SA& result, const DenseArray& lhs, const DenseArray& rhs, Op op)
+  {
+    const DenseArray dense = result.ToDense();
+    BOOST_REQUIRE_EQUAL(dense.size(), lhs.size());
+
+    for(std::size_t i = 0; i < dense.size(); i++)
+    {
+      const VD expected = op(lhs[i], rhs[i]);
+      BOOST_CHECK_PVS(dense[i], expected);
+    }
+  }
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_SparseErrorArray,Fixture)
+
+BOOST_AUTO_TEST_CASE(default_ctor)
+{
+  SA sa;
+  BOOST_CHECK_EQUAL(sa.size(), 0u);
+  BOOST_CHECK_EQUAL(sa.NumErrors(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(from_dense)
+{
+  BOOST_CHECK_EQUAL(a.size(), 5u);
+  BOOST_CHECK_EQUAL(a.NumErrors(), 2u);
+  BOOST_CHECK_EQUAL(a.GetErrorIndices()[0], 0u);
+  BOOST_CHECK_EQUAL(a.GetErrorIndices()[1], 3u);
+  BOOST_CHECK_PV(a[0],1.0,0.5);
+  BOOST_CHECK_PV(a[1],2.0,0.0);
+  BOOST_CHECK_PV(a[3],-4.0,1.0);
+}
+
+BOOST_AUTO_TEST_CASE(from_values_and_errors)
+{
+  SA sa({ 1.0, 2.0, 3.0 }, { 2 }, { -0.5 });
+  BOOST_CHECK_EQUAL(sa.NumErrors(), 1u);
+  BOOST_CHECK_PV(sa[0],1.0,0.0);
+  BOOST_CHECK_PV(sa[2],3.0,0.5);
+
+  SA exact(std::vector<double> { 1.0, 2.0 });
+  BOOST_CHECK_EQUAL(exact.NumErrors(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(roundtrip)
+{
+  const DenseArray dense = a.ToDense();
+  BOOST_REQUIRE_EQUAL(dense.size(), denseA.size());
+
+  for(std::size_t i = 0; i < dense.size(); i++)
+  {
+    BOOST_CHECK_PVS(dense[i], denseA[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(array_array)
+{
+  CheckElementWise(a * b, denseA, denseB, [](const VD& x, const VD& y) { return x * y; });
+  CheckElementWise(a / b, denseA, denseB, [](const VD& x, const VD& y) { return x / y; });
+  CheckElementWise(a + b, denseA, denseB, [](const VD& x, const VD& y) { return x + y; });
+  CheckElementWise(a - b, denseA, denseB, [](const VD& x, const VD& y) { return x - y; });
+}
+
+BOOST_AUTO_TEST_CASE(array_scalar)
+{
+  const DenseArray scalar(denseA.size(), VD(3.0));
+
+  CheckElementWise(a * 3.0, denseA, scalar, [](const VD& x, const VD& y) { return x * y; });
+  CheckElementWise(3.0 * a, scalar, denseA, [](const VD& x, const VD& y) { return x * y; });
+  CheckElementWise(a / 3.0, denseA, scalar, [](const VD& x, const VD& y) { return x / y; });
+  CheckElementWise(3.0 / a, scalar, denseA, [](const VD& x, const VD& y) { return x / y; });
+  CheckElementWise(a + 3.0, denseA, scalar, [](const VD& x, const VD& y) { return x + y; });
+  CheckElementWise(3.0 - a, scalar, denseA, [](const VD& x, const VD& y) { return x - y; });
+}
+
+BOOST_AUTO_TEST_CASE(array_value_with_error)
+{
+  // the error of the scalar reaches the exact elements as well
+  const VD v(3.0, 0.1);
+  const DenseArray scalar(denseA.size(), v);
+
+  CheckElementWise(a * v, denseA, scalar, [](const VD& x, const VD& y) { return x * y; });
+  CheckElementWise(v * a, scalar, denseA, [](const VD& x, const VD& y) { return x * y; });
+  CheckElementWise(a / v, denseA, scalar, [](const VD& x, const VD& y) { return x / y; });
+  CheckElementWise(v / a, scalar, denseA, [](const VD& x, const VD& y) { return x / y; });
+  CheckElementWise(a + v, denseA, scalar, [](const VD& x, const VD& y) { return x + y; });
+  CheckElementWise(v - a, scalar, denseA, [](const VD& x, const VD& y) { return x - y; });
+  BOOST_CHECK_EQUAL((a * v).NumErrors(), denseA.size());
+
+  // an exact ValueWithError keeps the sparsity
+  const VD exact(3.0);
+  CheckElementWise(a * exact, denseA, DenseArray(denseA.size(), exact), [](const VD& x, const VD& y) { return x * y; });
+  BOOST_CHECK_EQUAL((a * exact).NumErrors(), a.NumErrors());
+
+  SA result(a);
+  result *= v;
+  CheckElementWise(result, denseA, scalar, [](const VD& x, const VD& y) { return x * y; });
+}
+
+BOOST_AUTO_TEST_CASE(zero_errors_are_dropped)
+{
+  const SA result = a * b * 0.0;
+  BOOST_CHECK_EQUAL(result.NumErrors(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(compound_assignment)
+{
+  SA result(a);
+  result *= b;
+  result += 1.0;
+  CheckElementWise(result, denseA, denseB, [](const VD& x, const VD& y) { return x * y + 1.0; });
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_SparseErrorArray
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
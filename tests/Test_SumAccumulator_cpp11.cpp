@@ -0,0 +1,400 @@
+#include "SumAccumulator.hpp"
+#include "ThreadPool.hpp"
+#include "precompiled.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#if __cplusplus >= 201703L
+#include <execution>
+#endif
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, LinearCombinationPolicy>  Linear;
+  typedef CombinedPolicy<ExactValueAndIgnoreErrorPolicy, MaximumCombinationPolicy> Maximum;
+
+  typedef ValueWithError<double> VD;
+  typedef SumAccumulator<double> AD;
+  typedef SumAccumulator<double, ExactValueAndIgnoreErrorPolicy, CompensatedSummation>  CompensatedAD;
+  typedef SumAccumulator<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> ReproducibleAD;
+
+  const double tolerance = 1e-10;
+
+  template<typename P>
+  std::vector<ValueWithError<double, P> > make_terms(std::size_t n)
+  {
+    std::vector<ValueWithError<double, P> > result;
+    for(std::size_t i = 0; i < n; i++)
+    {
+      const double k = static_cast<double>(i);
+      result.push_back(ValueWithError<double, P>(1.0 + 0.5 * k, 0.01 * (1.0 + static_cast<double>(i % 13))));
+    }
+    return result;
+  }
+
+  /// Reference with chained operator+
+  template<typename P>
+  ValueWithError<double, P> chained_sum(const std::vector<ValueWithError<double, P> >& terms)
+  {
+    ValueWithError<double, P> sum(0.0, 0.0);
+    for(const ValueWithError<double, P>& term : terms)
+    {
+      sum = sum + term;
+    }
+    return sum;
+  }
+
+  template<typename P>
+  void check_policy()
+  {
+    const std::vector<ValueWithError<double, P> > terms = make_terms<P>(1000);
+    const ValueWithError<double, P> reference = chained_sum(terms);
+
+    SumAccumulator<double, P> sum;
+    for(const ValueWithError<double, P>& term : terms)
+    {
+      sum += term;
+    }
+
+    BOOST_CHECK_CLOSE(sum.Result().GetValue(), reference.GetValue(), tolerance);
+    BOOST_CHECK_CLOSE(sum.Result().GetError(), reference.GetError(), tolerance);
+  }
+
+  /// Values over 24 orders of magnitude with both signs, most of them cancel
+  std::vector<VD> wide_range_terms(std::size_t n)
+  {
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-40, 40);
+
+    std::vector<VD> result;
+    for(std::size_t i = 0; i < n; i++)
+    {
+      const double v = std::ldexp(mantissa(engine), exponent(engine));
+      result.push_back(VD(v, std::ldexp(std::abs(mantissa(engine)), exponent(engine) / 2)));
+      result.push_back(VD(-v, 0.0));
+      result.push_back(VD(mantissa(engine), 0.0));
+    }
+    return result;
+  }
+
+  /// Sum over blocks of the given size, the partial sums merged in reverse order
+  template<typename A>
+  A blocked_sum(const std::vector<VD>& terms, std::size_t block)
+  {
+    std::vector<A> partial;
+    for(std::size_t begin = 0; begin < terms.size(); begin += block)
+    {
+      A sum;
+      for(std::size_t i = begin; i < std::min(begin + block, terms.size()); i++)
+      {
+        sum += terms[i];
+      }
+      partial.push_back(sum);
+    }
+
+    return std::accumulate(partial.rbegin(), partial.rend(), A());
+  }
+
+  double reproducible_sum(std::initializer_list<double> values)
+  {
+    SumAccumulator<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> sum;
+    for(double v : values)
+    {
+      sum += VD(v, 0.0);
+    }
+    return sum.GetValue();
+  }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Test_SumAccumulator)
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+  const VD sum = AD().Result();
+  BOOST_CHECK_EQUAL(sum.GetValue(), 0.0);
+  BOOST_CHECK_EQUAL(sum.GetError(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(single_term)
+{
+  const AD sum(VD(2.0, -0.5));
+  BOOST_CHECK_EQUAL(sum.GetValue(), 2.0);
+  BOOST_CHECK_EQUAL(sum.Result().GetError(), 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(quadrature)
+{
+  AD sum;
+  sum += VD(1.0, 0.3);
+  sum += VD(2.0, 0.4);
+  BOOST_CHECK_EQUAL(sum.GetValue(), 3.0);
+  BOOST_CHECK_CLOSE(sum.Result().GetError(), 0.5, tolerance);
+
+  check_policy<ExactValueAndIgnoreErrorPolicy>();
+}
+
+BOOST_AUTO_TEST_CASE(linear_and_maximum)
+{
+  check_policy<Linear>();
+  check_policy<Maximum>();
+
+  SumAccumulator<double, Linear> linear;
+  linear += ValueWithError<double, Linear>(1.0, 0.3);
+  linear += ValueWithError<double, Linear>(2.0, -0.4);
+  BOOST_CHECK_CLOSE(linear.Result().GetError(), 0.7, tolerance);
+
+  SumAccumulator<double, Maximum> maximum;
+  maximum += ValueWithError<double, Maximum>(1.0, 0.3);
+  maximum += ValueWithError<double, Maximum>(2.0, -0.4);
+  BOOST_CHECK_EQUAL(maximum.Result().GetError(), 0.4);
+}
+
+BOOST_AUTO_TEST_CASE(associative)
+{
+  const std::vector<VD> terms = make_terms<ExactValueAndIgnoreErrorPolicy>(999);
+  const VD reference = chained_sum(terms);
+
+  for(std::size_t numGroups : { 1, 2, 7, 64 })
+  {
+    // partial sums over strided groups, merged in reverse order
+    std::vector<AD> partial(numGroups);
+    for(std::size_t i = 0; i < terms.size(); i++)
+    {
+      partial[i % numGroups] += terms[i];
+    }
+
+    const AD sum = std::accumulate(partial.rbegin(), partial.rend(), AD());
+    BOOST_CHECK_CLOSE(sum.GetValue(), reference.GetValue(), tolerance);
+    BOOST_CHECK_CLOSE(sum.Result().GetError(), reference.GetError(), tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(reduction)
+{
+  const std::vector<VD> terms = make_terms<ExactValueAndIgnoreErrorPolicy>(100);
+  const VD reference = chained_sum(terms);
+  const SumReduction<double> reduce;
+
+  const AD sum = std::accumulate(terms.begin(), terms.end(), AD(), reduce);
+  BOOST_CHECK_CLOSE(sum.Result().GetValue(), reference.GetValue(), tolerance);
+  BOOST_CHECK_CLOSE(sum.Result().GetError(), reference.GetError(), tolerance);
+
+  // all combinations of terms and partial sums
+  const VD a(1.0, 0.3), b(2.0, 0.4);
+  BOOST_CHECK_CLOSE(reduce(a, b).Result().GetError(), 0.5, tolerance);
+  BOOST_CHECK_CLOSE(reduce(AD(a), b).Result().GetError(), 0.5, tolerance);
+  BOOST_CHECK_CLOSE(reduce(a, AD(b)).Result().GetError(), 0.5, tolerance);
+  BOOST_CHECK_CLOSE(reduce(AD(a), AD(b)).Result().GetError(), 0.5, tolerance);
+  BOOST_CHECK_EQUAL(reduce(a, b).GetValue(), 3.0);
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool)
+{
+  const std::vector<VD> terms = make_terms<ExactValueAndIgnoreErrorPolicy>(10000);
+  const VD reference = chained_sum(terms);
+
+  ThreadPool pool(3);
+  const std::size_t grain = 100;
+  std::vector<AD> partial(terms.size() / grain);
+
+  pool.ParallelFor(terms.size(), grain, [&](std::size_t begin, std::size_t end)
+  {
+    partial[begin / grain] = std::accumulate(terms.begin() + begin, terms.begin() + end, AD(), SumReduction<double>());
+  });
+
+  const AD sum = std::accumulate(partial.begin(), partial.end(), AD());
+  BOOST_CHECK_CLOSE(sum.Result().GetValue(), reference.GetValue(), tolerance);
+  BOOST_CHECK_CLOSE(sum.Result().GetError(), reference.GetError(), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(compensated)
+{
+  // the tiny terms are lost one by one with plain summation
+  const std::size_t n = 100000;
+  AD plain(VD(1.0, 1.0));
+  CompensatedAD compensated(VD(1.0, 1.0));
+  for(std::size_t i = 0; i < n; i++)
+  {
+    plain += VD(1e-16, 1e-8);
+    compensated += VD(1e-16, 1e-8);
+  }
+
+  const double value = 1.0 + static_cast<double>(n) * 1e-16;
+  const double error = std::sqrt(1.0 + static_cast<double>(n) * 1e-16);
+  BOOST_CHECK_EQUAL(plain.GetValue(), 1.0);
+  BOOST_CHECK_CLOSE(compensated.GetValue(), value, 1e-13);
+  BOOST_CHECK_CLOSE(compensated.Result().GetError(), error, 1e-13);
+
+  // merged partial sums keep their compensation
+  CompensatedAD merged;
+  merged += CompensatedAD(VD(1.0, 1.0));
+  CompensatedAD tiny;
+  for(std::size_t i = 0; i < n; i++)
+  {
+    tiny += VD(1e-16, 1e-8);
+  }
+  merged += tiny;
+  BOOST_CHECK_CLOSE(merged.GetValue(), value, 1e-13);
+
+  const std::vector<VD> terms = make_terms<ExactValueAndIgnoreErrorPolicy>(1000);
+  const VD reference = chained_sum(terms);
+  const CompensatedAD sum = std::accumulate(terms.begin(), terms.end(), CompensatedAD(),
+                                            SumReduction<double, ExactValueAndIgnoreErrorPolicy, CompensatedSummation>());
+  BOOST_CHECK_CLOSE(sum.GetValue(), reference.GetValue(), tolerance);
+  BOOST_CHECK_CLOSE(sum.Result().GetError(), reference.GetError(), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(reproducible_rounding)
+{
+  const double two53 = 9007199254740992.0;
+  const double twoM60 = std::ldexp(1.0, -60);
+
+  BOOST_CHECK_EQUAL(reproducible_sum({}), 0.0);
+  BOOST_CHECK_EQUAL(reproducible_sum({ 1e30, 1.0, -1e30 }), 1.0);
+  BOOST_CHECK_EQUAL(reproducible_sum({ 0.1, 0.2, -0.3 }), (0.1 - 0.3) + 0.2);
+  BOOST_CHECK_EQUAL(reproducible_sum({ -2.5, 1.0 }), -1.5);
+
+  // rounding to nearest, ties to even, the bits far below decide a tie
+  BOOST_CHECK_EQUAL(reproducible_sum({ two53, 1.0 }), two53);
+  BOOST_CHECK_EQUAL(reproducible_sum({ two53, 1.0, twoM60 }), two53 + 2.0);
+  BOOST_CHECK_EQUAL(reproducible_sum({ two53, 3.0 }), two53 + 4.0);
+  BOOST_CHECK_EQUAL(reproducible_sum({ -two53, -1.0, -twoM60 }), -two53 - 2.0);
+
+  // extremes of the range
+  const double tiny = std::numeric_limits<double>::denorm_min();
+  const double huge = std::numeric_limits<double>::max();
+  BOOST_CHECK_EQUAL(reproducible_sum({ tiny, tiny, tiny }), 3.0 * tiny);
+  BOOST_CHECK_EQUAL(reproducible_sum({ std::numeric_limits<double>::min(), -tiny }),
+                    std::numeric_limits<double>::min() - tiny);
+  BOOST_CHECK_EQUAL(reproducible_sum({ huge, -huge, huge }), huge);
+  BOOST_CHECK(std::isinf(reproducible_sum({ huge, huge })));
+
+  // terms far below the largest one are dropped, independent of the order
+  const double large = std::ldexp(1.0, 200);
+  BOOST_CHECK_EQUAL(reproducible_sum({ large, std::ldexp(1.0, -100), -large }), 0.0);
+  BOOST_CHECK_EQUAL(reproducible_sum({ std::ldexp(1.0, -100), large, -large }), 0.0);
+  BOOST_CHECK_EQUAL(reproducible_sum({ large, std::ldexp(1.0, 52), -large }), std::ldexp(1.0, 52));
+
+  // non-finite terms
+  const double inf = std::numeric_limits<double>::infinity();
+  BOOST_CHECK_EQUAL(reproducible_sum({ 1.0, inf, 2.0 }), inf);
+  BOOST_CHECK(std::isnan(reproducible_sum({ inf, -inf })));
+  BOOST_CHECK(std::isnan(reproducible_sum({ 1.0, std::numeric_limits<double>::quiet_NaN() })));
+
+  SumAccumulator<float, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> single;
+  single += ValueWithError<float>(1e20f, 3.0f);
+  single += ValueWithError<float>(1.0f, 4.0f);
+  single += ValueWithError<float>(-1e20f, 0.0f);
+  BOOST_CHECK_EQUAL(single.GetValue(), 1.0f);
+  BOOST_CHECK_EQUAL(single.Result().GetError(), 5.0f);
+}
+
+BOOST_AUTO_TEST_CASE(reproducible_order)
+{
+  std::vector<VD> terms = wide_range_terms(3000);
+  const ReproducibleAD reference = blocked_sum<ReproducibleAD>(terms, terms.size());
+
+  // sums in other orders and groupings differ with plain summation, but not with the binned sum
+  std::mt19937 engine(7);
+  std::shuffle(terms.begin(), terms.end(), engine);
+
+  bool plainDiffers = false;
+  for(std::size_t block : { 1, 10, 777, 9000 })
+  {
+    const ReproducibleAD sum = blocked_sum<ReproducibleAD>(terms, block);
+    BOOST_CHECK_EQUAL(sum.GetValue(), reference.GetValue());
+    BOOST_CHECK_EQUAL(sum.Result().GetError(), reference.Result().GetError());
+
+    plainDiffers = plainDiffers || blocked_sum<AD>(terms, block).GetValue() != reference.GetValue();
+  }
+  BOOST_CHECK(plainDiffers);
+
+  // any number of threads and grain size
+  for(std::size_t numThreads : { 1, 2, 5 })
+  {
+    ThreadPool pool(numThreads);
+    for(std::size_t grain : { 1, 64, 1000 })
+    {
+      std::vector<ReproducibleAD> partial((terms.size() - 1) / grain + 1);
+      pool.ParallelFor(terms.size(), grain, [&](std::size_t begin, std::size_t end)
+      {
+        for(std::size_t i = begin; i < end; i++)
+        {
+          partial[begin / grain] += terms[i];
+        }
+      });
+
+      const ReproducibleAD sum = std::accumulate(partial.begin(), partial.end(), ReproducibleAD());
+      BOOST_CHECK_EQUAL(sum.GetValue(), reference.GetValue());
+      BOOST_CHECK_EQUAL(sum.Result().GetError(), reference.Result().GetError());
+    }
+  }
+
+  // the large terms cancel exactly, the compensated sum of the others is accurate
+  CompensatedAD small;
+  for(const VD& term : terms)
+  {
+    if(std::abs(term.GetValue()) <= 1.0)
+    {
+      small += VD(term.GetValue(), 0.0);
+    }
+  }
+
+  std::vector<VD> large;
+  std::copy_if(terms.begin(), terms.end(), std::back_inserter(large), [](const VD& term) { return std::abs(term.GetValue()) > 1.0; });
+  BOOST_CHECK_EQUAL(blocked_sum<ReproducibleAD>(large, 100).GetValue(), 0.0);
+  BOOST_CHECK_CLOSE(small.GetValue(), reference.GetValue(), 1e-12);
+}
+
+#ifdef __cpp_lib_parallel_algorithm
+BOOST_AUTO_TEST_CASE(execution_policies)
+{
+  const std::vector<VD> terms = make_terms<ExactValueAndIgnoreErrorPolicy>(100000);
+  const VD reference = chained_sum(terms);
+  const SumReduction<double> reduce;
+
+  const AD sequenced = std::reduce(std::execution::seq, terms.begin(), terms.end(), AD(), reduce);
+  const AD parallel = std::reduce(std::execution::par, terms.begin(), terms.end(), AD(), reduce);
+  const AD unsequenced = std::reduce(std::execution::par_unseq, terms.begin(), terms.end(), AD(), reduce);
+
+  for(const AD& sum : { sequenced, parallel, unsequenced })
+  {
+    BOOST_CHECK_CLOSE(sum.Result().GetValue(), reference.GetValue(), tolerance);
+    BOOST_CHECK_CLOSE(sum.Result().GetError(), reference.GetError(), tolerance);
+  }
+
+  const SumReduction<double, ExactValueAndIgnoreErrorPolicy, ReproducibleSummation> reproducible;
+  const VD serial = std::reduce(std::execution::seq, terms.begin(), terms.end(), ReproducibleAD(), reproducible).Result();
+  const VD threaded = std::reduce(std::execution::par_unseq, terms.begin(), terms.end(), ReproducibleAD(), reproducible).Result();
+  BOOST_CHECK_EQUAL(threaded.GetValue(), serial.GetValue());
+  BOOST_CHECK_EQUAL(threaded.GetError(), serial.GetError());
+
+  // sum of 2*x, the transformation yields terms which are combined with the partial sums
+  const AD doubled = std::transform_reduce(std::execution::par_unseq, terms.begin(), terms.end(), AD(), reduce,
+                                           [](const VD& x) { return 2.0 * x; });
+  BOOST_CHECK_CLOSE(doubled.Result().GetValue(), 2.0 * reference.GetValue(), tolerance);
+  BOOST_CHECK_CLOSE(doubled.Result().GetError(), 2.0 * reference.GetError(), tolerance);
+}
+#endif // __cpp_lib_parallel_algorithm
+
+BOOST_AUTO_TEST_SUITE_END() // Test_SumAccumulator
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
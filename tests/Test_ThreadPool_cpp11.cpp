@@ -0,0 +1,206 @@
+#include "ThreadPool.hpp"
+#include "precompiled.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+BOOST_AUTO_TEST_SUITE(Test_ThreadPool)
+
+BOOST_AUTO_TEST_CASE(size)
+{
+  ThreadPool pool(3);
+  BOOST_CHECK_EQUAL(pool.size(), 3u);
+
+  ThreadPool atLeastOne(0);
+  BOOST_CHECK_EQUAL(atLeastOne.size(), 1u);
+  BOOST_CHECK_GE(ThreadPool::DefaultNumThreads(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(submit)
+{
+  ThreadPool pool(2);
+  std::future<int> result = pool.Submit([] { return 42; });
+  BOOST_CHECK_EQUAL(result.get(), 42);
+
+  std::future<void> error = pool.Submit([] { throw std::runtime_error("task failed"); });
+  BOOST_CHECK_THROW(error.get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for)
+{
+  ThreadPool pool(4);
+
+  for(std::size_t n : { 0, 1, 7, 1000, 1001 })
+  {
+    std::vector<std::atomic<int> > visited(n);
+    for(auto& v : visited)
+    {
+      v = 0;
+    }
+
+    // Boost.Test macros must not be used in the worker threads
+    std::atomic<bool> invalidChunk(false);
+
+    pool.ParallelFor(n, 16, [&](std::size_t begin, std::size_t end)
+    {
+      if(begin >= end || end > n)
+      {
+        invalidChunk = true;
+      }
+
+      for(std::size_t i = begin; i < end; i++)
+      {
+        visited[i]++;
+      }
+    });
+
+    BOOST_CHECK(!invalidChunk);
+    for(std::size_t i = 0; i < n; i++)
+    {
+      BOOST_REQUIRE_EQUAL(visited[i].load(), 1);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_grain)
+{
+  ThreadPool pool(3);
+  const std::size_t n = 1000;
+  const std::size_t grain = 7;
+
+  std::atomic<bool> invalidBlock(false);
+  std::atomic<std::size_t> numBlocks(0);
+
+  pool.ParallelFor(n, grain, [&](std::size_t begin, std::size_t end)
+  {
+    if(begin % grain != 0 || (end - begin != grain && end != n))
+    {
+      invalidBlock = true;
+    }
+    numBlocks++;
+  });
+
+  BOOST_CHECK(!invalidBlock);
+  BOOST_CHECK_EQUAL(numBlocks.load(), (n + grain - 1) / grain);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_skewed)
+{
+  // all expensive blocks are in the share of the first participant, the others have to steal them
+  ThreadPool pool(4);
+  const std::size_t n = 256;
+  std::vector<std::atomic<int> > visited(n);
+  for(auto& v : visited)
+  {
+    v = 0;
+  }
+
+  pool.ParallelFor(n, 1, [&](std::size_t begin, std::size_t end)
+  {
+    if(begin < n / 8)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    for(std::size_t i = begin; i < end; i++)
+    {
+      visited[i]++;
+    }
+  });
+
+  for(std::size_t i = 0; i < n; i++)
+  {
+    BOOST_REQUIRE_EQUAL(visited[i].load(), 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_exception)
+{
+  ThreadPool pool(2);
+  std::atomic<int> count(0);
+
+  BOOST_CHECK_THROW(pool.ParallelFor(1000, 1, [&](std::size_t begin, std::size_t)
+  {
+    count++;
+    if(begin == 500)
+    {
+      throw std::runtime_error("block failed");
+    }
+  }), std::runtime_error);
+
+  BOOST_CHECK_LE(count.load(), 1000);
+
+  // the pool is still usable
+  std::atomic<std::size_t> sum(0);
+  pool.ParallelFor(100, 10, [&](std::size_t begin, std::size_t end) { sum += end - begin; });
+  BOOST_CHECK_EQUAL(sum.load(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_nested)
+{
+  // the waiting threads run the queued blocks of the inner loops, otherwise this would deadlock
+  ThreadPool pool(2);
+  const std::size_t n = 16;
+  std::vector<std::atomic<int> > visited(n * n);
+  for(auto& v : visited)
+  {
+    v = 0;
+  }
+
+  pool.ParallelFor(n, 1, [&](std::size_t outer, std::size_t)
+  {
+    pool.ParallelFor(n, 1, [&](std::size_t inner, std::size_t)
+    {
+      visited[outer * n + inner]++;
+    });
+  });
+
+  for(std::size_t i = 0; i < n * n; i++)
+  {
+    BOOST_REQUIRE_EQUAL(visited[i].load(), 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(submit_from_task)
+{
+  ThreadPool pool(2);
+  std::future<int> outer = pool.Submit([&pool]
+  {
+    // lands in the queue of the submitting worker, the other worker may steal it
+    std::future<int> inner = pool.Submit([] { return 21; });
+    return 2 * inner.get();
+  });
+
+  BOOST_CHECK_EQUAL(outer.get(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(destructor_finishes_tasks)
+{
+  std::atomic<int> count(0);
+
+  {
+    ThreadPool pool(2);
+    for(int i = 0; i < 100; i++)
+    {
+      pool.Submit([&count] { count++; });
+    }
+  }
+
+  BOOST_CHECK_EQUAL(count.load(), 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_ThreadPool
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
@@ -0,0 +1,140 @@
+#include "UnscentedTransform.hpp"
+#include "precompiled.hpp"
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double>     VD;
+  typedef UnscentedTransform<double> Transform;
+  typedef std::array<double, 2>      Vector;
+  typedef std::array<Vector, 2>      Matrix;
+
+  double linear(double a, double b)
+  {
+    return 3.0 * a - 2.0 * b + 1.0;
+  }
+
+  double nonlinear(double a, double b)
+  {
+    return std::exp(a) * std::sin(b);
+  }
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      a(1.5, 0.2),
+      b(0.5, 0.1)
+    {}
+
+    const VD a, b;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_UnscentedTransform,Fixture)
+
+BOOST_AUTO_TEST_CASE(parameters)
+{
+  Transform transform;
+  BOOST_CHECK_EQUAL(transform.GetAlpha(), 1.0);
+  BOOST_CHECK_EQUAL(transform.GetBeta(), 2.0);
+  BOOST_CHECK_EQUAL(transform.GetKappa(), 0.0);
+
+  transform.SetParameters(0.5, 1.0, -1.0);
+  BOOST_CHECK_EQUAL(transform.GetAlpha(), 0.5);
+  BOOST_CHECK_EQUAL(transform.GetBeta(), 1.0);
+  BOOST_CHECK_EQUAL(transform.GetKappa(), -1.0);
+
+  BOOST_CHECK_EQUAL(Transform::NumSigmaPoints(3), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(same_as_linear_overloads)
+{
+  Transform transform;
+  const VD result = transform.Propagate(linear, a, b);
+  const VD reference = 3.0 * a - 2.0 * b + 1.0;
+
+  BOOST_CHECK_CLOSE(result.GetValue(), reference.GetValue(), 1e-12);
+  BOOST_CHECK_CLOSE(result.GetError(), reference.GetError(), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(exact_for_quadratic)
+{
+  // x ~ N(v, e^2): E[x^2] = v^2 + e^2, Var[x^2] = 4 v^2 e^2 + 2 e^4
+  Transform transform;
+  const VD result = transform.Propagate([](double x) { return x * x; }, a);
+
+  BOOST_CHECK_CLOSE(result.GetValue(), 2.25 + 0.04, 1e-12);
+  BOOST_CHECK_CLOSE(result.GetError(), std::sqrt(4.0 * 2.25 * 0.04 + 2.0 * 0.0016), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(zero_error)
+{
+  Transform transform;
+  const VD result = transform.Propagate(nonlinear, VD(1.5, 0.0), VD(0.5, 0.0));
+  BOOST_CHECK_PV(result, nonlinear(1.5, 0.5), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(covariance)
+{
+  Transform transform;
+  const Vector mean = {{ 1.5, 0.5 }};
+
+  // diagonal covariance is the same as independent arguments
+  const Matrix diagonal = {{ {{ 0.04, 0.0 }}, {{ 0.0, 0.01 }} }};
+  const VD independent = transform.Propagate(nonlinear, a, b);
+  const VD fromMatrix = transform.Propagate(nonlinear, mean, diagonal);
+  BOOST_CHECK_CLOSE(fromMatrix.GetValue(), independent.GetValue(), 1e-12);
+  BOOST_CHECK_CLOSE(fromMatrix.GetError(), independent.GetError(), 1e-12);
+
+  // Var[a + b] = Var[a] + Var[b] + 2 Cov[a, b]
+  const Matrix correlated = {{ {{ 0.04, 0.015 }}, {{ 0.015, 0.01 }} }};
+  const VD sum = transform.Propagate([](double x, double y) { return x + y; }, mean, correlated);
+  BOOST_CHECK_CLOSE(sum.GetValue(), 2.0, 1e-12);
+  BOOST_CHECK_CLOSE(sum.GetError(), std::sqrt(0.04 + 0.01 + 0.03), 1e-12);
+
+  // fully correlated, the covariance is only semi-definite
+  const Matrix singular = {{ {{ 0.04, 0.02 }}, {{ 0.02, 0.01 }} }};
+  const VD difference = transform.Propagate([](double x, double y) { return x - 2.0 * y; }, mean, singular);
+  BOOST_CHECK_CLOSE(difference.GetValue(), 0.5, 1e-12);
+  BOOST_CHECK_SMALL(difference.GetError(), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_same_as_serial)
+{
+  ThreadPool pool(2);
+  Transform serial, parallel(&pool);
+
+  const VD expected = serial.Propagate(nonlinear, a, b);
+  const VD result = parallel.Propagate(nonlinear, a, b);
+  BOOST_CHECK_PVS(result, expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Test_UnscentedTransform
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,168 @@
+#define DISABLE_ERROR_PROPAGATION
+#include "ValueWithError.hpp"
+#include "precompiled.hpp"
+
+#define TEST_COMPATIBLE_TYPE
+#include "common.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+using namespace error_propagation;
+
+namespace {
+
+  typedef ValueWithError<double> VD;
+  typedef ValueWithError<float>  VF;
+
+  struct Fixture
+  {
+    Fixture()
+      :
+      pvd(1.0, 2.0),
+      pvf(1.0f, 2.0f)
+    {}
+
+    VD pvd;
+    VF pvf;
+  };
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(Test_ValueWithError_disabled,Fixture)
+
+BOOST_AUTO_TEST_CASE(layout)
+{
+  static_assert(sizeof(VD) == sizeof(double), "only the value is stored");
+  static_assert(sizeof(VF) == sizeof(float), "only the value is stored");
+  static_assert(std::is_trivially_copyable<VD>::value, "must be copyable like a plain double");
+  BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(error_is_zero)
+{
+  BOOST_CHECK_PV(VD(),0.0,0.0);
+  BOOST_CHECK_PV(VD(1.0),1.0,0.0);
+  BOOST_CHECK_PV(VD(1.0, 2.0),1.0,0.0);
+  BOOST_CHECK_PV(make_value(1.0, 2.0),1.0,0.0);
+
+  VD pv { 3.0, 4.0 };
+  BOOST_CHECK_PV(pv,3.0,0.0);
+}
+
+BOOST_AUTO_TEST_CASE(same_results_as_plain_type)
+{
+  const double x = 0.75, y = 2.5;
+  const VD a(x, 0.1), b(y, 0.2);
+
+  BOOST_CHECK_EQUAL((a * b).GetValue(), x * y);
+  BOOST_CHECK_EQUAL((a / b).GetValue(), x / y);
+  BOOST_CHECK_EQUAL((a + b).GetValue(), x + y);
+  BOOST_CHECK_EQUAL((a - b).GetValue(), x - y);
+  BOOST_CHECK_EQUAL((2.0 * a - b / 3.0).GetValue(), 2.0 * x - y / 3.0);
+  BOOST_CHECK_EQUAL(exp(sin(a) * log(b)).GetValue(), std::exp(std::sin(x) * std::log(y)));
+  BOOST_CHECK_EQUAL(pow(a, b).GetValue(), std::pow(x, y));
+  BOOST_CHECK_EQUAL(atan2(a, b).GetValue(), std::atan2(x, y));
+  BOOST_CHECK_EQUAL(hypot(a, y).GetValue(), boost::math::hypot(x, y));
+  BOOST_CHECK_EQUAL(tgamma(b).GetValue(), std::tgamma(y));
+  BOOST_CHECK_EQUAL(pow<2>(a).GetValue(), x * x);
+  BOOST_CHECK_EQUAL(pow(b, -1).GetValue(), 1.0 / y);
+  BOOST_CHECK_EQUAL(fma(a, b, 1.0).GetValue(), std::fma(x, y, 1.0));
+  BOOST_CHECK_EQUAL(fma(2.0, a, b).GetValue(), std::fma(2.0, x, y));
+
+  const VD coefficients[] = { VD(1.0, 0.1), VD(-2.0, 0.2), VD(3.0, 0.3) };
+  BOOST_CHECK_EQUAL(evaluate_polynomial(coefficients, coefficients + 3, a).GetValue(), (3.0 * x - 2.0) * x + 1.0);
+  BOOST_CHECK_EQUAL(evaluate_polynomial(coefficients, coefficients + 3, x).GetError(), 0.0);
+
+  VD c(a);
+  c *= b;
+  c += 1.0;
+  BOOST_CHECK_EQUAL(c.GetValue(), x * y + 1.0);
+  BOOST_CHECK_EQUAL(c.GetError(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(comparison)
+{
+  BOOST_CHECK(VD(1.0, 5.0) == VD(1.0, 0.0));
+  BOOST_CHECK(VD(1.0, 5.0) < 2.0);
+  BOOST_CHECK(!(VD(1.0, 5.0) > 2.0));
+}
+
+BOOST_AUTO_TEST_CASE(stream_roundtrip)
+{
+  std::stringstream sstr;
+  sstr << VD(1.5, 2.0);
+  BOOST_CHECK_EQUAL(sstr.str(), "(1.5+-0)");
+
+  VD pv;
+  std::stringstream in("(2.5+-3)");
+  in >> pv;
+  BOOST_CHECK(!in.fail());
+  BOOST_CHECK_PV(pv,2.5,0.0);
+}
+
+TEST_OP(times,*)
+TEST_OP(plus,+)
+TEST_OP(minus,-)
+TEST_OP(div,/)
+
+TEST_OP_COMPARE(equal,==)
+TEST_OP_COMPARE(not_equal,!=)
+TEST_OP_COMPARE(greater,>)
+TEST_OP_COMPARE(greater_than,>=)
+TEST_OP_COMPARE(smaller,<)
+TEST_OP_COMPARE(smaller_than,<=)
+
+TEST_MATH_ONE_ARG(abs)
+TEST_MATH_ONE_ARG(acos)
+TEST_MATH_ONE_ARG(acosh)
+TEST_MATH_ONE_ARG(asin)
+TEST_MATH_ONE_ARG(asinh)
+TEST_MATH_ONE_ARG(atan)
+TEST_MATH_ONE_ARG(atanh)
+TEST_MATH_ONE_ARG(cbrt)
+TEST_MATH_ONE_ARG(cos)
+TEST_MATH_ONE_ARG(cosh)
+TEST_MATH_ONE_ARG(erf)
+TEST_MATH_ONE_ARG(erfc)
+TEST_MATH_ONE_ARG(exp)
+TEST_MATH_ONE_ARG(exp2)
+TEST_MATH_ONE_ARG(expm1)
+TEST_MATH_ONE_ARG(fabs)
+TEST_MATH_ONE_ARG(lgamma)
+TEST_MATH_ONE_ARG(log)
+TEST_MATH_ONE_ARG(log10)
+TEST_MATH_ONE_ARG(log1p)
+TEST_MATH_ONE_ARG(log2)
+TEST_MATH_ONE_ARG(sin)
+TEST_MATH_ONE_ARG(sinh)
+TEST_MATH_ONE_ARG(sqrt)
+TEST_MATH_ONE_ARG(tan)
+TEST_MATH_ONE_ARG(tanh)
+TEST_MATH_ONE_ARG(tgamma)
+TEST_MATH_TWO_ARGS(atan2)
+TEST_MATH_TWO_ARGS(hypot)
+TEST_MATH_TWO_ARGS(pow)
+
+BOOST_AUTO_TEST_SUITE_END() // Test_ValueWithError_disabled
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif // __clang__
+
+#if defined __GNUC__ \
+            && ( __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) ) \
+            && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
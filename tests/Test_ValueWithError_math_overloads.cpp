@@ -222,6 +222,165 @@ BOOST_AUTO_TEST_CASE(negative)
 
 BOOST_AUTO_TEST_SUITE_END() // _pow_basePV_expDOUBLE
 
+BOOST_AUTO_TEST_SUITE(_pow_basePV_expINT)
+
+BOOST_AUTO_TEST_CASE(positive)
+{
+  VD base(2.0,2.0);
+  VD result = pow(base, 3);
+  BOOST_CHECK_CLOSE(result.GetValue(),8.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),3.0 * 4.0 * 2.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(zero)
+{
+  VD base(0.0,2.0);
+  VD result = pow(base, 3);
+  BOOST_CHECK_SMALL(result.GetValue(),D_EPS);
+  BOOST_CHECK_SMALL(result.GetError(),D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(negative)
+{
+  VD base(-2.0,2.0);
+  VD result = pow(base, 3);
+  BOOST_CHECK_CLOSE(result.GetValue(),-8.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),3.0 * 4.0 * 2.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(negative_exponent)
+{
+  VD base(-2.0,2.0);
+  VD result = pow(base, -3);
+  BOOST_CHECK_CLOSE(result.GetValue(),-0.125,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),3.0 / 16.0 * 2.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(zero_and_one_exponent)
+{
+  VD base(0.0,2.0);
+  BOOST_CHECK_CLOSE(pow(base, 0).GetValue(),1.0,D_EPS);
+  BOOST_CHECK_SMALL(pow(base, 0).GetError(),D_EPS);
+  BOOST_CHECK_SMALL(pow(base, 1).GetValue(),D_EPS);
+  BOOST_CHECK_CLOSE(pow(base, 1).GetError(),2.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(zero_base_negative_exponent)
+{
+  const VD base(0.0,0.1);
+  for(int n = -3; n <= -1; n++)
+  {
+    BOOST_CHECK_EQUAL(pow(base, n).GetValue(),pow(base, static_cast<double>(n)).GetValue());
+    BOOST_CHECK(boost::math::isinf(pow(base, n).GetValue()));
+    BOOST_CHECK(boost::math::isinf(pow(base, n).GetError()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(large_and_small_magnitudes)
+{
+  // x^(1-n) would overflow or underflow while x^n is representable
+  const VD large(1e200,1e198);
+  BOOST_CHECK_CLOSE(pow(large, -1).GetValue(),1e-200,1e-12);
+  BOOST_CHECK_CLOSE(pow(large, -1).GetError(),1e-202,1e-12);
+
+  const VD small(1e-100,1e-102);
+  BOOST_CHECK_CLOSE(pow(small, -3).GetValue(),1e300,1e-12);
+  BOOST_CHECK_CLOSE(pow(small, -3).GetError(),3e298,1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(same_as_double_exponent)
+{
+  const double values[] = { -3.7, -1.0, -0.3, 0.5, 1.9, 12.25 };
+  for(int n = -9; n <= 17; n++)
+  {
+    for(std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+      const VD base(values[i],0.1);
+      BOOST_CHECK_CLOSE(pow(base, n).GetValue(),pow(base, static_cast<double>(n)).GetValue(),1e-12);
+      BOOST_CHECK_CLOSE(pow(base, n).GetError(),pow(base, static_cast<double>(n)).GetError(),1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(promoted_type)
+{
+  const ValueWithError<float> base(2.0f,0.5f);
+  const ValueWithError<double> result = pow(base, 2);
+  BOOST_CHECK(sizeof(pow(base, 2).GetValue()) == sizeof(double));
+  BOOST_CHECK_CLOSE(result.GetError(),2.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // _pow_basePV_expINT
+
+BOOST_AUTO_TEST_SUITE(_pow_static)
+
+BOOST_AUTO_TEST_CASE(positive)
+{
+  VD base(2.0,2.0);
+  VD result = pow<3>(base);
+  BOOST_CHECK_CLOSE(result.GetValue(),8.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),3.0 * 4.0 * 2.0,D_EPS);
+
+  result = pow<2>(VD(-3.0,0.5));
+  BOOST_CHECK_CLOSE(result.GetValue(),9.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),3.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(zero_and_one)
+{
+  VD base(0.0,2.0);
+  BOOST_CHECK_CLOSE(pow<0>(base).GetValue(),1.0,D_EPS);
+  BOOST_CHECK_SMALL(pow<0>(base).GetError(),D_EPS);
+  BOOST_CHECK_SMALL(pow<1>(base).GetValue(),D_EPS);
+  BOOST_CHECK_CLOSE(pow<1>(base).GetError(),2.0,D_EPS);
+  BOOST_CHECK_SMALL(pow<4>(base).GetError(),D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(negative_exponent)
+{
+  VD base(2.0,0.1);
+  VD result = pow<-2>(base);
+  BOOST_CHECK_CLOSE(result.GetValue(),0.25,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),2.0 / 8.0 * 0.1,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(zero_base_negative_exponent)
+{
+  const VD base(0.0,0.1);
+  BOOST_CHECK_EQUAL(pow<-1>(base).GetValue(),pow(base, -1.0).GetValue());
+  BOOST_CHECK(boost::math::isinf(pow<-1>(base).GetValue()));
+  BOOST_CHECK(boost::math::isinf(pow<-1>(base).GetError()));
+  BOOST_CHECK(boost::math::isinf(pow<-2>(base).GetValue()));
+  BOOST_CHECK(boost::math::isinf(pow<-2>(base).GetError()));
+}
+
+BOOST_AUTO_TEST_CASE(large_and_small_magnitudes)
+{
+  const VD large(1e200,1e198);
+  BOOST_CHECK_CLOSE(pow<-1>(large).GetValue(),1e-200,1e-12);
+  BOOST_CHECK_CLOSE(pow<-1>(large).GetError(),1e-202,1e-12);
+
+  const VD small(1e-100,1e-102);
+  BOOST_CHECK_CLOSE(pow<-3>(small).GetValue(),1e300,1e-12);
+  BOOST_CHECK_CLOSE(pow<-3>(small).GetError(),3e298,1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(same_as_runtime_exponent)
+{
+  const VD base(-1.3,0.2);
+  BOOST_CHECK_CLOSE(pow<5>(base).GetValue(),pow(base, 5).GetValue(),1e-12);
+  BOOST_CHECK_CLOSE(pow<5>(base).GetError(),pow(base, 5).GetError(),1e-12);
+  BOOST_CHECK_CLOSE(pow<12>(base).GetValue(),pow(base, 12.0).GetValue(),1e-12);
+  BOOST_CHECK_CLOSE(pow<12>(base).GetError(),pow(base, 12.0).GetError(),1e-12);
+  BOOST_CHECK_CLOSE(pow<-7>(base).GetValue(),pow(base, -7.0).GetValue(),1e-12);
+  BOOST_CHECK_CLOSE(pow<-7>(base).GetError(),pow(base, -7.0).GetError(),1e-12);
+
+  // no promotion for the compile time exponent
+  BOOST_CHECK(sizeof(pow<2>(ValueWithError<float>(2.0f,0.5f)).GetValue()) == sizeof(float));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // _pow_static
+
 BOOST_AUTO_TEST_SUITE(_pow_baseDOUBLE_expPV)
 
 BOOST_AUTO_TEST_CASE(positive)
@@ -16,6 +16,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <iostream>
+#include <vector>
 
 using namespace error_propagation;
 
@@ -510,6 +511,121 @@ BOOST_AUTO_TEST_CASE(negative_fractional)
 
 BOOST_AUTO_TEST_SUITE_END() // _lgamma
 
+BOOST_AUTO_TEST_SUITE(_fma)
+
+BOOST_AUTO_TEST_CASE(x_y_z_pv)
+{
+  const VD x(2.0,0.1), y(3.0,0.2), z(1.0,0.3);
+  VD result = fma(x,y,z);
+  BOOST_CHECK_CLOSE(result.GetValue(),7.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),std::sqrt(0.09 + 0.16 + 0.09),D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),(x * y + z).GetError(),D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(mixed)
+{
+  const VD x(2.0,0.1), y(3.0,0.2), z(1.0,0.3);
+  BOOST_CHECK_CLOSE(fma(x,y,1.0).GetError(),0.5,D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(x,3.0,z).GetError(),std::sqrt(0.18),D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(2.0,y,z).GetError(),0.5,D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(x,-3.0,1.0).GetError(),0.3,D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(2.0,y,1.0).GetError(),0.4,D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(2.0,3.0,z).GetError(),0.3,D_EPS);
+  BOOST_CHECK_CLOSE(fma(2.0,y,z).GetValue(),7.0,D_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(single_rounding)
+{
+  const VD x(1.0 + D_EPS,0.0), y(1.0 - D_EPS,0.0);
+  BOOST_CHECK_EQUAL(fma(x,y,VD(-1.0)).GetValue(),-D_EPS * D_EPS);
+  BOOST_CHECK_EQUAL((x * y + VD(-1.0)).GetValue(),0.0);
+}
+
+BOOST_AUTO_TEST_CASE(linear_combination)
+{
+  typedef ValueWithError<double, CombinedPolicy<ExactValueAndIgnoreErrorPolicy, LinearCombinationPolicy> > VL;
+  const VL x(2.0,0.1), y(-3.0,0.2), z(1.0,0.3);
+  BOOST_CHECK_CLOSE(fma(x,y,z).GetError(),1.0,D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(extreme_magnitudes)
+{
+  // the squares of the contributions under- or overflow
+  const VD tiny(1.0,1e-170), huge(1.0,1e160);
+  BOOST_CHECK_CLOSE(fma(tiny,tiny,tiny).GetError(),std::sqrt(3.0) * 1e-170,D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(huge,huge,huge).GetError(),std::sqrt(3.0) * 1e160,D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(fma(tiny,huge,tiny).GetError(),1e160,D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // _fma
+
+BOOST_AUTO_TEST_SUITE(_evaluate_polynomial)
+
+BOOST_AUTO_TEST_CASE(coefficients_and_x_pv)
+{
+  // p(x) = 1 + 2x + 3x^2, p'(x) = 2 + 6x
+  const VD c[] = { VD(1.0,0.1), VD(2.0,0.2), VD(3.0,0.3) };
+  VD result = evaluate_polynomial(c,c + 3,VD(2.0,0.05));
+  BOOST_CHECK_CLOSE(result.GetValue(),17.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),std::sqrt(0.49 + 0.01 + 0.16 + 1.44),D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(exact_x)
+{
+  const VD c[] = { VD(1.0,0.1), VD(2.0,0.2), VD(3.0,0.3) };
+  const double x = 2.0;
+  VD result = evaluate_polynomial(c,c + 3,x);
+  BOOST_CHECK_CLOSE(result.GetValue(),17.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),std::sqrt(1.61),D_LARGE_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),((c[2] * x + c[1]) * x + c[0]).GetError(),D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(exact_coefficients)
+{
+  const std::vector<double> c = { 1.0, 2.0, 3.0 };
+  VD result = evaluate_polynomial(c.begin(),c.end(),VD(-2.0,0.05));
+  BOOST_CHECK_CLOSE(result.GetValue(),9.0,D_EPS);
+  BOOST_CHECK_CLOSE(result.GetError(),10.0 * 0.05,D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(extreme_magnitudes)
+{
+  const VD tiny[] = { VD(1.0,1e-170), VD(1.0,1e-170) };
+  BOOST_CHECK_CLOSE(evaluate_polynomial(tiny,tiny + 2,2.0).GetError(),std::sqrt(5.0) * 1e-170,D_LARGE_EPS);
+
+  const VD huge[] = { VD(1.0,1e160), VD(1.0,1e160) };
+  BOOST_CHECK_CLOSE(evaluate_polynomial(huge,huge + 2,2.0).GetError(),std::sqrt(5.0) * 1e160,D_LARGE_EPS);
+
+  // the square of the leading error underflows before x scales it up
+  const VD amplified[] = { VD(1.0,1.0), VD(1.0), VD(1.0,1e-170) };
+  BOOST_CHECK_CLOSE(evaluate_polynomial(amplified,amplified + 3,1e100).GetError(),1e30,D_LARGE_EPS);
+}
+
+BOOST_AUTO_TEST_CASE(degenerate)
+{
+  const VD c[] = { VD(4.0,0.5) };
+  BOOST_CHECK_EQUAL(evaluate_polynomial(c,c + 1,VD(3.0,1.0)).GetValue(),4.0);
+  BOOST_CHECK_EQUAL(evaluate_polynomial(c,c + 1,VD(3.0,1.0)).GetError(),0.5);
+  BOOST_CHECK_EQUAL(evaluate_polynomial(c,c,VD(3.0,1.0)).GetValue(),0.0);
+  BOOST_CHECK_EQUAL(evaluate_polynomial(c,c,VD(3.0,1.0)).GetError(),0.0);
+}
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  const std::vector<VD> c = { VD(1.0,0.1), VD(-2.0,0.0), VD(0.5,0.3), VD(0.25,0.01) };
+  const std::vector<VD> x = { VD(0.0,0.1), VD(1.0,0.2), VD(-3.0,0.0), VD(2.0,0.1) };
+  std::vector<VD> result(x.size());
+
+  BOOST_CHECK(evaluate_polynomial(c.begin(),c.end(),x.begin(),x.end(),result.begin()) == result.end());
+  for(std::size_t i = 0; i < x.size(); i++)
+  {
+    BOOST_CHECK_EQUAL(result[i].GetValue(),evaluate_polynomial(c.begin(),c.end(),x[i]).GetValue());
+    BOOST_CHECK_EQUAL(result[i].GetError(),evaluate_polynomial(c.begin(),c.end(),x[i]).GetError());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // _evaluate_polynomial
+
 BOOST_AUTO_TEST_SUITE_END() // Test_MathOverloads
 
 #ifdef __clang__
@@ -89,6 +89,17 @@ TEST_MATH_ONE_ARG(sqrt)
 TEST_MATH_ONE_ARG(tan)
 TEST_MATH_ONE_ARG(tanh)
 
+BOOST_AUTO_TEST_CASE(integer_pow)
+{
+  const VD pv(MPH(1.5),MPH(0.1));
+  const MPH tolerance = std::numeric_limits<MPH>::epsilon() * 10;
+
+  BOOST_CHECK_SMALL(MPH(pow<7>(pv).GetValue() - pow(pv,MPH(7)).GetValue()),tolerance);
+  BOOST_CHECK_SMALL(MPH(pow<7>(pv).GetError() - pow(pv,MPH(7)).GetError()),tolerance);
+  BOOST_CHECK_SMALL(MPH(pow(pv,-4).GetValue() - pow(pv,MPH(-4)).GetValue()),tolerance);
+  BOOST_CHECK_SMALL(MPH(pow(pv,-4).GetError() - pow(pv,MPH(-4)).GetError()),tolerance);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Test_ValueWithError_multiprecision
 
 #ifdef __clang__
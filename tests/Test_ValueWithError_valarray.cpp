@@ -114,6 +114,18 @@ TEST_MATH_ONE_ARG(sqrt)
 TEST_MATH_ONE_ARG(tan)
 TEST_MATH_ONE_ARG(tanh)
 
+  BOOST_AUTO_TEST_CASE(integer_pow)
+  {
+    const double values[] = { 1.0, 2.0, 4.0 };
+    const double errors[] = { 0.5, 0.25, 0.125 };
+    const VD pv(VAD(values, 3), VAD(errors, 3));
+
+    BOOST_CHECK_EQUAL_PV_VAL(pow<3>(pv), pow(pv, 3.0).GetValue(), pow(pv, 3.0).GetError());
+    BOOST_CHECK_EQUAL_PV_VAL(pow(pv, 2), pow(pv, 2.0).GetValue(), pow(pv, 2.0).GetError());
+    BOOST_CHECK_EQUAL_PV_VAL(pow(pv, -1), pow(pv, -1.0).GetValue(), pow(pv, -1.0).GetError());
+    BOOST_CHECK_EQUAL_PV_VAL(pow<0>(pv), VAD(1.0, 3), VAD(0.0, 3));
+  }
+
 BOOST_AUTO_TEST_SUITE_END() // Test_ValueWithError_Valarray
 
 #ifdef __clang__